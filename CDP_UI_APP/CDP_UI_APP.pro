@@ -0,0 +1,161 @@
+#-------------------------------------------------
+#
+# Project created by QtCreator 2023-12-25T11:15:36
+#
+#-------------------------------------------------
+
+QT       += core gui
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++14
+
+TARGET = CDP_UI_APP
+TEMPLATE = app
+
+# The following define makes your compiler emit warnings if you use
+# any feature of Qt which has been marked as deprecated (the exact warnings
+# depend on your compiler). Please consult the documentation of the
+# deprecated API in order to know how to port your code away from it.
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# You can also make your code fail to compile if you use deprecated APIs.
+# In order to do so, uncomment the following line.
+# You can also select to disable deprecated APIs only up to a certain version of Qt.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+# Latency histograms and frame counters (trace.h), remove to compile the
+# trace points out of the receive, parse and refresh paths.
+DEFINES += CDP_TRACE
+
+
+SOURCES += \
+        main.cpp \
+        cdpmainw.cpp \
+    parser.cpp \
+    swmaintenancew.cpp \
+    detailedsystemstatusw.cpp \
+    swversionw.cpp \
+    contmonsectionoverview.cpp \
+    canreadwrite.cpp \
+    candispatch.cpp \
+    lrustore.cpp \
+    nodehealth.cpp \
+    faultevents.cpp \
+    pdutelemetry.cpp \
+    lrudata.cpp \
+    displayrefresh.cpp \
+    iconmap.cpp \
+    deckview.cpp \
+    uldtracker.cpp \
+    tablecell.cpp \
+    sectionlayout.cpp \
+    sectionpage.cpp \
+    lrudetailview.cpp \
+    pdustatpg.cpp \
+    mcpstatuspage.cpp \
+    ocpstatuspage.cpp \
+    lcpstatuspage.cpp \
+    lcp20ftstatuspage.cpp \
+    legendsmenupage.cpp \
+    wdog.cpp \
+    powersupply.cpp \
+    nvmstorage_copy.cpp \
+    nvmstorage.cpp \
+    readout.cpp \
+    dataload.cpp \
+    trace.cpp \
+    panelimage.cpp \
+    uldstatuspage.cpp
+
+HEADERS += \
+        cdpmainw.h \
+    common.h \
+    parser.h \
+    swmaintenancew.h \
+    detailedsystemstatusw.h \
+    swversionw.h \
+    contmonsectionoverview.h \
+    canreadwrite.h \
+    canringbuffer.h \
+    canlog.h \
+    signalcodec.h \
+    icdsignals.h \
+    candispatch.h \
+    lrustore.h \
+    nodehealth.h \
+    faultevents.h \
+    pdutelemetry.h \
+    displayrefresh.h \
+    deckview.h \
+    uldtracker.h \
+    tablecell.h \
+    lrudata.h \
+    iconmap.h \
+    commondata.h \
+    sectionlayout.h \
+    sectionpage.h \
+    lrudetailview.h \
+    pdustatpg.h \
+    mcpstatuspage.h \
+    ocpstatuspage.h \
+    lcpstatuspage.h \
+    lcp20ftstatuspage.h \
+    legendsmenupage.h \
+    nvmcontent.h \
+    powersupply.h \
+    nvmstorgae.h \
+    readout.h \
+    dataload.h \
+    trace.h \
+    panelimage.h \
+    uldstatuspage.h
+
+FORMS += \
+        cdpmainw.ui \
+    swmaintenancew.ui \
+    detailedsystemstatusw.ui \
+    swversionw.ui \
+    contmonsectionoverview.ui \
+    pdustatpg.ui \
+    mcpstatuspage.ui \
+    ocpstatuspage.ui \
+    lcpstatuspage.ui \
+    lcp20ftstatuspage.ui \
+    legendsmenupage.ui \
+    uldstatuspage.ui
+
+RESOURCES += \
+    ui_images.qrc
+
+# Page backgrounds baked at build time into panel sized raw images
+# (panelimage.h), which rcc deflates into the binary. IMAGEBAKE is the host
+# build of tools/imagebake, e.g. qmake IMAGEBAKE=/path/to/imagebake. Without
+# it the pages decode and scale the PNGs of ui_images.qrc at run time.
+BAKED_IMAGES = \
+    PICS/MainPageBkg.png \
+    PICS/SWMaintenancePageBkg.png \
+    PICS/ContMonitringPageBkg.png \
+    PICS/DetailedSysStatusBkg.png \
+    PICS/LegendsMenu.png \
+    PICS/PDUStatusPgBkg.png \
+    PICS/OCPStatusPgBkg.png \
+    PICS/LCPStatusPgBkg.png \
+    PICS/ULDStatusPage.png
+
+isEmpty(IMAGEBAKE): IMAGEBAKE = $$PWD/tools/imagebake/imagebake
+exists($$IMAGEBAKE) {
+    imagebake.input = BAKED_IMAGES
+    imagebake.output = $$OUT_PWD/baked/${QMAKE_FILE_BASE}.cdpi
+    imagebake.commands = $$IMAGEBAKE ${QMAKE_FILE_IN} ${QMAKE_FILE_OUT} 1920 1080
+    imagebake.CONFIG += no_link target_predeps
+    QMAKE_EXTRA_COMPILERS += imagebake
+
+    baked_images.prefix = /images/baked
+    baked_images.base = $$OUT_PWD/baked
+    for(Image, BAKED_IMAGES): baked_images.files += $$OUT_PWD/baked/$$basename(Image)
+    baked_images.files = $$replace(baked_images.files, .png, .cdpi)
+    RESOURCES += baked_images
+} else {
+    warning("imagebake not found, page backgrounds are decoded at run time")
+}
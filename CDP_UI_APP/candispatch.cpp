@@ -0,0 +1,377 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : candispatch.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Table driven dispatch of CAN messages. The (Function ID, Node ID)
+ *                lookup tables are generated at compile time from the registrations
+ *                below, so every message costs two table reads. Qt free, so the
+ *                decode path can be built and exercised on its own.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "candispatch.h"
+#include "lrustore.h"
+#include "nodehealth.h"
+#include "faultevents.h"
+#include "pdutelemetry.h"
+#include "icdsignals.h"
+
+/************************** DECODE HANDLERS *********************************/
+
+static bool DecodeCargoZone(uint8_t Slot, uint64_t Payload){
+    (void)Slot;
+    return lruStore.Store(lruStore.Data.CargoZone, (uint32_t)Payload);
+}
+
+static bool DecodePanelStatus(uint8_t Slot, uint64_t Payload){
+    return lruStore.Store(lruStore.Data.PanelStatus[Slot], Payload);
+}
+
+static bool DecodePanelCommand(uint8_t Slot, uint64_t Payload){
+    return lruStore.Store(lruStore.Data.PanelCommand[Slot], Payload);
+}
+
+static bool DecodeStatusMsg1(uint8_t Slot, uint64_t Payload){
+    return lruStore.Store(lruStore.Data.PDUStatusMSG1[Slot], Payload);
+}
+
+static bool DecodeStatusMsg2(uint8_t Slot, uint64_t Payload){
+    return lruStore.Store(lruStore.Data.PDUStatusMSG2[Slot], Payload);
+}
+
+static bool DecodeStatusMsg3(uint8_t Slot, uint64_t Payload){
+    return lruStore.Store(lruStore.Data.PDUStatusMSG3[Slot], Payload);
+}
+
+static bool DecodePrepareCmd(uint8_t Slot, uint64_t Payload){
+    return lruStore.Store(lruStore.Data.PDUPrepare[Slot], Payload);
+}
+
+static bool DecodeMoveCmd(uint8_t Slot, uint64_t Payload){
+    return lruStore.Store(lruStore.Data.PDUMove[Slot], Payload);
+}
+
+static bool DecodeRetractCmd(uint8_t Slot, uint64_t Payload){
+    return lruStore.Store(lruStore.Data.PDURetract[Slot], Payload);
+}
+
+/*************************** REGISTRATIONS *********************************/
+//New LRUs are added here, the lookup tables follow at compile time
+
+static constexpr NodeRange PanelNodes[] = {
+    {NID_MCP,       1,  PANEL_SLOT_MCP},
+    {NID_OCP,       1,  PANEL_SLOT_OCP},
+    {NID_ICP,       1,  PANEL_SLOT_ICP},
+    {NID_LCP1LH,    4,  PANEL_SLOT_LCP + LCP1LH},   //LCP1LH..LCP4LH
+    {NID_LCP1RH,    4,  PANEL_SLOT_LCP + LCP1RH}};  //LCP1RH..LCP4RH
+
+//Left PDUs fill _PDU[0..58], right PDUs _PDU[59..115]
+static constexpr NodeRange PDUNodes[] = {
+    {0,                 PDUL_MAX_COUNT, 0},
+    {PDUR_COUNT_START,  PDUR_MAX_COUNT, PDUL_MAX_COUNT}};
+
+//One heartbeat and one fault word per node class, the panels send their
+//Command, the PDUs MSG1. A PDU may pack MSG1..MSG3 into one CAN-FD frame.
+//Only the LCPs number their Panel Commands.
+static constexpr MessageRoute Messages[] = {
+    {FID_CARGO_ZONE,    NODE_CLASS_ANY,     DecodeCargoZone,    false,  false,  FID_NONE,         nullptr,             SLOT_INVALID},
+    {FID_PANEL_STATUS,  NODE_CLASS_PANEL,   DecodePanelStatus,  false,  false,  FID_NONE,         nullptr,             SLOT_INVALID},
+    {FID_PANEL_CMD,     NODE_CLASS_PANEL,   DecodePanelCommand, true,   true,   FID_NONE,         nullptr,             PANEL_SLOT_LCP},
+    {FID_STATUS_MSG_1,  NODE_CLASS_PDU,     DecodeStatusMsg1,   true,   true,   FID_STATUS_MSG_2, nullptr,             SLOT_INVALID},
+    {FID_STATUS_MSG_2,  NODE_CLASS_PDU,     DecodeStatusMsg2,   false,  false,  FID_STATUS_MSG_3, TelemetryIngestMSG2, SLOT_INVALID},
+    {FID_STATUS_MSG_3,  NODE_CLASS_PDU,     DecodeStatusMsg3,   false,  false,  FID_NONE,         TelemetryIngestMSG3, SLOT_INVALID},
+    {FID_PREPARE_CMD,   NODE_CLASS_PDU,     DecodePrepareCmd,   false,  false,  FID_NONE,         nullptr,             SLOT_INVALID},
+    {FID_MOVE_CMD,      NODE_CLASS_PDU,     DecodeMoveCmd,      false,  false,  FID_NONE,         nullptr,             SLOT_INVALID},
+    {FID_RETRACT_CMD,   NODE_CLASS_PDU,     DecodeRetractCmd,   false,  false,  FID_NONE,         nullptr,             SLOT_INVALID}};
+
+//First LRU version of every node class, the slot is added on top
+static constexpr uint32_t VersionBase[NODE_CLASS_COUNT] = {
+    LRU_VERSION_COUNT,          //NODE_CLASS_NONE, never dispatched
+    LRU_VERSION_CARGO_ZONE,     //NODE_CLASS_ANY
+    LRU_VERSION_PANEL,          //NODE_CLASS_PANEL
+    LRU_VERSION_PDU};           //NODE_CLASS_PDU
+
+/************************** TABLE GENERATION *********************************/
+
+template <uint32_t N>
+static constexpr void FillNodeClass(NodeSlotTable &Table, uint8_t NodeClass,
+                                    const NodeRange (&Ranges)[N]){
+    for(uint32_t Pos = 0; Pos < N; Pos++){
+        for(uint32_t Node = 0; Node < Ranges[Pos].Count; Node++){
+            Table.Slot[NodeClass][Ranges[Pos].FirstNodeID + Node] =
+                    (uint8_t)(Ranges[Pos].FirstSlot + Node);
+        }
+    }
+}
+
+static constexpr NodeSlotTable BuildNodeSlotTable(){
+    NodeSlotTable Table{};
+
+    for(uint32_t NodeClass = 0; NodeClass < NODE_CLASS_COUNT; NodeClass++){
+        for(uint32_t Node = 0; Node < NID_TABLE_SIZE; Node++){
+            //Messages addressed to any node always land in slot 0
+            Table.Slot[NodeClass][Node] = (NodeClass == NODE_CLASS_ANY) ? 0 : SLOT_INVALID;
+        }
+    }
+    FillNodeClass(Table, NODE_CLASS_PANEL, PanelNodes);
+    FillNodeClass(Table, NODE_CLASS_PDU, PDUNodes);
+    return Table;
+}
+
+static constexpr FunctionTable BuildFunctionTable(){
+    FunctionTable Table{};
+
+    for(uint32_t Pos = 0; Pos < sizeof(Messages) / sizeof(Messages[0]); Pos++){
+        Table.Route[Messages[Pos].FunctionID] = Messages[Pos];
+    }
+    return Table;
+}
+
+static constexpr NodeSlotTable NodeSlots = BuildNodeSlotTable();
+static constexpr FunctionTable Functions = BuildFunctionTable();
+
+static_assert(NodeSlots.Slot[NODE_CLASS_PANEL][NID_LCP4RH] == PANEL_SLOT_LCP + LCP4RH,
+              "LCP RH node IDs must be contiguous");
+static_assert(NodeSlots.Slot[NODE_CLASS_PDU][PDUR_COUNT_START + PDUR_MAX_COUNT - 1] == PDU_MAX_COUNT - 1,
+              "PDU node map must cover _PDU[]");
+static_assert(Functions.Route[FID_STATUS_MSG_1].NodeClass == NODE_CLASS_PDU,
+              "Function table out of step with registrations");
+
+static constexpr bool WordChainsValid(){
+    for(uint32_t Pos = 0; Pos < sizeof(Messages) / sizeof(Messages[0]); Pos++){
+        uint8_t Next = Messages[Pos].NextWord;
+
+        if(Next == FID_NONE){
+            continue;
+        }
+        if((Next >= FID_TABLE_SIZE) || (Functions.Route[Next].NodeClass != Messages[Pos].NodeClass)){
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(WordChainsValid(), "A packed word must belong to the node class of its frame");
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static std::atomic<uint32_t>    LRUChangedPending(0);
+static uint32_t                 LRUChangedBatch = 0;     //Parser thread only
+
+/************************ EXPORTED OPERATION DEFINITIONS *********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Looks up the destination slot and handler of a message
+ *
+ *  Arguments   : Function ID, Node ID, Handler (out), Slot (out)
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool LookupRoute(uint8_t FunctionID, uint8_t NodeID, DecodeHandler *Handler, uint8_t *Slot){
+    const MessageRoute &Route = Functions.Route[FunctionID & (FID_TABLE_SIZE - 1)];
+
+    if(Route.Handler == nullptr){
+        return false;
+    }
+    *Slot = NodeSlots.Slot[Route.NodeClass][NodeID];
+    *Handler = Route.Handler;
+    return (*Slot != SLOT_INVALID);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Decodes one message into the LRU data
+ *
+ *  Arguments   : Function ID, Node ID, Payload, receive time stamp and
+ *                software receive time (CAN_DATA)
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DispatchMessage(uint8_t FunctionID, uint8_t NodeID, uint64_t Payload, uint64_t TimeStamp, uint64_t WallTime){
+    const MessageRoute &Route = Functions.Route[FunctionID & (FID_TABLE_SIZE - 1)];
+    DecodeHandler Handler;
+    uint8_t Slot;
+
+    if(!LookupRoute(FunctionID, NodeID, &Handler, &Slot)){
+        return false;
+    }
+    if(Route.Heartbeat){
+        nodeHealth.Heard(VersionBase[Route.NodeClass] + Slot, TimeStamp);
+    }
+    if(Slot >= Route.SequenceFrom){
+        nodeHealth.Sequence(VersionBase[Route.NodeClass] + Slot, ICD_LCP_Sequence::Value(Payload),
+                            ICD_LCP_Sequence::Modulo);
+    }
+    if(Route.FaultWord){
+        ExtractFaultEvents(VersionBase[Route.NodeClass] + Slot, NodeID, Payload, TimeStamp);
+    }
+    if(Route.Telemetry != nullptr){
+        Route.Telemetry(Slot, Payload, WallTime);
+    }
+    if(Handler(Slot, Payload)){
+        MarkLRUChanged(VersionBase[Route.NodeClass] + Slot);
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Dispatches the messages packed into one frame
+ *
+ *  Arguments   : Function ID of word 0, Node ID, frame payload, receive time
+ *                stamp and software receive time
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DispatchFrame(uint8_t FunctionID, uint8_t NodeID, const PayloadView &Payload, uint64_t TimeStamp,
+                   uint64_t WallTime){
+    uint8_t Words = Payload.GetWordCount();
+    uint8_t Word;
+
+    if(!DispatchMessage(FunctionID, NodeID, Payload.Word(0), TimeStamp, WallTime)){
+        return false;
+    }
+    //The chain can't loop past the frame, it has at most 8 words
+    for(Word = 1; Word < Words; Word++){
+        FunctionID = Functions.Route[FunctionID & (FID_TABLE_SIZE - 1)].NextWord;
+        if(FunctionID == FID_NONE){
+            break;
+        }
+        DispatchMessage(FunctionID, NodeID, Payload.Word(Word), TimeStamp, WallTime);
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Maps an LRU version onto its LRU_CHANGED group
+ *
+ *  Arguments   : LRU version
+ *
+ *  Return Value: LRU_CHANGED group
+ *
+ *-----------------------------------------------------------------------------
+ */
+static uint32_t LRUChangedGroup(uint32_t Version){
+    if(Version == LRU_VERSION_MCP){
+        return LRU_CHANGED_MCP;
+    }
+    else if(Version == LRU_VERSION_OCP){
+        return LRU_CHANGED_OCP;
+    }
+    else if(Version == LRU_VERSION_ICP){
+        return LRU_CHANGED_ICP;
+    }
+    else if(Version < LRU_VERSION_PDU){
+        return LRU_CHANGED_LCP;
+    }
+    else if(Version < LRU_VERSION_ULD){
+        return LRU_CHANGED_PDU;
+    }
+    else if(Version < LRU_VERSION_CARGO_ZONE){
+        return LRU_CHANGED_ULD;
+    }
+    return LRU_CHANGED_CARGO_ZONE;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Bumps the version of one LRU in the same write window as
+ *                its data
+ *
+ *  Arguments   : LRU version
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void MarkLRUChanged(uint32_t Version){
+    if(Version >= LRU_VERSION_COUNT){
+        return;
+    }
+    lruStore.BumpVersion(Version);
+    LRUChangedBatch |= LRUChangedGroup(Version);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Publishes the batch in the LRU store and hands the groups
+ *                it changed over to the UI
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: true when the UI has to be woken up
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool PublishLRUChanges(){
+    uint32_t Pending;
+
+    lruStore.Commit();
+    if(LRUChangedBatch == 0){
+        return false;
+    }
+    Pending = LRUChangedPending.fetch_or(LRUChangedBatch, std::memory_order_acq_rel);
+    LRUChangedBatch = 0;
+    return (Pending == 0);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Takes and clears the groups pending for the UI
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: LRU_CHANGED groups
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t TakeLRUChanges(){
+    return LRUChangedPending.exchange(0, std::memory_order_acq_rel);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Version of one LRU in the UI snapshot. UI thread only.
+ *
+ *  Arguments   : LRU version
+ *
+ *  Return Value: uint32_t
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t GetLRUVersion(uint32_t Version){
+    return GetSnapshotVersion(Version);
+}
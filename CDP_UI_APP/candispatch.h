@@ -0,0 +1,218 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : candispatch.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef CANDISPATCH_H
+#define CANDISPATCH_H
+
+/****************************** HEADER FILES *********************************/
+#include <atomic>
+#include <cstdint>
+#include "lrudata.h"
+#include "signalcodec.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     FID_TABLE_SIZE          64          //6 bit Function Identifier
+#define     NID_TABLE_SIZE          256
+#define     SLOT_INVALID            0xFF
+#define     FID_NONE                0xFF
+
+/********************* ENUMS  *****************************/
+enum NODE_CLASS {NODE_CLASS_NONE = 0,
+                 NODE_CLASS_ANY,
+                 NODE_CLASS_PANEL,
+                 NODE_CLASS_PDU,
+                 NODE_CLASS_COUNT};
+
+enum PANEL_SLOT {PANEL_SLOT_MCP = 0,
+                 PANEL_SLOT_OCP,
+                 PANEL_SLOT_ICP,
+                 PANEL_SLOT_LCP,
+                 PANEL_SLOT_COUNT = PANEL_SLOT_LCP + 8};
+
+//One version counter per LRU, panels use their PANEL_SLOT order
+enum LRU_VERSION {LRU_VERSION_PANEL = 0,
+                  LRU_VERSION_MCP = LRU_VERSION_PANEL + PANEL_SLOT_MCP,
+                  LRU_VERSION_OCP = LRU_VERSION_PANEL + PANEL_SLOT_OCP,
+                  LRU_VERSION_ICP = LRU_VERSION_PANEL + PANEL_SLOT_ICP,
+                  LRU_VERSION_LCP = LRU_VERSION_PANEL + PANEL_SLOT_LCP,
+                  LRU_VERSION_PDU = LRU_VERSION_PANEL + PANEL_SLOT_COUNT,
+                  LRU_VERSION_ULD = LRU_VERSION_PDU + PDU_MAX_COUNT,
+                  LRU_VERSION_CARGO_ZONE = LRU_VERSION_ULD + ULD_MAX_COUNT,
+                  LRU_VERSION_COUNT};
+
+//Groups of LRUs changed since the last display refresh
+enum LRU_CHANGED {LRU_CHANGED_MCP          = 0x01,
+                  LRU_CHANGED_OCP          = 0x02,
+                  LRU_CHANGED_ICP          = 0x04,
+                  LRU_CHANGED_LCP          = 0x08,
+                  LRU_CHANGED_PDU          = 0x10,
+                  LRU_CHANGED_ULD          = 0x20,
+                  LRU_CHANGED_CARGO_ZONE   = 0x40,
+                  LRU_CHANGED_ALL          = 0x7F};
+
+/********************* Structures  *****************************/
+//Returns true when the payload changed the stored LRU data
+typedef bool (*DecodeHandler)(uint8_t Slot, uint64_t Payload);
+
+//Takes the samples of a message into the PDU telemetry store, stamped with the wall time
+typedef void (*TelemetryHandler)(uint8_t Slot, uint64_t Payload, uint64_t WallTime);
+
+/*-----------------------------------------------------------------------------
+ *  Description : A contiguous run of Node IDs mapped onto destination slots
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint8_t     FirstNodeID;
+    uint8_t     Count;
+    uint8_t     FirstSlot;
+}NodeRange;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Decode handler and node class of one Function ID
+ *
+ *                A CAN-FD frame of the Function ID may carry further messages
+ *                of the same node in its following 8 byte words: NextWord is
+ *                the Function ID of word 1, whose own route names word 2, and
+ *                so on. A classic frame only ever has word 0.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint8_t         FunctionID;
+    uint8_t         NodeClass;
+    DecodeHandler   Handler;
+    bool            Heartbeat;      //Sent cyclically by the node itself
+    bool            FaultWord;      //Carries the fault bits of the node
+    uint8_t         NextWord;       //FID_NONE when the frame ends here
+    TelemetryHandler Telemetry;     //nullptr when the message carries no trend data
+    uint8_t         SequenceFrom;   //First slot numbering it with ICD_LCP_Sequence, SLOT_INVALID for none
+}MessageRoute;
+
+typedef struct{
+    uint8_t     Slot[NODE_CLASS_COUNT][NID_TABLE_SIZE];
+}NodeSlotTable;
+
+typedef struct{
+    MessageRoute    Route[FID_TABLE_SIZE];
+}FunctionTable;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Looks up the destination slot and handler of a message.
+ *                Returns false when the (FunctionID, NodeID) pair is not
+ *                registered.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool LookupRoute(uint8_t FunctionID, uint8_t NodeID, DecodeHandler *Handler, uint8_t *Slot);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Decodes one message into the LRU data, stamps the node on
+ *                its heartbeat message and extracts the fault events of its
+ *                fault word. Returns false when the message is not
+ *                registered.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DispatchMessage(uint8_t FunctionID, uint8_t NodeID, uint64_t Payload, uint64_t TimeStamp, uint64_t WallTime);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Dispatches every message packed into one received frame,
+ *                word 0 as FunctionID and the following words along the
+ *                NextWord chain. Returns false when word 0 is not registered.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DispatchFrame(uint8_t FunctionID, uint8_t NodeID, const PayloadView &Payload, uint64_t TimeStamp,
+                   uint64_t WallTime);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Bumps the version of one LRU and records its group for the
+ *                next PublishLRUChanges. Parser thread only.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void MarkLRUChanged(uint32_t Version);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Hands the groups changed by the last batch over to the UI.
+ *                Returns true when the UI has to be woken up, i.e. nothing
+ *                was pending before.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool PublishLRUChanges();
+
+/*-----------------------------------------------------------------------------
+ *  Description : Takes and clears the LRU_CHANGED groups pending for the UI
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t TakeLRUChanges();
+
+uint32_t GetLRUVersion(uint32_t Version);
+
+/*-----------------------------------------------------------------------------
+ *  Description : LRU versions last drawn by one page. Changed() reports
+ *                whether an LRU moved on since the previous call.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class LRUVersionView{
+public:
+    LRUVersionView(){ Invalidate(); }
+
+    bool Changed(uint32_t Version){
+        uint32_t Current = GetLRUVersion(Version);
+
+        if(Current == Seen[Version]){
+            return false;
+        }
+        Seen[Version] = Current;
+        return true;
+    }
+
+    //Forces the next Changed() of every LRU to return true
+    void Invalidate(){
+        for(uint32_t Pos = 0; Pos < LRU_VERSION_COUNT; Pos++){
+            Seen[Pos] = GetLRUVersion(Pos) - 1;
+        }
+    }
+
+private:
+    uint32_t    Seen[LRU_VERSION_COUNT];
+};
+
+#endif // CANDISPATCH_H
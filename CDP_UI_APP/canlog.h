@@ -0,0 +1,101 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : canlog.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef CANLOG_H
+#define CANLOG_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+#include <cstring>
+#include <linux/can.h>
+#include "lrudata.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     CAN_LOG_MAGIC           0x474C4E43      //"CNLG"
+#define     CAN_LOG_VERSION         2           //1 had 8 data bytes per record
+
+/********************* Structures  *****************************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Header at the start of a CAN capture log. The records follow
+ *                back to back up to the end of the file.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint32_t    Magic;
+    uint16_t    Version;
+    uint16_t    RecordSize;
+    uint64_t    StartTime;          //CLOCK_REALTIME of the first frame in ns
+}CAN_LOG_HEADER;
+
+/*-----------------------------------------------------------------------------
+ *  Description : One captured CAN or CAN-FD frame
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint64_t    TimeStamp;          //ns since CAN_LOG_HEADER.StartTime
+    uint32_t    CanID;              //can_id including the EFF/RTR/ERR flags
+    uint8_t     DLC;                //Data length in bytes, up to 64
+    uint8_t     Flags;              //canfd_frame flags, CAN_LOG_FD for a CAN-FD frame
+    uint8_t     Reserved[2];
+    uint8_t     Data[CANFD_MAX_DLEN];
+}CAN_LOG_RECORD;
+
+#define     CAN_LOG_FD              0x80        //Not a kernel CANFD_* flag
+
+static_assert(sizeof(CAN_LOG_RECORD) == 80, "CAN log record layout changed");
+
+/*-----------------------------------------------------------------------------
+ *  Description : Converts a received frame into the parser message, the same
+ *                way for the CAN thread and the capture replay. A capture
+ *                has one clock, it stamps both times.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static inline void FrameToCANData(uint32_t CanID, uint8_t DLC, const uint8_t *Data,
+                                  uint64_t TimeStamp, CAN_DATA *Message){
+    uint8_t Len = (DLC > CANFD_MAX_DLEN) ? CANFD_MAX_DLEN : DLC;
+
+    Message->Frame.can_id = CanID;
+    Message->Frame.len = Len;
+    Message->Frame.flags = 0;
+    memcpy(Message->Frame.data, Data, Len);
+    Message->TimeStamp = TimeStamp;
+    Message->WallTime = TimeStamp;
+}
+
+#endif // CANLOG_H
@@ -0,0 +1,453 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : canreadwrite.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Implementation of CAN RX/TX Thread to recieve signals of all
+ *                LRUs. Implementation of CAN Message queue.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+
+/****************************** HEADER FILES *********************************/
+#include "canreadwrite.h"
+#include "trace.h"
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include<QString>
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+//Function IDs accepted on each socket, the kernel drops everything else
+static const uint8_t PanelFunctionIDs[] = {FID_CARGO_ZONE,
+                                           FID_PANEL_STATUS,
+                                           FID_PANEL_CMD};
+
+static const uint8_t PDUFunctionIDs[]   = {FID_STATUS_MSG_1,
+                                           FID_STATUS_MSG_2,
+                                           FID_STATUS_MSG_3,
+                                           FID_PREPARE_CMD,
+                                           FID_MOVE_CMD,
+                                           FID_RETRACT_CMD};
+
+/*-----------------------------------------------------------------------------
+ *  Description : Returns the monotonic time in ns
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: uint64_t
+ *
+ *-----------------------------------------------------------------------------
+ */
+static uint64_t MonotonicNs(){
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the CAN thread
+ *
+ *  Arguments   : Parent Class
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+CANReadWrite::CANReadWrite(QObject *parent) : QThread(parent)
+{
+    uint16_t Pos;
+
+    EpollFD = -1;
+    for(Pos = 0; Pos < CAN_SOCKET_COUNT; Pos++){
+        sock[Pos] = -1;
+        LastDropCount[Pos] = 0;
+    }
+
+    //The frames land in the ring slots, ReceiveBatch points the iovecs at them
+    memset(RxMsgs, 0, sizeof(RxMsgs));
+    for(Pos = 0; Pos < CAN_RX_BATCH_SIZE; Pos++){
+        RxIov[Pos].iov_base = NULL;
+        RxIov[Pos].iov_len  = sizeof(struct canfd_frame);
+        RxMsgs[Pos].msg_hdr.msg_iov    = &RxIov[Pos];
+        RxMsgs[Pos].msg_hdr.msg_iovlen = 1;
+        RxMsgs[Pos].msg_hdr.msg_control    = RxCmsg[Pos];
+        RxMsgs[Pos].msg_hdr.msg_controllen = CAN_RX_CMSG_SIZE;
+    }
+
+    RxStats.FramesReceived = 0;
+    RxStats.FramesDropped = 0;
+    RxStats.BatchesReceived = 0;
+    RxStats.FramesPerSec = 0;
+    RxStats.MaxBatchSize = 0;
+    RateWindowStart = 0;
+    RateWindowFrames = 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the destructor for the CAN thread
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+CANReadWrite::~CANReadWrite()
+{
+    CloseCANPorts();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens one raw CAN socket on the CAN interface which only
+ *                accepts the given Function IDs. CAN-FD frames, kernel
+ *                timestamps and the receive queue overflow counter are
+ *                enabled on the socket.
+ *
+ *  Arguments   : Function ID table, Table size
+ *
+ *  Return Value: Socket descriptor, -1 on failure
+ *
+ *-----------------------------------------------------------------------------
+ */
+int CANReadWrite::OpenCANPort(const uint8_t *FunctionIDs, uint8_t Count){
+    struct sockaddr_can Addr;
+    struct ifreq ifr;
+    struct can_filter Filter[CAN_RAW_FILTER_MAX];
+    ARBITRATION_FIELD FilterID, FilterMask;
+    const char *Interface = getenv(CAN_INTERFACE_ENV);
+    int Sock, Enable = 1;
+    int TsFlags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+                  SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+    uint8_t Pos;
+
+    if ((Sock = socket(PF_CAN, SOCK_RAW, CAN_RAW)) < 0) {
+            perror("Socket");
+            return -1;
+    }
+
+    //Match on the Function ID bits of the arbitration field only
+    FilterMask.Data = 0;
+    FilterMask.Bits.FuntionIdentifier = 0x3F;
+    for(Pos = 0; Pos < Count; Pos++){
+        FilterID.Data = 0;
+        FilterID.Bits.FuntionIdentifier = FunctionIDs[Pos];
+        Filter[Pos].can_id   = (FilterID.Data & CAN_EFF_MASK) | CAN_EFF_FLAG;
+        Filter[Pos].can_mask = (FilterMask.Data & CAN_EFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    }
+
+    if (setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FILTER, Filter, Count * sizeof(struct can_filter)) < 0) {
+            perror("CAN_RAW_FILTER");
+            close(Sock);
+            return -1;
+    }
+
+    //Classic frames are still delivered, as CAN_MTU sized reads
+    if (setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &Enable, sizeof(Enable)) < 0) {
+            perror("CAN_RAW_FD_FRAMES");
+            close(Sock);
+            return -1;
+    }
+
+    if (setsockopt(Sock, SOL_SOCKET, SO_TIMESTAMPING, &TsFlags, sizeof(TsFlags)) < 0) {
+            perror("SO_TIMESTAMPING");
+    }
+
+    if (setsockopt(Sock, SOL_SOCKET, SO_RXQ_OVFL, &Enable, sizeof(Enable)) < 0) {
+            perror("SO_RXQ_OVFL");
+    }
+
+    memset(&ifr, 0, sizeof(ifr));
+    if(Interface == NULL || Interface[0] == '\0'){
+        Interface = CAN_INTERFACE_NAME;
+    }
+    strncpy(ifr.ifr_name, Interface, IFNAMSIZ - 1);
+    if (ioctl(Sock, SIOCGIFINDEX, &ifr) < 0) {
+            perror("SIOCGIFINDEX");
+            close(Sock);
+            return -1;
+    }
+
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.can_family = AF_CAN;
+    Addr.can_ifindex = ifr.ifr_ifindex;
+
+    if (bind(Sock, (struct sockaddr *)&Addr, sizeof(Addr)) < 0) {
+            perror("Bind");
+            close(Sock);
+            return -1;
+    }
+    return Sock;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens the Panel and PDU sockets and registers them with epoll
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool CANReadWrite::OpenCANPorts(){
+    struct epoll_event Event;
+    uint8_t Pos;
+
+    sock[CAN_SOCKET_PANEL] = OpenCANPort(PanelFunctionIDs, sizeof(PanelFunctionIDs));
+    sock[CAN_SOCKET_PDU]   = OpenCANPort(PDUFunctionIDs, sizeof(PDUFunctionIDs));
+
+    EpollFD = epoll_create1(EPOLL_CLOEXEC);
+    if (EpollFD < 0) {
+            perror("epoll_create1");
+            CloseCANPorts();
+            return false;
+    }
+
+    for(Pos = 0; Pos < CAN_SOCKET_COUNT; Pos++){
+        if(sock[Pos] < 0){
+            CloseCANPorts();
+            return false;
+        }
+        memset(&Event, 0, sizeof(Event));
+        Event.events = EPOLLIN;
+        Event.data.u32 = Pos;
+        if (epoll_ctl(EpollFD, EPOLL_CTL_ADD, sock[Pos], &Event) < 0) {
+                perror("epoll_ctl");
+                CloseCANPorts();
+                return false;
+        }
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Closes the CAN sockets and the epoll instance
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void CANReadWrite::CloseCANPorts(){
+    uint8_t Pos;
+
+    for(Pos = 0; Pos < CAN_SOCKET_COUNT; Pos++){
+        if(sock[Pos] >= 0){
+            close(sock[Pos]);
+            sock[Pos] = -1;
+        }
+    }
+    if(EpollFD >= 0){
+        close(EpollFD);
+        EpollFD = -1;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Reads every pending frame of one socket with a single
+ *                recvmmsg call straight into the free slots of the parser
+ *                ring buffer, stamps them with their kernel timestamp and
+ *                commits them. The call asks for no more frames than there
+ *                are free slots; with the ring full it receives into
+ *                RxSpill and pushes, dropping the oldest records only for
+ *                the frames received.
+ *
+ *  Arguments   : Socket index
+ *
+ *  Return Value: Number of frames received, -1 on error
+ *
+ *-----------------------------------------------------------------------------
+ */
+int CANReadWrite::ReceiveBatch(uint8_t SockInd){
+    struct cmsghdr *Cmsg;
+    struct scm_timestamping *Ts;
+    CAN_DATA *Slot;
+    uint32_t DropCount, Free, Direct, Want;
+    struct timespec Now;
+    int Count, Pos;
+    TRACE_BEGIN(Start);
+
+    //Straight into the free ring slots, into RxSpill only when the ring is full
+    Free = canBuffer.Free();
+    Direct = (Free < CAN_RX_BATCH_SIZE) ? Free : CAN_RX_BATCH_SIZE;
+    Want = (Direct != 0) ? Direct : CAN_RX_BATCH_SIZE;
+    for(Pos = 0; Pos < (int)Want; Pos++){
+        RxSlot[Pos] = (Direct != 0) ? &canBuffer.Reserved(Pos) : &RxSpill[Pos];
+        RxIov[Pos].iov_base = &RxSlot[Pos]->Frame;
+        RxMsgs[Pos].msg_hdr.msg_controllen = CAN_RX_CMSG_SIZE;
+        RxMsgs[Pos].msg_hdr.msg_flags = 0;
+    }
+
+    Count = recvmmsg(sock[SockInd], RxMsgs, Want, MSG_DONTWAIT, NULL);
+    if(Count <= 0){
+        return ((Count < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)) ? -1 : 0;
+    }
+
+    for(Pos = 0; Pos < Count; Pos++){
+        Slot = RxSlot[Pos];
+        Slot->TimeStamp = 0;
+        Slot->WallTime = 0;
+
+        //The slot is committed anyway, the parser skips error frames
+        if((RxMsgs[Pos].msg_len != CAN_MTU) && (RxMsgs[Pos].msg_len != CANFD_MTU)){
+            Slot->Frame.can_id = CAN_ERR_FLAG;
+            Slot->Frame.len = 0;
+            continue;
+        }
+
+        for(Cmsg = CMSG_FIRSTHDR(&RxMsgs[Pos].msg_hdr); Cmsg != NULL;
+            Cmsg = CMSG_NXTHDR(&RxMsgs[Pos].msg_hdr, Cmsg)){
+            if(Cmsg->cmsg_level != SOL_SOCKET){
+                continue;
+            }
+            if(Cmsg->cmsg_type == SO_TIMESTAMPING){
+                //ts[2] is the raw hardware stamp, ts[0] the software one
+                Ts = (struct scm_timestamping *)CMSG_DATA(Cmsg);
+                Slot->WallTime = ((uint64_t)Ts->ts[0].tv_sec * 1000000000ULL) + Ts->ts[0].tv_nsec;
+                if(Ts->ts[2].tv_sec || Ts->ts[2].tv_nsec){
+                    Slot->TimeStamp = ((uint64_t)Ts->ts[2].tv_sec * 1000000000ULL) + Ts->ts[2].tv_nsec;
+                }
+                else {
+                    Slot->TimeStamp = Slot->WallTime;
+                }
+            }
+            else if(Cmsg->cmsg_type == SO_RXQ_OVFL){
+                //Cumulative count of frames dropped by the socket queue
+                memcpy(&DropCount, CMSG_DATA(Cmsg), sizeof(DropCount));
+                if(DropCount != LastDropCount[SockInd]){
+                    RxStats.FramesDropped += (uint32_t)(DropCount - LastDropCount[SockInd]);
+                    TRACE_COUNT(TRACE_RX_DROPPED, DropCount - LastDropCount[SockInd]);
+                    LastDropCount[SockInd] = DropCount;
+                }
+            }
+        }
+        //Without a software stamp the wall time is taken here, late by the batch
+        if(Slot->WallTime == 0){
+            clock_gettime(CLOCK_REALTIME, &Now);
+            Slot->WallTime = ((uint64_t)Now.tv_sec * 1000000000ULL) + Now.tv_nsec;
+        }
+    }
+    if(Direct != 0){
+        canBuffer.Commit(Count);
+    }
+    else{
+        //Drop-oldest, one record per frame actually received
+        for(Pos = 0; Pos < Count; Pos++){
+            canBuffer.Push(RxSpill[Pos]);
+        }
+    }
+
+    RxStats.FramesReceived += Count;
+    RxStats.BatchesReceived++;
+    RateWindowFrames += Count;
+    if((uint32_t)Count > RxStats.MaxBatchSize){
+        RxStats.MaxBatchSize = Count;
+    }
+    TRACE_END(TRACE_SOCKET_READ, Start, Count);
+    return Count;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Recomputes the frames per second figure once per second
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void CANReadWrite::UpdateRateStatistics(){
+    uint64_t Now = MonotonicNs();
+    uint64_t Elapsed = Now - RateWindowStart;
+
+    if(Elapsed >= 1000000000ULL){
+        RxStats.FramesPerSec = (uint32_t)((RateWindowFrames * 1000000000ULL) / Elapsed);
+        RateWindowFrames = 0;
+        RateWindowStart = Now;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the main thread funcationlity of CAN thread. Waits on
+ *                epoll for the CAN sockets, drains each ready socket in
+ *                batches into the ring buffer and wakes the parser thread
+ *                until requestInterruption() is called.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void CANReadWrite::run(){
+    struct epoll_event Events[CAN_SOCKET_COUNT];
+    int Ready, Pos, Count;
+
+    if(!OpenCANPorts()){
+        return;
+    }
+
+    RateWindowStart = MonotonicNs();
+    //Stop requests are seen within CAN_RX_WAIT_MS
+    while(!isInterruptionRequested()){
+        Ready = epoll_wait(EpollFD, Events, CAN_SOCKET_COUNT, CAN_RX_WAIT_MS);
+        if(Ready < 0 && errno != EINTR){
+            perror("epoll_wait");
+            break;
+        }
+
+        for(Pos = 0; Pos < Ready; Pos++){
+            //Keep reading while the socket returns full batches
+            do{
+                Count = ReceiveBatch(Events[Pos].data.u32);
+            }while(Count == CAN_RX_BATCH_SIZE);
+
+            if(Count < 0){
+                perror("recvmmsg");
+            }
+        }
+
+        //Wake the parser once per batch rather than once per frame
+        if(Ready > 0){
+            canBuffer.Notify();
+        }
+
+        UpdateRateStatistics();
+    }
+
+    CloseCANPorts();
+}
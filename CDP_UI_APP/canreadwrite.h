@@ -0,0 +1,125 @@
+
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : canreadwrite.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *            Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef CANREADWRITE_H
+#define CANREADWRITE_H
+
+#include <QObject>
+#include <QThread>
+#include "common.h"
+#include "parser.h"
+
+#include <atomic>
+#include <cstdint>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+
+#include <net/if.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <sys/epoll.h>
+
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
+#include <linux/errqueue.h>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     CAN_INTERFACE_NAME          "can0"
+#define     CAN_INTERFACE_ENV           "CDP_CAN_IF"    //e.g. vcan0 for replay runs
+
+#define     CAN_SOCKET_PANEL            0
+#define     CAN_SOCKET_PDU              1
+#define     CAN_SOCKET_COUNT            2
+
+#define     CAN_RX_BATCH_SIZE           64
+#define     CAN_RX_CMSG_SIZE            (CMSG_SPACE(sizeof(struct scm_timestamping)) + \
+                                         CMSG_SPACE(sizeof(uint32_t)))
+#define     CAN_RX_WAIT_MS              100
+
+/********************* Structures  *****************************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : CAN receive statistics, updated by the CAN thread and read
+ *                by any other thread.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    std::atomic<uint64_t>   FramesReceived;
+    std::atomic<uint64_t>   FramesDropped;      //Kernel receive queue overflows
+    std::atomic<uint64_t>   BatchesReceived;
+    std::atomic<uint32_t>   FramesPerSec;
+    std::atomic<uint32_t>   MaxBatchSize;
+}CAN_RX_STATS;
+
+class CANReadWrite : public QThread
+{
+public:
+    CANReadWrite(QObject *parent=0);
+    ~CANReadWrite();
+    void run();
+
+    uint64_t GetFramesReceived() const  { return RxStats.FramesReceived; }
+    uint64_t GetFramesDropped() const   { return RxStats.FramesDropped; }
+    uint32_t GetFramesPerSec() const    { return RxStats.FramesPerSec; }
+
+private:
+    int  OpenCANPort(const uint8_t *FunctionIDs, uint8_t Count);
+    bool OpenCANPorts();
+    void CloseCANPorts();
+    int  ReceiveBatch(uint8_t SockInd);
+    void UpdateRateStatistics();
+
+    int             sock[CAN_SOCKET_COUNT];
+    int             EpollFD;
+    uint32_t        LastDropCount[CAN_SOCKET_COUNT];
+
+    struct mmsghdr  RxMsgs[CAN_RX_BATCH_SIZE];
+    struct iovec    RxIov[CAN_RX_BATCH_SIZE];     //Point at RxSlot
+    CAN_DATA        *RxSlot[CAN_RX_BATCH_SIZE];   //Free ring slots or RxSpill
+    CAN_DATA        RxSpill[CAN_RX_BATCH_SIZE];   //Receive buffer while the ring is full
+    uint8_t         RxCmsg[CAN_RX_BATCH_SIZE][CAN_RX_CMSG_SIZE];
+
+    CAN_RX_STATS    RxStats;
+    uint64_t        RateWindowStart;
+    uint64_t        RateWindowFrames;
+};
+
+#endif // CANREADWRITE_H
@@ -0,0 +1,218 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : canringbuffer.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef CANRINGBUFFER_H
+#define CANRINGBUFFER_H
+
+/****************************** HEADER FILES *********************************/
+#include <atomic>
+#include <cstdint>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include "lrudata.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     CAN_RING_SIZE           2048        //Must be a power of 2
+#define     CAN_RING_MASK           (CAN_RING_SIZE - 1)
+#define     CACHE_LINE_SIZE         64
+
+/*-----------------------------------------------------------------------------
+ *  Description : Fixed capacity, lock-free single producer / single consumer
+ *                ring of CAN_DATA records between the CAN thread (producer)
+ *                and the parser thread (consumer).
+ *
+ *                Overflow policy is drop-oldest: when the ring is full the
+ *                producer advances the read index past the oldest record and
+ *                counts it in Overflows. The consumer commits its reads with
+ *                a compare-exchange on the same index, so a record that was
+ *                dropped while being copied is never handed out.
+ *
+ *                The CAN thread receives straight into the free slots past
+ *                the write index: Free tells how many there are, the kernel
+ *                writes the frames into Reserved(0..n-1) and Commit publishes
+ *                the n received. Free slots are never read by the consumer,
+ *                so nothing is dropped for frames that do not arrive; a full
+ *                ring falls back to Push, which drops one record per frame.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class CANRingBuffer
+{
+public:
+    CANRingBuffer(){
+        Head.store(0, std::memory_order_relaxed);
+        Tail.store(0, std::memory_order_relaxed);
+        Overflows.store(0, std::memory_order_relaxed);
+        NotifyFD = eventfd(0, EFD_CLOEXEC);
+    }
+
+    ~CANRingBuffer(){
+        if(NotifyFD >= 0){
+            close(NotifyFD);
+        }
+    }
+
+    /*-------------------------------------------------------------------------
+     *  Description : Producer side. Stores one record, dropping the oldest
+     *                record when the ring is full.
+     *------------------------------------------------------------------------*/
+    void Push(const CAN_DATA &Data){
+        uint32_t WrIdx = Head.load(std::memory_order_relaxed);
+        uint32_t RdIdx = Tail.load(std::memory_order_acquire);
+
+        while((WrIdx - RdIdx) >= CAN_RING_SIZE){
+            if(Tail.compare_exchange_weak(RdIdx, RdIdx + 1,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire)){
+                Overflows.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+        }
+
+        Slots[WrIdx & CAN_RING_MASK] = Data;
+        Head.store(WrIdx + 1, std::memory_order_release);
+    }
+
+    /*-------------------------------------------------------------------------
+     *  Description : Producer side. Slots past the write index the consumer
+     *                is done with. Only grows until the next Commit or Push.
+     *------------------------------------------------------------------------*/
+    uint32_t Free() const{
+        return CAN_RING_SIZE - (Head.load(std::memory_order_relaxed) - Tail.load(std::memory_order_acquire));
+    }
+
+    /*-------------------------------------------------------------------------
+     *  Description : Producer side. Slot Offset past the write index, valid
+     *                for Offset below Free().
+     *------------------------------------------------------------------------*/
+    CAN_DATA &Reserved(uint32_t Offset){
+        return Slots[(Head.load(std::memory_order_relaxed) + Offset) & CAN_RING_MASK];
+    }
+
+    /*-------------------------------------------------------------------------
+     *  Description : Producer side. Hands the first Count reserved slots over
+     *                to the consumer.
+     *------------------------------------------------------------------------*/
+    void Commit(uint32_t Count){
+        Head.store(Head.load(std::memory_order_relaxed) + Count, std::memory_order_release);
+    }
+
+    /*-------------------------------------------------------------------------
+     *  Description : Producer side. Wakes the consumer after a batch of Push
+     *                or Commit.
+     *------------------------------------------------------------------------*/
+    void Notify(){
+        uint64_t One = 1;
+        if(write(NotifyFD, &One, sizeof(One)) < 0){
+            /* Counter saturated, consumer is awake anyway */
+        }
+    }
+
+    /*-------------------------------------------------------------------------
+     *  Description : Consumer side. Copies up to MaxCount records into Out and
+     *                returns the number copied.
+     *------------------------------------------------------------------------*/
+    uint32_t PopBatch(CAN_DATA *Out, uint32_t MaxCount){
+        uint32_t RdIdx = Tail.load(std::memory_order_acquire);
+        uint32_t Count, Pos;
+
+        while(1){
+            Count = Head.load(std::memory_order_acquire) - RdIdx;
+            if(Count > MaxCount){
+                Count = MaxCount;
+            }
+            if(Count == 0){
+                return 0;
+            }
+            for(Pos = 0; Pos < Count; Pos++){
+                Out[Pos] = Slots[(RdIdx + Pos) & CAN_RING_MASK];
+            }
+            //Fails only if the producer dropped records under us, re-read then
+            if(Tail.compare_exchange_strong(RdIdx, RdIdx + Count,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire)){
+                return Count;
+            }
+        }
+    }
+
+    /*-------------------------------------------------------------------------
+     *  Description : Consumer side. Blocks until the producer calls Notify.
+     *------------------------------------------------------------------------*/
+    void Wait(){
+        uint64_t Value;
+        if(read(NotifyFD, &Value, sizeof(Value)) < 0){
+            /* Interrupted, caller drains and waits again */
+        }
+    }
+
+    /*-------------------------------------------------------------------------
+     *  Description : Consumer side. As Wait, but returns false once TimeoutMs
+     *                passed without a Notify.
+     *------------------------------------------------------------------------*/
+    bool WaitFor(int TimeoutMs){
+        struct pollfd Fd = {NotifyFD, POLLIN, 0};
+
+        if(poll(&Fd, 1, TimeoutMs) <= 0){
+            return false;
+        }
+        Wait();
+        return true;
+    }
+
+    bool IsEmpty() const {
+        return Head.load(std::memory_order_acquire) == Tail.load(std::memory_order_acquire);
+    }
+
+    uint32_t Size() const {
+        return Head.load(std::memory_order_acquire) - Tail.load(std::memory_order_acquire);
+    }
+
+    uint64_t GetOverflowCount() const {
+        return Overflows.load(std::memory_order_relaxed);
+    }
+
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t>  Head;       //Written by producer
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t>  Tail;       //Written by consumer, and producer on overflow
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t>  Overflows;
+    int                                             NotifyFD;
+    alignas(CACHE_LINE_SIZE) CAN_DATA               Slots[CAN_RING_SIZE];
+};
+
+extern CANRingBuffer canBuffer;
+
+#endif // CANRINGBUFFER_H
@@ -0,0 +1,685 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : cdpmainw.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : The CDP OPSW main display page implementation. This implementation
+ *                provides Display indications for all LRUs (Control Panels, PDUs,
+ *                Access Zones ).It also provides navigation options to Maintenance window.
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "cdpmainw.h"
+#include "ui_cdpmainw.h"
+#include "panelimage.h"
+#include "parser.h"
+#include "displayrefresh.h"
+#include "lrustore.h"
+#include "trace.h"
+#include <QString>
+#include <QTimer>
+#include <QPixmap>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+
+int PDUXCord[116] = {1700,1668,1636,1604,1572,1540,1508,1476,
+                     1444,1412,1380,1348,1316,1284,1252,1220,
+                     1188,1156,1124,1092,1060,1028,996,964,932,
+                     900,868,836,804,772,740,708,676,644,612,
+                     580,548,516,484,452,420,388,356,324,292,260,
+                     228,196,164,132,650,600,550,500,450,400,500,430,400,
+                     1700,1668,1636,1604,1572,1540,1508,1476,
+                      1444,1412,1380,1348,1316,1284,1252,1220,
+                      1188,1156,1124,1092,1060,1028,996,964,932,
+                      900,868,836,804,772,740,708,676,644,612,
+                      580,548,516,484,452,420,388,356,324,292,260,
+                      228,196,164,132,650,600,550,500,450,425,400};
+
+int PDUYCord[116] = {190,190,190,190,190,190,190,190,190,190,190,
+                     190,190,190,190,190,190,190,190,190,190,190,190,
+                     190,190,190,190,190,190,190,190,190,190,190,190,
+                     190,190,190,190,190,190,190,190,190,190,190,190,190,
+                     190,190,230,230,230,230,230,230,150,150,150,330,330,
+                     330,330,330,330,330,330,330,330,330,
+                     330,330,330,330,330,330,330,330,330,330,330,330,330,
+                     330,330,330,330,330,330,330,330,330,330,330,330,330,
+                     330,330,330,330,330,330,330,330,330,330,330,330,330,
+                     280,280,280,280,280,280,280};
+
+static const int LCPXCord[8] = {LCP1LH_IND_X, LCP2LH_IND_X, LCP3LH_IND_X, LCP4LH_IND_X,
+                                LCP1RH_IND_X, LCP2RH_IND_X, LCP3RH_IND_X, LCP4RH_IND_X};
+static const int LCPYCord[8] = {LCP1LH_IND_Y, LCP2LH_IND_Y, LCP3LH_IND_Y, LCP4LH_IND_Y,
+                                LCP1RH_IND_Y, LCP2RH_IND_Y, LCP3RH_IND_Y, LCP4RH_IND_Y};
+
+static int MCPHt = 100;
+static int MCPWt = 70;
+static int ICPHt = 100;
+static int ICPWt = 70;
+static int OCPHt = 70;
+static int OCPWt = 70;
+static int LCPHt = 40;
+static int LCPWt = 75;
+static int PDUHt = 30;
+static int PDUWt = 15;
+
+Current_Page CurrPage;
+Current_Page PrevPage;
+
+QString LCPAmberP[8];
+QString LCPGreenP[8];
+QString LCPGreyP[8];
+QString LCPRdAmP[8];
+QString LCPRdGnP[8];
+
+QString BaseFolder= ":/images/PICS/";
+QString PDUAmberAFP  = BaseFolder +  "AMAF.png";
+QString PDUAmberFWP  = BaseFolder +  "AMFW.png";
+QString PDUAmberINP  = BaseFolder +  "AMIN.png";
+QString PDUAmberOUP  = BaseFolder +  "AMOU.png";
+QString PDUGreenAFP  = BaseFolder +  "GNAF.png";
+QString PDUGreenFWP  = BaseFolder +  "GNFW.png";
+QString PDUGreenINP  = BaseFolder +  "GNIN.png";
+QString PDUGreenOUP  = BaseFolder +  "GNOU.png";
+QString ICPAmberP  = BaseFolder +  "ICPAM.png";
+QString ICPGreenP  = BaseFolder +  "ICPGN.png";
+QString ICPGreyP  = BaseFolder +  "ICPGR.png";
+QString ICPRdAmP  = BaseFolder +  "ICPRA.png";
+QString ICPRdGnP  = BaseFolder +  "ICPRG.png";
+QString MCPAmberP  = BaseFolder +  "MCPAM.png";
+QString MCPGreenP  = BaseFolder +  "MCPGN.png";
+QString MCPGreyP  = BaseFolder +  "MCPGR.png";
+QString MCPRdAmP  = BaseFolder +  "MCPRA.png";
+QString MCPRdGnP  = BaseFolder +  "MCPRG.png";
+QString OCPAmberP  = BaseFolder +  "OCPAM.png";
+QString OCPGreenP  = BaseFolder +  "OCPGN.png";
+QString OCPGreyP  = BaseFolder +  "OCPGR.png";
+QString OCPRdAmP  = BaseFolder +  "OCPRA.png";
+QString OCPRdGnP  = BaseFolder +  "OCPRG.png";
+QString PDUAmberP  = BaseFolder +  "PDUAM.png";
+QString PDUGreenP  = BaseFolder +  "PDUGN.png";
+QString PDUGreyP  = BaseFolder +  "PDUGR.png";
+QString PDURedP  = BaseFolder +  "PDURD.png";
+QString PDUWhAmbP  = BaseFolder +  "PDUWA.png";
+QString PDUWhiteP  = BaseFolder +  "PDUWH.png";
+QString PDUWhRedP  = BaseFolder +  "PDUWR.png";
+
+QString SWMButtonP = BaseFolder +  "SWMButton.png";
+QString LegendsShowP = BaseFolder +  "LegendsButton.png";
+
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the Main window of application
+ *
+ *  Arguments   : Parent Class
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+CDPMAINW::CDPMAINW(QWidget *parent) :
+    QMainWindow(parent),
+    ui(new Ui::CDPMAINW)
+{
+    ui->setupUi(this);
+    CurrPage = SWMAIN;
+    PrevPage = SWMAIN;
+    //Built on their first opening, see HandleSWMButton
+    SWMaintenanceScreen = nullptr;
+    LegendsPage = nullptr;
+
+    //set the main page background
+    SetPageBackground(this, "MainPageBkg.png");
+
+    LCPAmberP[LCP1LH] = BaseFolder + "1LHAM.png";
+    LCPAmberP[LCP2LH] = BaseFolder + "2LHAM.png";
+    LCPAmberP[LCP3LH] = BaseFolder + "3LHAM.png";
+    LCPAmberP[LCP4LH] = BaseFolder + "4LHAM.png";
+    LCPGreenP[LCP1LH] = BaseFolder + "1LHGN.png";
+    LCPGreenP[LCP2LH] = BaseFolder + "2LHGN.png";
+    LCPGreenP[LCP3LH] = BaseFolder + "3LHGN.png";
+    LCPGreenP[LCP4LH] = BaseFolder + "4LHGN.png";
+    LCPGreyP[LCP1LH] = BaseFolder + "1LHGY.png";
+    LCPGreyP[LCP2LH] = BaseFolder + "2LHGY.png";
+    LCPGreyP[LCP3LH] = BaseFolder + "3LHGY.png";
+    LCPGreyP[LCP4LH] = BaseFolder + "4LHGY.png";
+    LCPRdAmP[LCP1LH] = BaseFolder + "1LHRA.png";
+    LCPRdAmP[LCP2LH] = BaseFolder + "2LHRA.png";
+    LCPRdAmP[LCP3LH] = BaseFolder + "3LHRA.png";
+    LCPRdAmP[LCP4LH] = BaseFolder + "4LHRA.png";
+    LCPRdGnP[LCP1LH] = BaseFolder + "1LHRG.png";
+    LCPRdGnP[LCP2LH] = BaseFolder + "2LHRG.png";
+    LCPRdGnP[LCP3LH] = BaseFolder + "3LHRG.png";
+    LCPRdGnP[LCP4LH] = BaseFolder + "4LHRG.png";
+
+    LCPAmberP[LCP1RH] = BaseFolder + "1RHAM.png";
+    LCPAmberP[LCP2RH] = BaseFolder + "2RHAM.png";
+    LCPAmberP[LCP3RH] = BaseFolder + "3RHAM.png";
+    LCPAmberP[LCP4RH] = BaseFolder + "4RHAM.png";
+    LCPGreenP[LCP1RH] = BaseFolder + "1RHGN.png";
+    LCPGreenP[LCP2RH] = BaseFolder + "2RHGN.png";
+    LCPGreenP[LCP3RH] = BaseFolder + "3RHGN.png";
+    LCPGreenP[LCP4RH] = BaseFolder + "4RHGN.png";
+    LCPGreyP[LCP1RH] = BaseFolder + "1RHGY.png";
+    LCPGreyP[LCP2RH] = BaseFolder + "2RHGY.png";
+    LCPGreyP[LCP3RH] = BaseFolder + "3RHGY.png";
+    LCPGreyP[LCP4RH] = BaseFolder + "4RHGY.png";
+    LCPRdAmP[LCP1RH] = BaseFolder + "1RHRA.png";
+    LCPRdAmP[LCP2RH] = BaseFolder + "2RHRA.png";
+    LCPRdAmP[LCP3RH] = BaseFolder + "3RHRA.png";
+    LCPRdAmP[LCP4RH] = BaseFolder + "4RHRA.png";
+    LCPRdGnP[LCP1RH] = BaseFolder + "1RHRG.png";
+    LCPRdGnP[LCP2RH] = BaseFolder + "2RHRG.png";
+    LCPRdGnP[LCP3RH] = BaseFolder + "3RHRG.png";
+    LCPRdGnP[LCP4RH] = BaseFolder + "4RHRG.png";
+
+    // SW Maintenance button
+    SWMButton = new QPushButton("", this);
+    SWMButton->setGeometry(QRect(QPoint(SWN_BTN_X, SWM_BTN_Y), QSize(SWM_BTN_WT, SWM_BTN_HT)));
+    QPixmap SWMButtonBkg(SWMButtonP);
+    QIcon SWMButtonIcon(SWMButtonBkg);
+    SWMButton->setIcon(SWMButtonIcon);
+    SWMButton->setIconSize(SWMButton->rect().size());
+    connect(SWMButton, &QPushButton::released, this, &CDPMAINW::HandleSWMButton);
+
+/*    LegendsShow = new QPushButton("", this);
+    LegendsShow->setGeometry(QRect(QPoint(LEGENDS_BTN_X, LEGENDS_BTN_Y), QSize(LEGENDS_BTN_WT, LEGENDS_BTN_HT)));
+    QPixmap LegendsShowBkg(LegendsShowP);
+    QIcon LegendsShowIcon(LegendsShowBkg);
+    LegendsShow->setIcon(LegendsShowIcon);
+    LegendsShow->setIconSize(LegendsShow->rect().size());
+    connect(LegendsShow, &QPushButton::released, this, &CDPMAINW::HandleLegendsShow);*/
+
+    //Cargo deck, PDUs and panels are painted by one widget
+    Deck = new DeckView(this);
+
+    int Pos;
+    for(Pos = 0; Pos < PDU_MAX_COUNT  ; Pos++){
+            Deck->SetItem(DECK_ITEM_PDU + Pos, QRect(PDUXCord[Pos],PDUYCord[Pos],PDUWt,PDUHt), true, false);
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_GREY_PIX);
+            PDUBlinking[Pos] = FALSE;
+    }
+
+    //MCP
+    Deck->SetItem(DECK_ITEM_MCP, QRect(MCP_IND_X,MCP_IND_Y,MCPWt,MCPHt), false, true);
+    Deck->SetIcon(DECK_ITEM_MCP, MCP_GREY_PIX);
+
+    //ICP
+    Deck->SetItem(DECK_ITEM_ICP, QRect(ICP_IND_X,ICP_IND_Y,ICPWt,ICPHt), false, true);
+    Deck->SetIcon(DECK_ITEM_ICP, ICP_GREY_PIX);
+
+    //OCP
+    Deck->SetItem(DECK_ITEM_OCP, QRect(OCP_IND_X,OCP_IND_Y,OCPWt,OCPHt), false, true);
+    Deck->SetIcon(DECK_ITEM_OCP, OCP_GREY_PIX);
+
+    //LCPs
+    for(Pos = LCP1LH; Pos < 8; Pos++){
+            Deck->SetItem(DECK_ITEM_LCP + Pos, QRect(LCPXCord[Pos],LCPYCord[Pos],LCPWt,LCPHt), false, true);
+            Deck->SetIcon(DECK_ITEM_LCP + Pos, LCP_GREY_PIX(Pos));
+    }
+
+    connect(&displayRefresh, SIGNAL(LRUDataChanged(quint32)), this, SLOT(UpdateUI(quint32)));
+
+    //Blinking indicators run on their own phase, not on the LRU updates
+    BlinkOn = TRUE;
+    BlinkTimer = new QTimer(this);
+    connect(BlinkTimer, SIGNAL(timeout()), this, SLOT(BlinkPDUs()));
+    BlinkTimer->start(PDU_BLINK_PERIOD_MS);
+
+    //Supply voltage out of range, hidden while the level is normal
+    SupplyState = new QLabel(this);
+    SupplyState->setGeometry(QRect(QPoint(SUPPLY_IND_X, SUPPLY_IND_Y), QSize(SUPPLY_IND_WT, SUPPLY_IND_HT)));
+    SupplyState->setAlignment(Qt::AlignLeft | Qt::AlignVCenter);
+    SupplyState->setStyleSheet("color: red; font-weight: bold");
+    SupplyState->hide();
+    connect(&displayRefresh, SIGNAL(SensorLevelChanged(quint32,quint32,qint32)),
+            this, SLOT(HandleSensorLevel(quint32,quint32,qint32)));
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Shows the bus voltage level reported by the power supply
+ *                monitor. Value is in uV, 0 when the sensor failed.
+ *
+ *  Arguments   : Sensor, its new level, sample that crossed the threshold
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void CDPMAINW::HandleSensorLevel(quint32 Sensor, quint32 Level, qint32 Value)
+{
+    QString Volts = QString::number(Value / 1000000.0, 'f', 1);
+
+    if(Sensor != SENSOR_BUS_VOLTAGE){
+        return;
+    }
+    switch(Level){
+    case SENSOR_LEVEL_LOW:
+        SupplyState->setText("Supply voltage low: " + Volts + " V");
+        break;
+    case SENSOR_LEVEL_HIGH:
+        SupplyState->setText("Supply voltage high: " + Volts + " V");
+        break;
+    case SENSOR_LEVEL_FAILED:
+        SupplyState->setText("Supply voltage monitor failed");
+        break;
+    default:
+        SupplyState->hide();
+        return;
+    }
+    SupplyState->show();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function handles the navigation to SW Maintenance Screen
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+void CDPMAINW::HandleSWMButton()
+{
+    CurrPage = SWMAIN;
+    if(SWMaintenanceScreen == nullptr){
+        TRACE_BEGIN(BuildStart);
+        SWMaintenanceScreen = new SWMaintenanceW(this);
+        TRACE_END(TRACE_PAGE_BUILD, BuildStart, MAINT);
+    }
+    SWMaintenanceScreen->show();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function handles the navigation to Legends Menu Screen
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void CDPMAINW::HandleLegendsShow()
+{
+    CurrPage = SWMAIN;
+    if(LegendsPage == nullptr){
+        TRACE_BEGIN(BuildStart);
+        LegendsPage = new LegendsMenuPage(this);
+        TRACE_END(TRACE_PAGE_BUILD, BuildStart, SWMAIN);
+    }
+    LegendsPage->show();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : True when a panel or PDU stopped sending its heartbeat,
+ *                its last reported state is then no longer shown
+ *
+ *  Arguments   : Node (LRU version)
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+ */
+static inline bool NodeSilent(uint32_t Node)
+{
+    return (GetSnapshotNodeState(Node) >= NODE_STATE_STALE);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function updates the indicators of the LRUs changed
+ *                since the last refresh of the CDP MAIN screen
+ *
+ *  Arguments   : LRU_CHANGED groups
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void CDPMAINW::UpdateUI(quint32 ChangedGroups)
+{
+    uint8_t Pos;
+
+    if((ChangedGroups & (LRU_CHANGED_MCP | LRU_CHANGED_OCP | LRU_CHANGED_ICP |
+                         LRU_CHANGED_LCP | LRU_CHANGED_PDU)) == 0){
+        return;
+    }
+
+    // Update Panel Statu
+    if(CurrPage == SWMAIN){
+        if(Versions.Changed(LRU_VERSION_MCP)){
+            if(NodeSilent(LRU_VERSION_MCP) ||
+                    _MCP.Status.Signal.PB_On_Off_LED == DISABLED){
+                //SET MCP To GREY
+                Deck->SetIcon(DECK_ITEM_MCP, MCP_GREY_PIX);
+
+            }
+            else if(_MCP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _MCP.Status.Signal.LED_System_Active == TRUE &&
+                    _MCP.Command.Signal.MCP_Panel_Status == CP_STATE::OP){// &&
+                    //_MCP.Command.Signal.MCP_Switch_Fault_Status == FALSE){
+                //Set Green HAT + Green ICON
+                Deck->SetIcon(DECK_ITEM_MCP, MCP_GREEN_PIX);
+            }
+
+            else if(_MCP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _MCP.Status.Signal.LED_System_Active == TRUE &&
+                    _MCP.Command.Signal.MCP_Panel_Status == CP_STATE::FAIL){// &&
+                    //_MCP.Command.Signal.MCP_Switch_Fault_Status == TRUE){
+                //Set AMber HAT + Amber ICON
+                Deck->SetIcon(DECK_ITEM_MCP, MCP_AMBER_PIX);
+            }
+
+            else if(_MCP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _MCP.Status.Signal.LED_System_Active == TRUE &&
+                    _MCP.Command.Signal.MCP_Panel_Status == CP_STATE::OP &&
+                    //_MCP.Command.Signal.MCP_Switch_Fault_Status == FALSE &&
+                    _MCP.Command.Signal.MCP_PB_PDU_Stop == TRUE){
+                //Set Red HAT + Green ICON
+                Deck->SetIcon(DECK_ITEM_MCP, MCP_RDGN_PIX);
+            }
+
+            else if(_MCP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _MCP.Status.Signal.LED_System_Active == TRUE &&
+                    _MCP.Command.Signal.MCP_Panel_Status == CP_STATE::FAIL &&
+                    //_MCP.Command.Signal.MCP_Switch_Fault_Status == TRUE &&
+                    _MCP.Command.Signal.MCP_PB_PDU_Stop == TRUE){
+                //Set Red HAT + AMBER ICON
+                Deck->SetIcon(DECK_ITEM_MCP, MCP_RDAM_PIX);
+            }
+        }
+
+        if(Versions.Changed(LRU_VERSION_ICP)){
+            if(NodeSilent(LRU_VERSION_ICP) ||
+                    _ICP.Status.Signal.PB_On_Off_LED == DISABLED){
+                //SET ICP To GREY
+                Deck->SetIcon(DECK_ITEM_ICP, ICP_GREY_PIX);
+            }
+            else if(_ICP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _ICP.Status.Signal.LED_System_Active == TRUE &&
+                    _ICP.Command.Signal.ICP_Panel_Status == CP_STATE::OP &&
+                    _ICP.Command.Signal.ICP_Switch_Fault_Status == FALSE){
+                //Set Green HAT + Green ICON
+                Deck->SetIcon(DECK_ITEM_ICP, ICP_GREEN_PIX);
+            }
+
+            else if(_ICP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _ICP.Status.Signal.LED_System_Active == TRUE &&
+                    _ICP.Command.Signal.ICP_Panel_Status == CP_STATE::FAIL &&
+                    _ICP.Command.Signal.ICP_Switch_Fault_Status == TRUE){
+                //Set AMber HAT + Amber ICON
+                Deck->SetIcon(DECK_ITEM_ICP, ICP_AMBER_PIX);
+            }
+
+            else if(_ICP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _ICP.Status.Signal.LED_System_Active == TRUE &&
+                    _ICP.Command.Signal.ICP_Panel_Status == CP_STATE::OP &&
+                    _ICP.Command.Signal.ICP_Switch_Fault_Status == FALSE &&
+                    _ICP.Command.Signal.ICP_PB_PDU_Stop == TRUE){
+                //Set Red HAT + Green ICON
+                Deck->SetIcon(DECK_ITEM_ICP, ICP_RDGN_PIX);
+            }
+
+            else if(_ICP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _ICP.Status.Signal.LED_System_Active == TRUE &&
+                    _ICP.Command.Signal.ICP_Panel_Status == CP_STATE::FAIL &&
+                    _ICP.Command.Signal.ICP_Switch_Fault_Status == TRUE &&
+                    _ICP.Command.Signal.ICP_PB_PDU_Stop == TRUE){
+                //Set Red HAT + AMBER ICON
+                Deck->SetIcon(DECK_ITEM_ICP, ICP_RDAM_PIX);
+            }
+        }
+
+        if(Versions.Changed(LRU_VERSION_OCP)){
+            if(NodeSilent(LRU_VERSION_OCP) ||
+                    _OCP.Status.Signal.PB_On_Off_LED == DISABLED){
+                //SET OCP To GREY
+                Deck->SetIcon(DECK_ITEM_OCP, OCP_GREY_PIX);
+            }
+            else if(_OCP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _OCP.Status.Signal.LED_System_Active == TRUE &&
+                    _OCP.Command.Signal.OCP_Panel_Status == CP_STATE::OP){// &&
+                    //_OCP.Command.Signal.OCP_Switch_Fault_Status == FALSE){
+                //Set Green HAT + Green ICON
+                Deck->SetIcon(DECK_ITEM_OCP, OCP_GREEN_PIX);
+            }
+
+            else if(_OCP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _OCP.Status.Signal.LED_System_Active == TRUE &&
+                    _OCP.Command.Signal.OCP_Panel_Status == CP_STATE::FAIL){// &&
+                //_OCP.Command.Signal.OCP_Switch_Fault_Status == FALSE){
+                //Set AMber HAT + Amber ICON
+                Deck->SetIcon(DECK_ITEM_OCP, OCP_AMBER_PIX);
+            }
+
+            else if(_OCP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _OCP.Status.Signal.LED_System_Active == TRUE &&
+                    _OCP.Command.Signal.OCP_Panel_Status == CP_STATE::OP &&
+                    //_OCP.Command.Signal.OCP_Switch_Fault_Status == FALSE &&
+                    _OCP.Command.Signal.OCP_PB_PDU_Stop == TRUE){
+                //Set Red HAT + Green ICON
+                Deck->SetIcon(DECK_ITEM_OCP, OCP_RDGN_PIX);
+            }
+
+            else if(_OCP.Status.Signal.PB_On_Off_LED == TRUE &&
+                    _OCP.Status.Signal.LED_System_Active == TRUE &&
+                    _OCP.Command.Signal.OCP_Panel_Status == CP_STATE::FAIL &&
+                    //_OCP.Command.Signal.OCP_Switch_Fault_Status == TRUE &&
+                    _OCP.Command.Signal.OCP_PB_PDU_Stop == TRUE){
+                //Set Red HAT + AMBER ICON
+                Deck->SetIcon(DECK_ITEM_OCP, OCP_RDAM_PIX);
+            }
+        }
+
+        for( Pos=LCP1LH ; Pos < 8 ; Pos++){
+            if(!Versions.Changed(LRU_VERSION_LCP + Pos)){
+                continue;
+            }
+            if(NodeSilent(LRU_VERSION_LCP + Pos) ||
+                    (ICD_LCP_Panel_Status::LCP_LED_Panel_Enabled::Value(_LCP[Pos].Status.Data) == FALSE &&
+                     (ICD_LCP_Panel_CMD::LCP_Panel_Status::Value(_LCP[Pos].Command.Data) != CP_STATE::OP ||
+                      ICD_LCP_Panel_CMD::LCP_Panel_Status::Value(_LCP[Pos].Command.Data) != CP_STATE::FAIL))){
+                //SET LCP To GREY
+                Deck->SetIcon(DECK_ITEM_LCP + Pos, LCP_GREY_PIX(Pos));
+            }
+            else if(ICD_LCP_Panel_Status::LCP_LED_Panel_Enabled::Value(_LCP[Pos].Status.Data) == TRUE &&
+                    (ICD_LCP_Panel_CMD::LCP_Switch_Fault_Status::Value(_LCP[Pos].Command.Data) == FALSE &&
+                     ICD_LCP_Panel_CMD::LCP_Panel_Status::Value(_LCP[Pos].Command.Data) == CP_STATE::OP)){
+                //Set Green HAT + Green ICON
+                Deck->SetIcon(DECK_ITEM_LCP + Pos, LCP_GREEN_PIX(Pos));
+            }
+            else if(ICD_LCP_Panel_Status::LCP_LED_Panel_Enabled::Value(_LCP[Pos].Status.Data) == TRUE &&
+                    (ICD_LCP_Panel_CMD::LCP_Switch_Fault_Status::Value(_LCP[Pos].Command.Data) == TRUE &&
+                     ICD_LCP_Panel_CMD::LCP_Panel_Status::Value(_LCP[Pos].Command.Data) == CP_STATE::FAIL)){
+                //Set Amber HAT + Amber ICON
+                Deck->SetIcon(DECK_ITEM_LCP + Pos, LCP_AMBER_PIX(Pos));
+            }
+
+            else if(ICD_LCP_Panel_Status::LCP_LED_Panel_Enabled::Value(_LCP[Pos].Status.Data) == TRUE &&
+                    (ICD_LCP_Panel_CMD::LCP_Switch_Fault_Status::Value(_LCP[Pos].Command.Data) == FALSE &&
+                     ICD_LCP_Panel_CMD::LCP_Panel_Status::Value(_LCP[Pos].Command.Data) == CP_STATE::OP) &&
+                    ICD_LCP_Panel_CMD::LCP_PB_PDU_Stop::Value(_LCP[Pos].Command.Data) == TRUE){
+                //Set Red HAT + Green ICON
+                Deck->SetIcon(DECK_ITEM_LCP + Pos, LCP_RDGN_PIX(Pos));
+            }
+
+            else if(ICD_LCP_Panel_Status::LCP_LED_Panel_Enabled::Value(_LCP[Pos].Status.Data) == TRUE &&
+                    (ICD_LCP_Panel_CMD::LCP_Switch_Fault_Status::Value(_LCP[Pos].Command.Data) == TRUE ||
+                     ICD_LCP_Panel_CMD::LCP_Panel_Status::Value(_LCP[Pos].Command.Data) == CP_STATE::FAIL) &&
+                    ICD_LCP_Panel_CMD::LCP_PB_PDU_Stop::Value(_LCP[Pos].Command.Data) == TRUE){
+                //Set Red HAT + Amber ICON
+                Deck->SetIcon(DECK_ITEM_LCP + Pos, LCP_RDAM_PIX(Pos));
+            }
+        }
+
+        //Update the PDU Status, blinking PDUs are also redrawn by BlinkPDUs
+        for(Pos = 0; Pos < PDU_MAX_COUNT ; Pos++){
+            if(Versions.Changed(LRU_VERSION_PDU + Pos)){
+                UpdatePDU(Pos);
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Draws the indicator of one PDU for the current blink phase
+ *                and records whether the PDU is in a blinking state
+ *
+ *  Arguments   : PDU position
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void CDPMAINW::UpdatePDU(uint8_t Pos)
+{
+    PDUBlinking[Pos] = FALSE;
+    if(NodeSilent(LRU_VERSION_PDU + Pos) ||
+            _PDU[Pos].StatusMSG1.Signal.PDU_Mode == PDU_MODE::OFF_MODE){
+        // Grey Rectangle
+        Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_GREY_PIX);
+
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::HOLD_ACTIVE){
+        // white rectangle
+        Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_WHITE_PIX);
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::RELEASE_ACTIVE){
+        // Green rectangle
+        Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_GREEN_PIX);
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::RELEASE_ACTIVE &&
+            _PDU[Pos].StatusMSG1.Signal.Active_Drive_Command_Direction == PDU_DRIVE_COMMAND_DIR::DIR_A){
+        // Green Right Triangle Blink
+        PDUBlinking[Pos] = TRUE;
+        if(BlinkOn)
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_GRNFW_PIX);
+        else
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_GREY_PIX);
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::RELEASE_ACTIVE &&
+            _PDU[Pos].StatusMSG1.Signal.Active_Drive_Command_Direction == PDU_DRIVE_COMMAND_DIR::DIR_B){
+        // GReenLEFT Triangle Blink
+        PDUBlinking[Pos] = TRUE;
+        if(BlinkOn)
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_GRNAF_PIX);
+        else
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_GREY_PIX);
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::NOT_HEALTHY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::HOLD_ACTIVE){
+        // WHite and amber rectangle
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_WHAMB_PIX);
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::RELEASE_ACTIVE){
+        // amber rectangle
+        Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_AMBER_PIX);
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::RELEASE_ACTIVE &&
+            _PDU[Pos].StatusMSG1.Signal.Active_Drive_Command_Direction == PDU_DRIVE_COMMAND_DIR::DIR_A){
+        // Amber Right Triangle Blink
+        PDUBlinking[Pos] = TRUE;
+        if(BlinkOn)
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_AMBFW_PIX);
+        else
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_GREY_PIX);
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::RELEASE_ACTIVE &&
+            _PDU[Pos].StatusMSG1.Signal.Active_Drive_Command_Direction == PDU_DRIVE_COMMAND_DIR::DIR_B){
+        // Amber LEFT Triangle Blink
+        PDUBlinking[Pos] = TRUE;
+        if(BlinkOn)
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_AMBAF_PIX);
+        else
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_GREY_PIX);
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_State == PDU_STATE::ST_FAULTY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::HOLD_ACTIVE){
+        // WHite and Red rectangle
+        Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_WHRED_PIX);
+    }
+    else if(_PDU[Pos].StatusMSG1.Signal.PDU_State == PDU_STATE::ST_FAULTY &&
+            _PDU[Pos].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::RELEASE_ACTIVE){
+        // Red rectangle
+        Deck->SetIcon(DECK_ITEM_PDU + Pos, PDU_RED_PIX);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Toggles the blink phase on the blink timer and redraws only
+ *                the PDUs shown with a blinking drive direction indicator
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void CDPMAINW::BlinkPDUs()
+{
+    uint8_t Pos;
+
+    BlinkOn = !BlinkOn;
+    if(CurrPage != SWMAIN){
+        return;
+    }
+    for(Pos = 0; Pos < PDU_MAX_COUNT ; Pos++){
+        if(PDUBlinking[Pos]){
+            UpdatePDU(Pos);
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the Destructor function of CDP MAIN Screen
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+CDPMAINW::~CDPMAINW()
+{
+    delete ui;
+}
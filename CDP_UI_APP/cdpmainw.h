@@ -0,0 +1,145 @@
+
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : cdpmainw.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+#ifndef CDPMAINW_H
+#define CDPMAINW_H
+
+#include <QMainWindow>
+#include <QPushButton>
+#include <QLineEdit>
+#include <QLabel>
+#include <QTimer>
+#include "swmaintenancew.h"
+#include "common.h"
+#include "iconmap.h"
+#include "legendsmenupage.h"
+#include "candispatch.h"
+#include "deckview.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define PDU_BLINK_PERIOD_MS 500
+
+#define SWM_BTN_WT          90
+#define SWM_BTN_HT          60
+
+#define SWN_BTN_X           1713
+#define SWM_BTN_Y           913
+
+#define LEGENDS_BTN_WT      90
+#define LEGENDS_BTN_HT      60
+
+#define LEGENDS_BTN_X       70
+#define LEGENDS_BTN_Y       920
+
+#define SUPPLY_IND_WT       420
+#define SUPPLY_IND_HT       40
+
+#define SUPPLY_IND_X        200
+#define SUPPLY_IND_Y        930
+
+#define MCP_IND_X           280
+#define MCP_IND_Y           70
+
+#define ICP_IND_X           280
+#define ICP_IND_Y           390
+
+#define OCP_IND_X           420
+#define OCP_IND_Y           70
+
+#define LCP4LH_IND_X        680
+#define LCP4LH_IND_Y        60
+
+#define LCP3LH_IND_X        880
+#define LCP3LH_IND_Y        60
+
+#define LCP2LH_IND_X        1090
+#define LCP2LH_IND_Y        80
+
+#define LCP1LH_IND_X        1370
+#define LCP1LH_IND_Y        80
+
+#define LCP4RH_IND_X        680
+#define LCP4RH_IND_Y        480
+
+#define LCP3RH_IND_X        880
+#define LCP3RH_IND_Y        480
+
+#define LCP2RH_IND_X        1090
+#define LCP2RH_IND_Y        440
+
+#define LCP1RH_IND_X        1370
+#define LCP1RH_IND_Y        440
+
+
+
+namespace Ui {
+class CDPMAINW;
+}
+
+class CDPMAINW : public QMainWindow
+{
+    Q_OBJECT
+
+public:
+    explicit CDPMAINW(QWidget *parent = 0);
+    ~CDPMAINW();
+
+private slots:
+    void UpdateUI(quint32 ChangedGroups);
+    void HandleSWMButton();
+    void HandleLegendsShow();
+    void BlinkPDUs();
+    void HandleSensorLevel(quint32 Sensor, quint32 Level, qint32 Value);
+
+private:
+    void UpdatePDU(uint8_t Pos);
+
+    Ui::CDPMAINW *ui;
+    QPushButton *SWMButton;
+    QPushButton *LegendsShow;
+    LRUVersionView Versions;
+    DeckView *Deck;
+    QTimer *BlinkTimer;
+    bool BlinkOn;
+    bool PDUBlinking[PDU_MAX_COUNT];
+    QLabel *SupplyState;
+    SWMaintenanceW *SWMaintenanceScreen;
+    LegendsMenuPage *LegendsPage;
+    QLineEdit *line;
+};
+
+#endif // CDPMAINW_H
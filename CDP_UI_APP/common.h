@@ -0,0 +1,86 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : common.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef COMMON_H
+#define COMMON_H
+
+/****************************** HEADER FILES *********************************/
+#include <QString>
+#include <QTimer>
+#include "commondata.h"
+#include "lrudata.h"
+#include "icdsignals.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     PDU_POS_START                   1700
+#define     PDUT_POS_START                  650
+
+#define     ROW0            0
+#define     ROW1            1
+#define     ROW2            2
+#define     ROW3            3
+#define     ROW4            4
+#define     ROW5            5
+#define     ROW6            6
+#define     ROW7            7
+#define     ROW8            8
+#define     ROW9            9
+#define     ROW10           10
+#define     ROW11           11
+#define     ROW12           12
+#define     ROW13           13
+#define     ROW14           14
+#define     ROW15           15
+#define     ROW16           16
+#define     ROW17           17
+#define     ROW18           18
+#define     ROW19           19
+#define     ROW20           20
+
+#define     COLUMN1         1
+#define     COLUMN2         2
+#define     COLUMN3         3
+#define     COLUMN4         4
+
+
+#define     ONE_SEC         1000
+#define     ONE_MS          1
+
+/********************* ENUMS  *****************************/
+enum Current_Page  {SWMAIN, MAINT, DSS, CON_MON, ACC_ZONE, OCP_STATUS, MCP_STATUS, LCP_STATUS, PDU_STATUS};
+
+extern Current_Page CurrPage;
+extern Current_Page PrevPage;
+#endif // COMMON_H
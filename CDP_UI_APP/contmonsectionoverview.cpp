@@ -0,0 +1,177 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : contmonsectionoverview.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : The CDP OPSW Continous Monitoring Page implementation. This implementation
+ *                provides Navigation to all LRU Status Pages (Control Panels, PDUs,
+ *                Access Zones).It also provides navigation options to Maintenance window.
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "contmonsectionoverview.h"
+#include "ui_contmonsectionoverview.h"
+#include "panelimage.h"
+#include "iconmap.h"
+#include "commondata.h"
+#include <QPalette>
+#include <QDebug>
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the continos monitoring window of application
+ *
+ *  Arguments   : Parent Class
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+ContMonSectionOverview::ContMonSectionOverview(QWidget *parent) :
+    QDialog(parent),
+    ui(new Ui::ContMonSectionOverview)
+{
+    int Zone;
+
+    ui->setupUi(this);
+
+    SetPageBackground(this, "ContMonitringPageBkg.png");
+    qDebug() << "SWMaint Page";
+
+
+    BackButton = new QPushButton("", this);
+    BackButton->setGeometry(QRect(QPoint(CON_BK_BTN_X, CON_BK_BTN_Y), QSize(CON_BK_BTN_WT, CON_BK_BTN_HT)));
+    QPixmap BackButtonBkg(BaseFolder +  "BackButton.png");
+    QIcon BackButtonIcon(BackButtonBkg.scaled(CON_BK_BTN_WT, CON_BK_BTN_HT,Qt::KeepAspectRatio));
+    BackButton->setIcon(BackButtonIcon);
+    BackButton->setIconSize(BackButtonBkg.rect().size());
+    connect(BackButton, &QPushButton::released, this, &ContMonSectionOverview::HandleBackButton);
+
+    // Zone buttons of the deck layout, the button id is the zone
+    Layout = GetSectionLayout();
+    ZoneButtons = new QButtonGroup(this);
+    for(Zone = 1; Zone <= Layout->ZoneCount; Zone++){
+        const SectionZone &Entry = Layout->Zones[Zone - 1];
+        QPushButton *ZoneButton = new QPushButton("", this);
+
+        ZoneButton->setGeometry(QRect(QPoint(Entry.X, Entry.Y), QSize(Entry.Width, Entry.Height)));
+        ZoneButtons->addButton(ZoneButton, Zone);
+    }
+    ResetButtonsIcons();
+#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
+    connect(ZoneButtons, SIGNAL(idReleased(int)), this, SLOT(HandleZoneButton(int)));
+#else
+    connect(ZoneButtons, SIGNAL(buttonReleased(int)), this, SLOT(HandleZoneButton(int)));
+#endif
+
+    // One section page shows the selected zone
+    Section = new SectionPage(Layout, this);
+    ui->stackedWidget->addWidget(Section);
+    qDebug() << "SWMaint Page End";
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the Reset functionality of all section button Icons
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ContMonSectionOverview::ResetButtonsIcons() {
+    int Zone;
+
+    for(Zone = 1; Zone <= Layout->ZoneCount; Zone++){
+        SetZoneIcon(Zone, Layout->Zones[Zone - 1].Image);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sets the icon of a zone button
+ *
+ *  Arguments   : Zone, PNG file name
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ContMonSectionOverview::SetZoneIcon(int Zone, const char *Image) {
+    QPixmap ZoneButtonBkg(BaseFolder + Image);
+    QIcon ZoneButtonIcon(ZoneButtonBkg);
+    QAbstractButton *ZoneButton = ZoneButtons->button(Zone);
+
+    ZoneButton->setIcon(ZoneButtonIcon);
+    ZoneButton->setIconSize(ZoneButtonBkg.rect().size());
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Navigation implementation to the Section Page of a zone
+ *
+ *  Arguments   : Zone
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ContMonSectionOverview::HandleZoneButton(int Zone){
+
+    ResetButtonsIcons();
+    SetZoneIcon(Zone, Layout->Zones[Zone - 1].SelectedImage);
+
+    Section->ShowZone(Zone);
+    ui->stackedWidget->setCurrentWidget(Section);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Navigation implementation to SW Maintenance screen
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ContMonSectionOverview::HandleBackButton(){
+    PrevPage = CON_MON;
+    CurrPage = MAINT;
+    ResetButtonsIcons();
+    ui->stackedWidget->setCurrentIndex(INDEX1);
+    hide();
+}
+
+ContMonSectionOverview::~ContMonSectionOverview()
+{
+    delete ui;
+}
@@ -0,0 +1,84 @@
+
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : contmonsectionoverview.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef CONTMONSECTIONOVERVIEW_H
+#define CONTMONSECTIONOVERVIEW_H
+
+#include <QDialog>
+#include <QPushButton>
+#include <QButtonGroup>
+#include "common.h"
+#include "sectionlayout.h"
+#include "sectionpage.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define CON_BK_BTN_WT       80
+#define CON_BK_BTN_HT       80
+#define CON_BK_BTN_X        60
+#define CON_BK_BTN_Y        40
+
+#define INDEX1          1
+
+
+
+namespace Ui {
+class ContMonSectionOverview;
+}
+
+class ContMonSectionOverview : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit ContMonSectionOverview(QWidget *parent = 0);
+    ~ContMonSectionOverview();
+    void ResetButtonsIcons();
+
+private slots:
+    void HandleZoneButton(int Zone);
+    void HandleBackButton();
+
+private:
+    void SetZoneIcon(int Zone, const char *Image);
+
+    Ui::ContMonSectionOverview *ui;
+    const SectionLayout     *Layout;
+    QButtonGroup            *ZoneButtons;
+    QPushButton             *BackButton;
+    SectionPage             *Section;
+};
+
+#endif // CONTMONSECTIONOVERVIEW_H
@@ -0,0 +1,760 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : dataload.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "dataload.h"
+#include "lrudata.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/eventfd.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     DATALOAD_NS_PER_MS          1000000ULL
+#define     DATALOAD_NODE_COUNT         256
+#define     DATALOAD_NONE               0xFF
+#define     DATALOAD_MAX_BLOCKS         ((DATALOAD_MAX_IMAGE_SIZE + DATALOAD_BLOCK_SIZE - 1) / DATALOAD_BLOCK_SIZE)
+
+static_assert(DATALOAD_HEADER_SIZE + DATALOAD_BLOCK_SIZE == CANFD_MAX_DLEN, "A block fills one CAN-FD frame");
+static_assert(DATALOAD_MAX_BLOCKS <= 0xFFFF, "Block number must fit 16 bits");
+static_assert(DATALOAD_MAX_NODES < DATALOAD_NONE, "Session index must fit a byte");
+
+/********************* Structures  *****************************/
+//One panel being loaded. Under Lock.
+typedef struct{
+    uint8_t     NodeID;
+    uint8_t     State;
+    uint8_t     Result;
+    uint8_t     Retries;
+    uint16_t    Base;           //First block not acknowledged
+    uint16_t    Next;           //Next block to send
+    uint32_t    Rewinds;
+    uint64_t    Start;
+    uint64_t    Finish;
+    uint64_t    Deadline;
+}DataloadSession;
+
+typedef struct{
+    uint32_t    Table[256];
+}CRCTable;
+
+/************************** TABLE GENERATION *********************************/
+
+static constexpr CRCTable BuildCRCTable(){
+    CRCTable Table{};
+
+    for(uint32_t Pos = 0; Pos < 256; Pos++){
+        uint32_t Value = Pos;
+        for(uint32_t Bit = 0; Bit < 8; Bit++){
+            Value = (Value & 1) ? (0xEDB88320U ^ (Value >> 1)) : (Value >> 1);
+        }
+        Table.Table[Pos] = Value;
+    }
+    return Table;
+}
+
+static constexpr CRCTable CRC32Table = BuildCRCTable();
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+//Shared with the starting and waiting threads, under Lock
+static std::mutex               Lock;
+static std::condition_variable  TransferDone;
+static DataloadSession          Sessions[DATALOAD_MAX_NODES];
+static uint32_t                 SessionCount = 0;
+static bool                     StartPending = false;
+static bool                     Active = false;
+static const uint8_t           *Image = nullptr;
+static uint32_t                 ImageSize = 0;
+
+//Engine thread only
+static uint32_t                 ImageCRC;
+static uint16_t                 BlockCount;
+static uint32_t                 BlockCRC[DATALOAD_MAX_BLOCKS];
+static uint8_t                  NodeSession[DATALOAD_NODE_COUNT];
+static uint32_t                 RoundRobin = 0;
+static struct canfd_frame       RxFrames[DATALOAD_RX_BATCH_SIZE];
+static struct iovec             RxIov[DATALOAD_RX_BATCH_SIZE];
+static struct mmsghdr           RxMsgs[DATALOAD_RX_BATCH_SIZE];
+static struct canfd_frame       TxFrames[DATALOAD_TX_BATCH_SIZE];
+static struct iovec             TxIov[DATALOAD_TX_BATCH_SIZE];
+static struct mmsghdr           TxMsgs[DATALOAD_TX_BATCH_SIZE];
+static uint32_t                 TxCount = 0;
+
+static std::atomic<bool>        Opened(false);
+static std::atomic<bool>        Running(false);
+static std::thread              Engine;
+static int                      CanFD = -1;
+static int                      WakeFD = -1;
+
+/************************ LOCAL OPERATION DEFINITIONS ***********************/
+
+static uint32_t CRC32(const uint8_t *Data, uint32_t Length){
+    uint32_t Value = 0xFFFFFFFFU;
+
+    while(Length--){
+        Value = CRC32Table.Table[(Value ^ *Data++) & 0xFF] ^ (Value >> 8);
+    }
+    return ~Value;
+}
+
+static uint64_t MonotonicNs(){
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+}
+
+static void WakeEngine(){
+    uint64_t One = 1;
+
+    if(write(WakeFD, &One, sizeof(One)) < 0){
+        /* Counter saturated, the engine is awake anyway */
+    }
+}
+
+static void PutLE(uint8_t *Data, uint32_t Value, uint8_t Bytes){
+    uint8_t Pos;
+
+    for(Pos = 0; Pos < Bytes; Pos++){
+        Data[Pos] = (uint8_t)(Value >> (8 * Pos));
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Queues one frame, sent by FlushTx with the rest of the loop
+ *                iteration in one sendmmsg. Frames longer than 8 bytes go out
+ *                as CAN-FD.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void FlushTx();
+
+static void QueueTx(uint32_t CanID, const uint8_t *Data, uint8_t Length){
+    struct canfd_frame *Frame;
+
+    if(TxCount == DATALOAD_TX_BATCH_SIZE){
+        FlushTx();
+    }
+    Frame = &TxFrames[TxCount];
+    memset(Frame, 0, sizeof(*Frame));
+    Frame->can_id = (CanID & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    Frame->len = Length;
+    memcpy(Frame->data, Data, Length);
+    TxIov[TxCount].iov_len = (Length > CAN_MAX_DLEN) ? CANFD_MTU : CAN_MTU;
+    TxCount++;
+}
+
+static void QueueToNode(uint8_t NodeID, const uint8_t *Data, uint8_t Length){
+    ARBITRATION_FIELD ID;
+
+    ID.Data = 0;
+    ID.Bits.FuntionIdentifier = FID_DATALOAD_DATA;
+    ID.Bits.NodeIdentifier = NodeID;
+    QueueTx(ID.Data, Data, Length);
+}
+
+static void FlushTx(){
+    uint32_t Sent = 0;
+    int Count;
+
+    while(Sent < TxCount){
+        Count = sendmmsg(CanFD, &TxMsgs[Sent], TxCount - Sent, 0);
+        if(Count <= 0){
+            if(Count < 0 && errno == EINTR){
+                continue;
+            }
+            //A full controller queue, the panel reports the gap
+            break;
+        }
+        Sent += Count;
+    }
+    TxCount = 0;
+}
+
+static void SendStart(DataloadSession &Session, uint64_t Now){
+    uint8_t Start[10] = {DATALOAD_FRAME_START, 0};
+
+    PutLE(&Start[2], ImageSize, 4);
+    PutLE(&Start[6], ImageCRC, 4);
+    QueueToNode(Session.NodeID, Start, sizeof(Start));
+    Session.State = DATALOAD_STATE_START;
+    Session.Deadline = Now + DATALOAD_ACK_TIMEOUT_MS * DATALOAD_NS_PER_MS;
+}
+
+static void SendEnd(DataloadSession &Session, uint64_t Now){
+    const uint8_t End[1] = {DATALOAD_FRAME_END};
+
+    QueueToNode(Session.NodeID, End, sizeof(End));
+    Session.State = DATALOAD_STATE_END;
+    Session.Deadline = Now + DATALOAD_ACK_TIMEOUT_MS * DATALOAD_NS_PER_MS;
+}
+
+static void SendBlock(DataloadSession &Session){
+    uint8_t Block[CANFD_MAX_DLEN] = {DATALOAD_FRAME_DATA, 0};
+    uint32_t Offset = (uint32_t)Session.Next * DATALOAD_BLOCK_SIZE;
+    uint32_t Length = ImageSize - Offset;
+
+    if(Length > DATALOAD_BLOCK_SIZE){
+        Length = DATALOAD_BLOCK_SIZE;
+    }
+    PutLE(&Block[2], Session.Next, 2);
+    PutLE(&Block[4], BlockCRC[Session.Next], 4);
+    memcpy(&Block[DATALOAD_HEADER_SIZE], &Image[Offset], Length);
+    //The last block is padded to a full frame, the panel knows its length
+    QueueToNode(Session.NodeID, Block, sizeof(Block));
+    Session.Next++;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Ends the transfer of one panel, and the whole transfer once
+ *                no panel is left loading
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void Finish(DataloadSession &Session, uint8_t Result, uint64_t Now){
+    uint32_t Pos;
+
+    Session.State = (Result == DATALOAD_OK) ? DATALOAD_STATE_DONE : DATALOAD_STATE_FAILED;
+    Session.Result = Result;
+    Session.Finish = Now;
+    for(Pos = 0; Pos < SessionCount; Pos++){
+        if(Sessions[Pos].State < DATALOAD_STATE_DONE){
+            return;
+        }
+    }
+    Active = false;
+    TransferDone.notify_all();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Asks a panel that went quiet where to resume, or fails it
+ *                once its retries are used up
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void Retry(DataloadSession &Session, uint64_t Now){
+    if(Session.Retries >= DATALOAD_RETRIES){
+        Finish(Session, DATALOAD_TIMEOUT, Now);
+        return;
+    }
+    Session.Retries++;
+    if(Session.State == DATALOAD_STATE_END){
+        SendEnd(Session, Now);
+    }
+    else{
+        SendStart(Session, Now);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Handles one FID_DATALOAD_ACK frame
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void HandleFrame(const struct canfd_frame &Frame, uint64_t Now){
+    ARBITRATION_FIELD ID;
+    uint8_t Index;
+    uint16_t Next;
+
+    ID.Data = Frame.can_id & CAN_EFF_MASK;
+    Index = NodeSession[ID.Bits.NodeIdentifier];
+    if((Frame.can_id & (CAN_ERR_FLAG | CAN_RTR_FLAG)) ||
+       (ID.Bits.FuntionIdentifier != FID_DATALOAD_ACK) ||
+       (Index == DATALOAD_NONE) || (Frame.len < 4) || (Frame.data[0] != DATALOAD_FRAME_ACK)){
+        return;
+    }
+    DataloadSession &Session = Sessions[Index];
+    Next = (uint16_t)(Frame.data[2] | (Frame.data[3] << 8));
+    if(Next > BlockCount){
+        return;
+    }
+
+    switch(Frame.data[1]){
+    case DATALOAD_ACK_READY:
+        if(Session.State == DATALOAD_STATE_START){
+            Session.Base = Session.Next = Next;
+            Session.State = DATALOAD_STATE_STREAM;
+            Session.Deadline = Now + DATALOAD_ACK_TIMEOUT_MS * DATALOAD_NS_PER_MS;
+        }
+        break;
+
+    case DATALOAD_ACK_OK:
+        if((Session.State == DATALOAD_STATE_STREAM) && (Next > Session.Base)){
+            Session.Base = Next;
+            if(Session.Next < Next){
+                Session.Next = Next;
+            }
+            Session.Retries = 0;
+            Session.Deadline = Now + DATALOAD_ACK_TIMEOUT_MS * DATALOAD_NS_PER_MS;
+        }
+        break;
+
+    case DATALOAD_ACK_CRC_ERROR:
+    case DATALOAD_ACK_SEQUENCE:
+        if(Session.State != DATALOAD_STATE_STREAM){
+            break;
+        }
+        if(Next > Session.Base){
+            Session.Base = Next;
+            Session.Retries = 0;
+        }
+        else if(Session.Retries++ >= DATALOAD_RETRIES){
+            Finish(Session, DATALOAD_TIMEOUT, Now);
+            break;
+        }
+        //Go back to the block the panel is missing
+        Session.Next = Session.Base;
+        Session.Rewinds++;
+        Session.Deadline = Now + DATALOAD_ACK_TIMEOUT_MS * DATALOAD_NS_PER_MS;
+        break;
+
+    case DATALOAD_ACK_FLASH_ERROR:
+    case DATALOAD_ACK_SIZE_ERROR:
+        if((Session.State >= DATALOAD_STATE_START) && (Session.State <= DATALOAD_STATE_END)){
+            Finish(Session, (Frame.data[1] == DATALOAD_ACK_FLASH_ERROR) ? DATALOAD_FLASH : DATALOAD_REJECTED, Now);
+        }
+        break;
+
+    case DATALOAD_ACK_IMAGE_OK:
+        if(Session.State == DATALOAD_STATE_END){
+            Session.Base = BlockCount;
+            Finish(Session, DATALOAD_OK, Now);
+        }
+        break;
+
+    case DATALOAD_ACK_IMAGE_CRC_ERROR:
+        //The panel dropped the staged image, it is sent again from block 0
+        if(Session.State != DATALOAD_STATE_END){
+            break;
+        }
+        if(Session.Retries++ >= DATALOAD_RETRIES){
+            Finish(Session, DATALOAD_TIMEOUT, Now);
+            break;
+        }
+        Session.Base = Session.Next = 0;
+        SendStart(Session, Now);
+        break;
+
+    default:
+        break;
+    }
+
+    if((Session.State == DATALOAD_STATE_STREAM) && (Session.Base == BlockCount)){
+        SendEnd(Session, Now);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Drains the socket in recvmmsg batches
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void ReceiveFrames(uint64_t Now){
+    int Count, Pos;
+
+    do{
+        for(Pos = 0; Pos < DATALOAD_RX_BATCH_SIZE; Pos++){
+            RxMsgs[Pos].msg_hdr.msg_flags = 0;
+        }
+        Count = recvmmsg(CanFD, RxMsgs, DATALOAD_RX_BATCH_SIZE, MSG_DONTWAIT, NULL);
+        for(Pos = 0; Pos < Count; Pos++){
+            if((RxMsgs[Pos].msg_len == CAN_MTU) || (RxMsgs[Pos].msg_len == CANFD_MTU)){
+                HandleFrame(RxFrames[Pos], Now);
+            }
+        }
+    }while(Count == DATALOAD_RX_BATCH_SIZE);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sets up the sessions of a new transfer, the first Start
+ *                goes out with the next expiry pass
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void BeginTransfer(uint64_t Now){
+    uint32_t Pos, Length;
+
+    ImageCRC = CRC32(Image, ImageSize);
+    BlockCount = (uint16_t)((ImageSize + DATALOAD_BLOCK_SIZE - 1) / DATALOAD_BLOCK_SIZE);
+    for(Pos = 0; Pos < BlockCount; Pos++){
+        Length = ImageSize - Pos * DATALOAD_BLOCK_SIZE;
+        BlockCRC[Pos] = CRC32(&Image[Pos * DATALOAD_BLOCK_SIZE], (Length > DATALOAD_BLOCK_SIZE) ? DATALOAD_BLOCK_SIZE : Length);
+    }
+
+    memset(NodeSession, DATALOAD_NONE, sizeof(NodeSession));
+    for(Pos = 0; Pos < SessionCount; Pos++){
+        NodeSession[Sessions[Pos].NodeID] = (uint8_t)Pos;
+        Sessions[Pos].State = DATALOAD_STATE_ENTRY;
+        Sessions[Pos].Start = Now;
+        Sessions[Pos].Deadline = Now;
+    }
+    StartPending = false;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Handles every session past its deadline
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void ExpireSessions(uint64_t Now){
+    uint32_t Pos;
+
+    for(Pos = 0; Pos < SessionCount; Pos++){
+        DataloadSession &Session = Sessions[Pos];
+
+        if((Session.State == DATALOAD_STATE_IDLE) || (Session.State >= DATALOAD_STATE_DONE) ||
+           (Session.Deadline > Now)){
+            continue;
+        }
+        if(Session.State == DATALOAD_STATE_ENTRY){
+            SendStart(Session, Now);
+        }
+        else{
+            Retry(Session, Now);
+        }
+    }
+}
+
+static bool CanSend(const DataloadSession &Session){
+    return (Session.State == DATALOAD_STATE_STREAM) && (Session.Next < BlockCount) &&
+           (Session.Next < Session.Base + DATALOAD_WINDOW);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Fills the transmit batch with blocks, one panel after the
+ *                other so every panel gets the same share of the bus
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void SendBlocks(){
+    uint32_t Pos;
+    bool Sent = true;
+
+    while(Sent && (TxCount < DATALOAD_TX_BATCH_SIZE)){
+        Sent = false;
+        for(Pos = 0; (Pos < SessionCount) && (TxCount < DATALOAD_TX_BATCH_SIZE); Pos++){
+            DataloadSession &Session = Sessions[(RoundRobin + Pos) % SessionCount];
+            if(CanSend(Session)){
+                SendBlock(Session);
+                Sent = true;
+            }
+        }
+    }
+    RoundRobin++;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Milliseconds until the engine has to run again, 0 while a
+ *                window is open and -1 when no transfer is running
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int NextTimeout(uint64_t Now){
+    uint64_t Earliest = UINT64_MAX;
+    uint32_t Pos;
+
+    std::lock_guard<std::mutex> Guard(Lock);
+    if(StartPending){
+        return 0;
+    }
+    for(Pos = 0; Pos < SessionCount; Pos++){
+        if(CanSend(Sessions[Pos])){
+            return 0;
+        }
+        if((Sessions[Pos].State != DATALOAD_STATE_IDLE) && (Sessions[Pos].State < DATALOAD_STATE_DONE) &&
+           (Sessions[Pos].Deadline < Earliest)){
+            Earliest = Sessions[Pos].Deadline;
+        }
+    }
+    if(Earliest == UINT64_MAX){
+        return -1;
+    }
+    return (Earliest <= Now) ? 0 : (int)((Earliest - Now + DATALOAD_NS_PER_MS - 1) / DATALOAD_NS_PER_MS);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Engine thread. Sleeps on the socket and the wake event while
+ *                every window is full; each pass receives the acknowledges,
+ *                handles timeouts and sends one batch of blocks.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void EngineThread(){
+    struct pollfd Fds[2] = {{CanFD, POLLIN, 0}, {WakeFD, POLLIN, 0}};
+    const uint8_t Abort[1] = {DATALOAD_FRAME_ABORT};
+    uint64_t Now, Value;
+    uint32_t Pos;
+
+    while(Running.load(std::memory_order_acquire)){
+        if(poll(Fds, 2, NextTimeout(MonotonicNs())) > 0 && (Fds[1].revents & POLLIN)){
+            if(read(WakeFD, &Value, sizeof(Value)) < 0){
+                /* Interrupted, the start request is checked anyway */
+            }
+        }
+        Now = MonotonicNs();
+        {
+            std::lock_guard<std::mutex> Guard(Lock);
+            if(StartPending){
+                BeginTransfer(Now);
+            }
+            ReceiveFrames(Now);
+            ExpireSessions(Now);
+            SendBlocks();
+        }
+        FlushTx();
+    }
+
+    Now = MonotonicNs();
+    {
+        std::lock_guard<std::mutex> Guard(Lock);
+        for(Pos = 0; Pos < SessionCount; Pos++){
+            if(Sessions[Pos].State < DATALOAD_STATE_DONE){
+                QueueToNode(Sessions[Pos].NodeID, Abort, sizeof(Abort));
+                Finish(Sessions[Pos], DATALOAD_ABORTED, Now);
+            }
+        }
+        StartPending = false;
+        Active = false;
+    }
+    TransferDone.notify_all();
+    FlushTx();
+}
+
+/************************ EXPORTED OPERATION DEFINITIONS *********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens the dataload socket on a CAN interface
+ *
+ *  Arguments   : Interface name
+ *
+ *  Return Value: false when the socket could not be opened
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DataloadOpen(const char *Interface){
+    struct sockaddr_can Addr;
+    struct can_filter Filter;
+    struct ifreq ifr;
+    ARBITRATION_FIELD FilterID, FilterMask;
+    int Sock, Enable = 1;
+
+    if((Sock = socket(PF_CAN, SOCK_RAW, CAN_RAW)) < 0){
+        return false;
+    }
+
+    FilterMask.Data = 0;
+    FilterMask.Bits.FuntionIdentifier = 0x3F;
+    FilterID.Data = 0;
+    FilterID.Bits.FuntionIdentifier = FID_DATALOAD_ACK;
+    Filter.can_id   = (FilterID.Data & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    Filter.can_mask = (FilterMask.Data & CAN_EFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, Interface, IFNAMSIZ - 1);
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.can_family = AF_CAN;
+    if((setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FILTER, &Filter, sizeof(Filter)) < 0) ||
+       (setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &Enable, sizeof(Enable)) < 0) ||
+       (ioctl(Sock, SIOCGIFINDEX, &ifr) < 0)){
+        close(Sock);
+        return false;
+    }
+    Addr.can_ifindex = ifr.ifr_ifindex;
+    if(bind(Sock, (struct sockaddr *)&Addr, sizeof(Addr)) < 0){
+        close(Sock);
+        return false;
+    }
+    if(!DataloadOpenSocket(Sock)){
+        close(Sock);
+        return false;
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Resets the engine state and starts the engine thread
+ *
+ *  Arguments   : Socket
+ *
+ *  Return Value: false when already open
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DataloadOpenSocket(int Sock){
+    uint32_t Pos;
+
+    if(Opened.load(std::memory_order_acquire)){
+        return false;
+    }
+    WakeFD = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if(WakeFD < 0){
+        return false;
+    }
+    CanFD = Sock;
+
+    //The frame buffers are fixed, so the message headers are set up once
+    memset(RxMsgs, 0, sizeof(RxMsgs));
+    for(Pos = 0; Pos < DATALOAD_RX_BATCH_SIZE; Pos++){
+        RxIov[Pos].iov_base = &RxFrames[Pos];
+        RxIov[Pos].iov_len  = sizeof(struct canfd_frame);
+        RxMsgs[Pos].msg_hdr.msg_iov    = &RxIov[Pos];
+        RxMsgs[Pos].msg_hdr.msg_iovlen = 1;
+    }
+    memset(TxMsgs, 0, sizeof(TxMsgs));
+    for(Pos = 0; Pos < DATALOAD_TX_BATCH_SIZE; Pos++){
+        TxIov[Pos].iov_base = &TxFrames[Pos];
+        TxIov[Pos].iov_len  = CANFD_MTU;
+        TxMsgs[Pos].msg_hdr.msg_iov    = &TxIov[Pos];
+        TxMsgs[Pos].msg_hdr.msg_iovlen = 1;
+    }
+    TxCount = 0;
+    memset(NodeSession, DATALOAD_NONE, sizeof(NodeSession));
+    {
+        std::lock_guard<std::mutex> Guard(Lock);
+        SessionCount = 0;
+        StartPending = false;
+        Active = false;
+    }
+
+    Running.store(true, std::memory_order_release);
+    Opened.store(true, std::memory_order_release);
+    Engine = std::thread(EngineThread);
+    return true;
+}
+
+void DataloadClose(){
+    if(!Opened.exchange(false)){
+        return;
+    }
+    Running.store(false, std::memory_order_release);
+    WakeEngine();
+    Engine.join();
+    close(CanFD);
+    close(WakeFD);
+    CanFD = -1;
+    WakeFD = -1;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Starts loading an image into a set of panels
+ *
+ *  Arguments   : Image, size in bytes, Node IDs of the panels, their count
+ *
+ *  Return Value: false when not started
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DataloadStart(const uint8_t *Data, uint32_t Size, const uint8_t *NodeIDs, uint32_t Count){
+    uint32_t Pos;
+
+    if(!Opened.load(std::memory_order_acquire) || (Data == nullptr) || (Size == 0) ||
+       (Size > DATALOAD_MAX_IMAGE_SIZE) || (Count == 0) || (Count > DATALOAD_MAX_NODES)){
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> Guard(Lock);
+        if(Active){
+            return false;
+        }
+        for(Pos = 0; Pos < Count; Pos++){
+            memset(&Sessions[Pos], 0, sizeof(Sessions[Pos]));
+            Sessions[Pos].NodeID = NodeIDs[Pos];
+        }
+        SessionCount = Count;
+        Image = Data;
+        ImageSize = Size;
+        StartPending = true;
+        Active = true;
+    }
+    WakeEngine();
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Waits for the running transfer to end
+ *
+ *  Arguments   : time to wait in ms
+ *
+ *  Return Value: false while panels are still loading
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DataloadWait(int TimeoutMs){
+    std::unique_lock<std::mutex> Guard(Lock);
+
+    return TransferDone.wait_for(Guard, std::chrono::milliseconds(TimeoutMs), [](){ return !Active; });
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copies the progress of the panels of the last transfer
+ *
+ *  Arguments   : Status (out), its size
+ *
+ *  Return Value: Number of panels copied
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t DataloadGetStatus(DATALOAD_NODE_STATUS *Status, uint32_t MaxCount){
+    uint32_t Pos, Count;
+    uint64_t Now = MonotonicNs();
+
+    std::lock_guard<std::mutex> Guard(Lock);
+    Count = (SessionCount < MaxCount) ? SessionCount : MaxCount;
+    for(Pos = 0; Pos < Count; Pos++){
+        const DataloadSession &Session = Sessions[Pos];
+
+        Status[Pos].NodeID = Session.NodeID;
+        Status[Pos].State = Session.State;
+        Status[Pos].Result = Session.Result;
+        Status[Pos].Retries = Session.Retries;
+        Status[Pos].Acked = Session.Base;
+        Status[Pos].BlockCount = (uint16_t)((ImageSize + DATALOAD_BLOCK_SIZE - 1) / DATALOAD_BLOCK_SIZE);
+        Status[Pos].Rewinds = Session.Rewinds;
+        Status[Pos].DurationNs = (Session.State >= DATALOAD_STATE_DONE) ? (Session.Finish - Session.Start) :
+                                 (Session.Start != 0) ? (Now - Session.Start) : 0;
+    }
+    return Count;
+}
@@ -0,0 +1,184 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : dataload.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef DATALOAD_H
+#define DATALOAD_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     DATALOAD_MAX_NODES          16          //Panels loaded in one transfer
+#define     DATALOAD_MAX_IMAGE_SIZE     0x40000     //Staging area of the LCP (DLD_STAGE_SIZE)
+#define     DATALOAD_BLOCK_SIZE         56          //Image bytes per CAN-FD data frame
+#define     DATALOAD_HEADER_SIZE        8
+#define     DATALOAD_WINDOW             32          //Blocks sent ahead of the last acknowledge
+#define     DATALOAD_ACK_TIMEOUT_MS     250
+#define     DATALOAD_RETRIES            5           //Timeouts or errors in a row before a node fails
+#define     DATALOAD_RX_BATCH_SIZE      64
+#define     DATALOAD_TX_BATCH_SIZE      64
+
+//Data byte 0 of the frames
+#define     DATALOAD_FRAME_START        0x01
+#define     DATALOAD_FRAME_DATA         0x02
+#define     DATALOAD_FRAME_END          0x03
+#define     DATALOAD_FRAME_ABORT        0x04
+#define     DATALOAD_FRAME_ACK          0x81
+
+/********************* ENUMS  *****************************/
+//Acknowledge status, data byte 1 of FID_DATALOAD_ACK
+enum DATALOAD_ACK {DATALOAD_ACK_READY = 0,
+                   DATALOAD_ACK_OK,
+                   DATALOAD_ACK_CRC_ERROR,          //Block CRC failed, resend from Next
+                   DATALOAD_ACK_SEQUENCE,           //Block missing, resend from Next
+                   DATALOAD_ACK_FLASH_ERROR,
+                   DATALOAD_ACK_SIZE_ERROR,
+                   DATALOAD_ACK_IMAGE_OK,
+                   DATALOAD_ACK_IMAGE_CRC_ERROR};
+
+enum DATALOAD_STATE {DATALOAD_STATE_IDLE = 0,
+                     DATALOAD_STATE_ENTRY,          //Start not sent yet
+                     DATALOAD_STATE_START,          //Start sent, waiting for Ready
+                     DATALOAD_STATE_STREAM,
+                     DATALOAD_STATE_END,            //End sent, waiting for the image check
+                     DATALOAD_STATE_DONE,
+                     DATALOAD_STATE_FAILED};
+
+enum DATALOAD_RESULT {DATALOAD_OK = 0,
+                      DATALOAD_TIMEOUT,             //No progress after DATALOAD_RETRIES
+                      DATALOAD_REJECTED,            //Image too large for the node
+                      DATALOAD_FLASH,               //Node could not write its flash
+                      DATALOAD_ABORTED};
+
+/********************* Structures  *****************************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Firmware download to the control panels over CAN-FD, on
+ *                FID_DATALOAD_DATA and FID_DATALOAD_ACK. The NodeID of the
+ *                arbitration field is the panel loaded in both directions.
+ *
+ *                The first Start switches a panel into dataload. It
+ *                receives the image while its application runs and only
+ *                resets once the image is staged and checked. The Dataload
+ *                request ("ABCDEF01") is not sent: it resets a panel into
+ *                its bootloader at once. A panel whose bootloader cannot
+ *                install a staged image does not answer and ends with
+ *                DATALOAD_TIMEOUT; it is loaded through its bootloader.
+ *
+ *                CDP -> panel (FID_DATALOAD_DATA, CAN-FD)
+ *                    Start   : 0x01, 0, image size (32 bit), image CRC-32
+ *                    Data    : 0x02, 0, block (16 bit), block CRC-32, up to
+ *                              56 image bytes
+ *                    End     : 0x03
+ *                    Abort   : 0x04
+ *
+ *                panel -> CDP (FID_DATALOAD_ACK, classic)
+ *                    Ack     : 0x81, DATALOAD_ACK, next block (16 bit)
+ *
+ *                All numbers are LSB first. A panel writes blocks in order
+ *                and acknowledges every 8th; the CDP keeps up to
+ *                DATALOAD_WINDOW blocks in flight per panel and interleaves
+ *                the panels frame by frame. A CRC error or gap is reported
+ *                once and the CDP goes back to the next block the panel
+ *                expects. After a timeout the CDP repeats Start, which a
+ *                panel answers with Ready and the block to resume at.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint8_t     NodeID;
+    uint8_t     State;          //DATALOAD_STATE
+    uint8_t     Result;         //DATALOAD_RESULT once DONE or FAILED
+    uint8_t     Retries;        //In a row
+    uint16_t    Acked;          //Blocks written by the panel
+    uint16_t    BlockCount;
+    uint32_t    Rewinds;        //Errors resent from the acknowledged block
+    uint64_t    DurationNs;     //Start to the image check
+}DATALOAD_NODE_STATUS;
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens a raw CAN socket on the interface for the dataload
+ *                Function IDs and starts the engine thread
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DataloadOpen(const char *Interface);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Starts the engine on a socket that is already set up and
+ *                carries CAN_MTU / CANFD_MTU sized canfd_frame messages. The
+ *                engine closes it in DataloadClose.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DataloadOpenSocket(int Sock);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Stops the engine. Panels still loading are sent Abort and
+ *                end with DATALOAD_ABORTED.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DataloadClose();
+
+/*-----------------------------------------------------------------------------
+ *  Description : Loads Image into the listed panels. The image is not copied
+ *                and must stay valid until DataloadWait returns true. Returns
+ *                false while a transfer is running or when the arguments are
+ *                out of range.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DataloadStart(const uint8_t *Image, uint32_t Size, const uint8_t *NodeIDs, uint32_t Count);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Waits up to TimeoutMs for every panel of the transfer to be
+ *                DONE or FAILED
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DataloadWait(int TimeoutMs);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copies the progress of the panels of the last transfer,
+ *                returns their count
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t DataloadGetStatus(DATALOAD_NODE_STATUS *Status, uint32_t MaxCount);
+
+#endif // DATALOAD_H
@@ -0,0 +1,151 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : deckview.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "deckview.h"
+#include <QPainter>
+#include <QPaintEvent>
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the deck view. The view covers
+ *                the whole parent page, below its buttons, and lets mouse
+ *                events through.
+ *
+ *  Arguments   : Parent page
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+DeckView::DeckView(QWidget *parent) : QWidget(parent)
+{
+    int Item;
+
+    for(Item = 0; Item < DECK_ITEM_COUNT; Item++){
+        Items[Item].Used = false;
+        Items[Item].Framed = false;
+        Items[Item].Scaled = false;
+    }
+
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    if(parent != 0){
+        setGeometry(parent->rect());
+    }
+    lower();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Places one item on the deck
+ *
+ *  Arguments   : DECK_ITEM, Rectangle in page coordinates, Framed, Scaled
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DeckView::SetItem(int Item, const QRect &Rect, bool Framed, bool Scaled)
+{
+    if(Item < 0 || Item >= DECK_ITEM_COUNT){
+        return;
+    }
+    if(Items[Item].Used){
+        update(Items[Item].Rect);
+    }
+    Items[Item].Rect = Rect;
+    Items[Item].Used = true;
+    Items[Item].Framed = Framed;
+    Items[Item].Scaled = Scaled;
+    update(Rect);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Swaps the icon of one item. Nothing is repainted when the
+ *                item already shows that icon.
+ *
+ *  Arguments   : DECK_ITEM, Icon
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DeckView::SetIcon(int Item, const QPixmap &Icon)
+{
+    if(Item < 0 || Item >= DECK_ITEM_COUNT || !Items[Item].Used){
+        return;
+    }
+    if(Items[Item].Icon.cacheKey() == Icon.cacheKey()){
+        return;
+    }
+    Items[Item].Icon = Icon;
+    update(Items[Item].Rect);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Paints the items inside the invalidated region only
+ *
+ *  Arguments   : Paint event
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DeckView::paintEvent(QPaintEvent *Event)
+{
+    QPainter Painter(this);
+    QRect Target;
+    int Item;
+
+    Painter.setPen(palette().color(QPalette::WindowText));
+    for(Item = 0; Item < DECK_ITEM_COUNT; Item++){
+        const DeckItem &Deck = Items[Item];
+
+        if(!Deck.Used || !Event->region().intersects(Deck.Rect)){
+            continue;
+        }
+
+        if(Deck.Scaled){
+            Painter.drawPixmap(Deck.Rect, Deck.Icon);
+        }
+        else{
+            Target = QRect(QPoint(0, 0), Deck.Icon.size());
+            Target.moveCenter(Deck.Rect.center());
+            Painter.drawPixmap(Target.topLeft(), Deck.Icon);
+        }
+
+        if(Deck.Framed){
+            Painter.drawRect(Deck.Rect.adjusted(0, 0, -1, -1));
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : deckview.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef DECKVIEW_H
+#define DECKVIEW_H
+
+/****************************** HEADER FILES *********************************/
+#include <QWidget>
+#include <QPixmap>
+#include <QRect>
+#include "lrudata.h"
+
+/********************* ENUMS  *****************************/
+enum DECK_ITEM {DECK_ITEM_PDU = 0,                          //PDU_MAX_COUNT items
+                DECK_ITEM_MCP = DECK_ITEM_PDU + PDU_MAX_COUNT,
+                DECK_ITEM_ICP,
+                DECK_ITEM_OCP,
+                DECK_ITEM_LCP,                              //8 items, indexed by LCP_NUM
+                DECK_ITEM_COUNT = DECK_ITEM_LCP + 8};
+
+/********************* Structures  *****************************/
+typedef struct{
+    QRect       Rect;
+    QPixmap     Icon;
+    bool        Used;
+    bool        Framed;         //Plain panel frame around the icon
+    bool        Scaled;         //Icon stretched to Rect, else centred
+}DeckItem;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Paints the PDU, panel and ULD indicators of the cargo deck
+ *                in one widget. Pages register the rectangle of every item
+ *                once and then only swap icons; a swap repaints just the
+ *                rectangle of that item.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class DeckView : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit DeckView(QWidget *parent = 0);
+
+    void SetItem(int Item, const QRect &Rect, bool Framed, bool Scaled);
+    void SetIcon(int Item, const QPixmap &Icon);
+
+protected:
+    void paintEvent(QPaintEvent *Event);
+
+private:
+    DeckItem    Items[DECK_ITEM_COUNT];
+};
+
+#endif // DECKVIEW_H
@@ -0,0 +1,245 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : displayrefresh.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "displayrefresh.h"
+#include "candispatch.h"
+#include "lrustore.h"
+#include "trace.h"
+#include <QTimer>
+#include <QWidget>
+#include <QDebug>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+DisplayRefresh       displayRefresh;
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the display refresh
+ *
+ *  Arguments   : Parent Class
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+DisplayRefresh::DisplayRefresh(QObject *parent) : QObject(parent)
+{
+    FirstFramePainted = false;
+    RefreshPending = false;
+    ForcedGroups = 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Schedules a refresh at the end of the current refresh period.
+ *                Requests arriving before it runs share the same refresh.
+ *
+ *  Arguments   : LRU_CHANGED groups to redraw even if their LRUs are unchanged
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DisplayRefresh::RequestRefresh(quint32 ChangedGroups)
+{
+    ForcedGroups |= ChangedGroups;
+    if(!RefreshPending){
+        RefreshPending = true;
+        QTimer::singleShot(DISPLAY_REFRESH_MS, this, SLOT(Refresh()));
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sink of the sensor sampling service. Runs on the sampling
+ *                thread and only queues the event to the GUI thread.
+ *
+ *  Arguments   : Threshold event
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DisplayRefresh::PostSensorEvent(const SensorEvent &Event)
+{
+    quint32 Sensor = Event.Sensor;
+    quint32 Level = Event.Level;
+    qint32 Value = Event.Value;
+
+    QMetaObject::invokeMethod(&displayRefresh, "SensorLevelChanged", Qt::QueuedConnection,
+                              Q_ARG(quint32, Sensor), Q_ARG(quint32, Level), Q_ARG(qint32, Value));
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Woken by the parser thread when a batch changed LRU data
+ *                and no refresh was pending yet
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DisplayRefresh::HandleBatchParsed()
+{
+    RequestRefresh(0);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Page navigation shows or hides a window. The page coming to
+ *                front catches up with the LRUs changed while it was hidden.
+ *                The first paint of a window marks the first frame.
+ *
+ *  Arguments   : Watched object, Event
+ *
+ *  Return Value: false, the event is always passed on
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool DisplayRefresh::eventFilter(QObject *Watched, QEvent *Event)
+{
+    if(!FirstFramePainted && Event->type() == QEvent::Paint &&
+            Watched->isWidgetType() && static_cast<QWidget *>(Watched)->isWindow()){
+        //Taken once the backing store of this paint is flushed to the panel
+        FirstFramePainted = true;
+        QTimer::singleShot(0, this, SLOT(FirstFrame()));
+    }
+    if((Event->type() == QEvent::Show || Event->type() == QEvent::Hide) &&
+            Watched->isWidgetType() && static_cast<QWidget *>(Watched)->isWindow()){
+        RequestRefresh(LRU_CHANGED_ALL);
+    }
+    return false;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Takes a snapshot of the LRU store into the LRU globals and
+ *                emits the groups changed since the previous refresh
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DisplayRefresh::Refresh()
+{
+    quint32 ChangedGroups = TakeLRUChanges() | ForcedGroups;
+
+    RefreshPending = false;
+    ForcedGroups = 0;
+    if(ChangedGroups == 0){
+        return;
+    }
+    TRACE_BEGIN(SnapshotStart);
+    //The parser kept the store busy, keep the groups for the next period
+    if(!lruStore.Snapshot()){
+        TRACE_COUNT(TRACE_REFRESH_DEFERRED, 1);
+        RequestRefresh(ChangedGroups);
+        return;
+    }
+    TRACE_END(TRACE_SNAPSHOT, SnapshotStart, ChangedGroups);
+
+    //The pages update in this call, their connections are direct
+    TRACE_BEGIN(UpdateStart);
+    emit LRUDataChanged(ChangedGroups);
+    TRACE_END(TRACE_WIDGET_UPDATE, UpdateStart, ChangedGroups);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Time since boot at which this process was started, from
+ *                /proc/self/stat (clock ticks)
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: ns on CLOCK_BOOTTIME, 0 when not known
+ *
+ *-----------------------------------------------------------------------------
+ */
+static uint64_t ProcessStartTime()
+{
+    char Stat[1024];
+    unsigned long long StartTicks;
+    const char *Field;
+    size_t Length;
+    int Pos;
+    long TicksPerSec = sysconf(_SC_CLK_TCK);
+    FILE *File = fopen("/proc/self/stat", "r");
+
+    if(File == nullptr){
+        return 0;
+    }
+    Length = fread(Stat, 1, sizeof(Stat) - 1, File);
+    fclose(File);
+    Stat[Length] = '\0';
+    //The command name may hold spaces, count the fields after it. starttime
+    //is field 22, the 20th after the name.
+    Field = strrchr(Stat, ')');
+    for(Pos = 0; Field != nullptr && Pos < 20; Pos++){
+        Field = strchr(Field + 1, ' ');
+    }
+    if(Field == nullptr || TicksPerSec <= 0 || sscanf(Field, "%llu", &StartTicks) != 1){
+        return 0;
+    }
+    return (uint64_t)StartTicks * (1000000000ULL / (uint64_t)TicksPerSec);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Reports the time from the process start and from power on
+ *                to the first frame of the main window. Power on is taken as
+ *                the kernel start (CLOCK_BOOTTIME), the boot loader is not
+ *                included.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DisplayRefresh::FirstFrame()
+{
+    struct timespec Boot;
+    uint64_t BootTime;
+    uint64_t StartTime = ProcessStartTime();
+
+    clock_gettime(CLOCK_BOOTTIME, &Boot);
+    BootTime = ((uint64_t)Boot.tv_sec * 1000000000ULL) + (uint64_t)Boot.tv_nsec;
+    if(StartTime == 0 || StartTime > BootTime){
+        StartTime = BootTime;
+    }
+    TRACE_END(TRACE_FIRST_FRAME, TraceNow() - (BootTime - StartTime), BootTime / 1000000ULL);
+    qDebug() << "First frame" << (BootTime - StartTime) / 1000000ULL << "ms after start,"
+             << BootTime / 1000000ULL << "ms after power on";
+}
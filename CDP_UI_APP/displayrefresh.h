@@ -0,0 +1,93 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : displayrefresh.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef DISPLAYREFRESH_H
+#define DISPLAYREFRESH_H
+
+/****************************** HEADER FILES *********************************/
+#include <QObject>
+#include <QEvent>
+#include "powersupply.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     DISPLAY_REFRESH_MS      16          //~60 Hz panel refresh
+
+/*-----------------------------------------------------------------------------
+ *  Description : Coalesces the LRU changes of the parser batches into at most
+ *                one LRUDataChanged per display refresh period. Pages connect
+ *                to LRUDataChanged instead of polling the LRU data.
+ *
+ *                Also reports the time to the first frame of the main window,
+ *                from the process start and from power on (TRACE_FIRST_FRAME,
+ *                Value is the power on time in ms).
+ *
+ *                Sensor threshold events of the sampling service are handed
+ *                to the GUI thread as SensorLevelChanged.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class DisplayRefresh : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DisplayRefresh(QObject *parent = 0);
+
+    void RequestRefresh(quint32 ChangedGroups);
+    static void PostSensorEvent(const SensorEvent &Event);
+
+signals:
+    void LRUDataChanged(quint32 ChangedGroups);
+    void SensorLevelChanged(quint32 Sensor, quint32 Level, qint32 Value);
+
+public slots:
+    void HandleBatchParsed();
+
+protected:
+    bool eventFilter(QObject *Watched, QEvent *Event);
+
+private slots:
+    void Refresh();
+    void FirstFrame();
+
+private:
+    bool        FirstFramePainted;
+    bool        RefreshPending;
+    quint32     ForcedGroups;
+};
+
+extern DisplayRefresh displayRefresh;
+
+#endif // DISPLAYREFRESH_H
@@ -0,0 +1,234 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : faultevents.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Fault event stage behind the CAN dispatch. The fault word of
+ *                every panel and PDU is XORed with the previous one under a
+ *                constant fault mask, so a frame without a fault change costs one
+ *                compare. Changed bits become raised / cleared events for the
+ *                sinks registered below, and the health of the node is classified
+ *                once per change for the status pages.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "faultevents.h"
+#include "icdsignals.h"
+#include "lrustore.h"
+#include "nvmstorgae.h"
+
+/********************* Structures  *****************************/
+typedef uint8_t (*FaultClassifier)(uint64_t Payload);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Watched bits and classifier of one node. Classify is run
+ *                only when a bit of ClassMask changed.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint8_t     Bit[64];
+}FSIDMap;
+
+typedef struct{
+    uint64_t            FaultMask;
+    uint64_t            ClassMask;
+    FaultClassifier     Classify;
+    FSIDMap             FSID;
+}FaultWatch;
+
+typedef struct{
+    FaultWatch  Node[NODE_HEALTH_COUNT];
+}FaultWatchTable;
+
+/************************** CLASSIFIERS *********************************/
+
+//Same rule as the PDU Status page had per frame
+static uint8_t ClassifyPDU(uint64_t Payload){
+    bool Abnormal = (Payload & ICD_PDU_Status_MSG1::Abnormal::UsedMask()) != 0;
+
+    if((!Abnormal && ICD_PDU_Status_MSG1::PDU_Health_Status::Value(Payload) == PDU_HEALTH_STATUS::NOT_HEALTHY) ||
+       ICD_PDU_Status_MSG1::PDU_State::Value(Payload) == PDU_STATE::ST_FAULTY){
+        return FAULT_CLASS_FAULTY;
+    }
+    return Abnormal ? FAULT_CLASS_ABNORMAL : FAULT_CLASS_NONE;
+}
+
+template <typename Message, typename PanelStatus>
+static uint8_t ClassifyPanel(uint64_t Payload){
+    if(PanelStatus::Value(Payload) == CP_STATE::FAIL){
+        return FAULT_CLASS_FAULTY;
+    }
+    return ((Payload & Message::Faults::UsedMask()) != 0) ? FAULT_CLASS_ABNORMAL : FAULT_CLASS_NONE;
+}
+
+/*************************** REGISTRATIONS *********************************/
+
+//Signals are only appended to a Faults list, so an FSID keeps its meaning between releases
+template <typename Faults>
+static constexpr FSIDMap BuildFSIDMap(uint8_t Base){
+    FSIDMap Map{};
+
+    static_assert(Faults::Count < FSID_CLASS_SIZE, "Fault signals overflow the FSID range of the node class");
+    for(uint8_t Bit = 0; Bit < 64; Bit++){
+        uint8_t Number = Faults::SignalNumber(Bit);
+        Map.Bit[Bit] = (Number != 0) ? (uint8_t)(Base + Number) : 0;
+    }
+    return Map;
+}
+
+static constexpr FaultWatch MCPWatch = {
+    ICD_MCP_Panel_CMD::Faults::UsedMask(),
+    ICD_MCP_Panel_CMD::Faults::UsedMask() | ICD_MCP_Panel_CMD::MCP_Panel_Status::PayloadMask,
+    ClassifyPanel<ICD_MCP_Panel_CMD, ICD_MCP_Panel_CMD::MCP_Panel_Status>,
+    BuildFSIDMap<ICD_MCP_Panel_CMD::Faults>(FSID_BASE_MCP)};
+
+static constexpr FaultWatch OCPWatch = {
+    ICD_OCP_Panel_CMD::Faults::UsedMask(),
+    ICD_OCP_Panel_CMD::Faults::UsedMask() | ICD_OCP_Panel_CMD::OCP_Panel_Status::PayloadMask,
+    ClassifyPanel<ICD_OCP_Panel_CMD, ICD_OCP_Panel_CMD::OCP_Panel_Status>,
+    BuildFSIDMap<ICD_OCP_Panel_CMD::Faults>(FSID_BASE_OCP)};
+
+static constexpr FaultWatch ICPWatch = {
+    ICD_ICP_Panel_CMD::Faults::UsedMask(),
+    ICD_ICP_Panel_CMD::Faults::UsedMask() | ICD_ICP_Panel_CMD::ICP_Panel_Status::PayloadMask,
+    ClassifyPanel<ICD_ICP_Panel_CMD, ICD_ICP_Panel_CMD::ICP_Panel_Status>,
+    BuildFSIDMap<ICD_ICP_Panel_CMD::Faults>(FSID_BASE_ICP)};
+
+static constexpr FaultWatch LCPWatch = {
+    ICD_LCP_Panel_CMD::Faults::UsedMask(),
+    ICD_LCP_Panel_CMD::Faults::UsedMask() | ICD_LCP_Panel_CMD::LCP_Panel_Status::PayloadMask,
+    ClassifyPanel<ICD_LCP_Panel_CMD, ICD_LCP_Panel_CMD::LCP_Panel_Status>,
+    BuildFSIDMap<ICD_LCP_Panel_CMD::Faults>(FSID_BASE_LCP)};
+
+static constexpr FaultWatch PDUWatch = {
+    ICD_PDU_Status_MSG1::Faults::UsedMask(),
+    ICD_PDU_Status_MSG1::Faults::UsedMask() | ICD_PDU_Status_MSG1::PDU_Health_Status::PayloadMask |
+        ICD_PDU_Status_MSG1::PDU_State::PayloadMask,
+    ClassifyPDU,
+    BuildFSIDMap<ICD_PDU_Status_MSG1::Faults>(FSID_BASE_PDU)};
+
+/************************** TABLE GENERATION *********************************/
+
+static constexpr FaultWatchTable BuildFaultWatchTable(){
+    FaultWatchTable Table{};
+
+    Table.Node[LRU_VERSION_MCP] = MCPWatch;
+    Table.Node[LRU_VERSION_OCP] = OCPWatch;
+    Table.Node[LRU_VERSION_ICP] = ICPWatch;
+    for(uint32_t Pos = LRU_VERSION_LCP; Pos < LRU_VERSION_PDU; Pos++){
+        Table.Node[Pos] = LCPWatch;
+    }
+    for(uint32_t Pos = LRU_VERSION_PDU; Pos < NODE_HEALTH_COUNT; Pos++){
+        Table.Node[Pos] = PDUWatch;
+    }
+    return Table;
+}
+
+static constexpr FaultWatchTable Watches = BuildFaultWatchTable();
+
+static_assert(Watches.Node[NODE_HEALTH_COUNT - 1].Classify == ClassifyPDU,
+              "Fault watch table must cover every PDU");
+
+/************************** SINKS *********************************/
+
+static void LogFaultToNVM(const FaultEvent &Event){
+    //The City Code of the LRU is not on the bus, the record keeps the Node ID instead
+    if(Event.Raised){
+        NVMLogFault(Watches.Node[Event.Node].FSID.Bit[Event.Bit], Event.NodeID, 0);
+    }
+}
+
+//Every event goes to each sink in turn, on the parser thread, so sinks must not block
+static constexpr FaultSink Sinks[] = {
+    LogFaultToNVM};
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static uint64_t                 PreviousWord[NODE_HEALTH_COUNT];     //Parser thread only
+static std::atomic<uint32_t>    EventCount(0);
+
+/************************ EXPORTED OPERATION DEFINITIONS *********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Emits the fault events of one fault word and reclassifies
+ *                the node when needed
+ *
+ *  Arguments   : Node (LRU version), Node ID, Payload, receive time stamp
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ExtractFaultEvents(uint32_t Node, uint8_t NodeID, uint64_t Payload, uint64_t TimeStamp){
+    uint64_t Changed, Faults;
+    FaultEvent Event;
+    uint32_t Sink;
+
+    if(Node >= NODE_HEALTH_COUNT){
+        return;
+    }
+    const FaultWatch &Watch = Watches.Node[Node];
+    Changed = Payload ^ PreviousWord[Node];
+    PreviousWord[Node] = Payload;
+    if((Changed & Watch.ClassMask) == 0){
+        return;
+    }
+
+    Event.TimeStamp = TimeStamp;
+    Event.Node = (uint8_t)Node;
+    Event.NodeID = NodeID;
+    Faults = Changed & Watch.FaultMask;
+    while(Faults != 0){
+        Event.Bit = (uint8_t)__builtin_ctzll(Faults);
+        Event.Raised = ((Payload >> Event.Bit) & 1) != 0;
+        for(Sink = 0; Sink < sizeof(Sinks) / sizeof(Sinks[0]); Sink++){
+            Sinks[Sink](Event);
+        }
+        EventCount.fetch_add(1, std::memory_order_relaxed);
+        Faults &= Faults - 1;
+    }
+
+    //Published with the payload, the caller bumps the node version
+    lruStore.Store(lruStore.Data.FaultClass[Node], Watch.Classify(Payload));
+}
+
+uint64_t GetFaultMask(uint32_t Node){
+    return (Node < NODE_HEALTH_COUNT) ? Watches.Node[Node].FaultMask : 0;
+}
+
+uint32_t GetFaultEventCount(){
+    return EventCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,97 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : faultevents.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef FAULTEVENTS_H
+#define FAULTEVENTS_H
+
+/****************************** HEADER FILES *********************************/
+#include <atomic>
+#include <cstdint>
+#include "nodehealth.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+//FSID of a fault bit is the base of its node class plus the position of its
+//signal in the Faults list of the message, from 1. FSID 0 is an unmapped bit.
+#define     FSID_BASE_MCP           0x10
+#define     FSID_BASE_OCP           0x30
+#define     FSID_BASE_ICP           0x50
+#define     FSID_BASE_LCP           0x70
+#define     FSID_BASE_PDU           0x90
+#define     FSID_CLASS_SIZE         0x20
+
+/********************* ENUMS  *****************************/
+//Health of a panel or PDU as shown on the status pages
+enum FAULT_CLASS {FAULT_CLASS_NONE = 0,
+                  FAULT_CLASS_ABNORMAL,
+                  FAULT_CLASS_FAULTY};
+
+/********************* Structures  *****************************/
+/*-----------------------------------------------------------------------------
+ *  Description : One fault bit of a node that was raised or cleared. Bit is
+ *                the position in the fault word of the node, the Panel
+ *                Command of a panel or Status MSG1 of a PDU.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint64_t    TimeStamp;          //Receive time of the frame in ns
+    uint8_t     Node;               //LRU version of the node
+    uint8_t     NodeID;
+    uint8_t     Bit;
+    bool        Raised;
+}FaultEvent;
+
+typedef void (*FaultSink)(const FaultEvent &Event);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Compares the fault word of a node with the previous one,
+ *                emits an event per changed fault bit and classifies the
+ *                node again when a bit it depends on changed. Parser thread
+ *                only.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ExtractFaultEvents(uint32_t Node, uint8_t NodeID, uint64_t Payload, uint64_t TimeStamp);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Mask of the fault bits watched in the fault word of a node
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint64_t GetFaultMask(uint32_t Node);
+
+uint32_t GetFaultEventCount();
+
+#endif // FAULTEVENTS_H
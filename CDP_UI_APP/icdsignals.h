@@ -0,0 +1,617 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : icdsignals.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef ICDSIGNALS_H
+#define ICDSIGNALS_H
+
+/****************************** HEADER FILES *********************************/
+#include "signalcodec.h"
+#include "lrudata.h"
+
+/*
+ *  ICD message descriptions for the signal codec. Every signal is read with
+ *  ICD_<Message>::<Signal>::Value(Payload) and written with ::Set, e.g.
+ *
+ *      ICD_PDU_Status_MSG2::Measured_Current::Value(_PDU[Num].StatusMSG2.Data)
+ *
+ *  The LCP messages are shared with the LCP desktop build.
+ */
+
+/*-----------------------------------------------------------------------------
+ *  Description : LCP Panel Status (CRDC to LCP, LCP_CAN_DATA_RX on the panel)
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_LCP_Panel_Status
+{
+    typedef Signal<0, 3>                    Engineering_Data_1;
+    typedef Signal<3, 1>                    PB_Zone_Stop_LED;
+    typedef Signal<4, 1>                    PB_PDU_Stop;
+    typedef Signal<5, 1>                    LCP_PB_Unlock_Next_LED;
+    typedef Signal<6, 1>                    LCP_PB_Dual_Lane_LED;
+    typedef Signal<7, 1>                    LCP_LED_Panel_Enabled;
+    typedef Signal<8, 8>                    Engineering_Data_2;
+    typedef Signal<16, 16>                  Engineering_Data_3;
+    typedef Signal<32, 32>                  Engineering_Data_4;
+
+    typedef SignalLayout<Engineering_Data_1, PB_Zone_Stop_LED, PB_PDU_Stop,
+                         LCP_PB_Unlock_Next_LED, LCP_PB_Dual_Lane_LED,
+                         LCP_LED_Panel_Enabled, Engineering_Data_2, Engineering_Data_3,
+                         Engineering_Data_4> Layout;
+};
+
+static_assert(ICD_LCP_Panel_Status::Layout::Disjoint(), "ICD_LCP_Panel_Status signals overlap");
+
+/*-----------------------------------------------------------------------------
+ *  Description : LCP Panel Command (LCP to CRDC, LCP_CAN_DATA_TX on the panel)
+ *                Engineering_Data_6 takes the remaining 14 bits, the former
+ *                bitfield declared 16 and spilled past the payload.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_LCP_Panel_CMD
+{
+    typedef Signal<0, 1>                    Engineering_Data_1;
+    typedef Signal<1, 1>                    Engineering_Data_2;
+    typedef Signal<2, 1>                    LCP_PB_Zone_Stop;
+    typedef Signal<3, 1>                    LCP_PB_Unlock_Next;
+    typedef Signal<4, 1>                    LCP_PB_Dual_Lane;
+    typedef Signal<5, 1>                    LCP_TGLS_Drive_AFT;
+    typedef Signal<6, 1>                    LCP_TGLS_Drive_FWD;
+    typedef Signal<7, 1>                    LCP_PB_PDU_Stop;
+    typedef Signal<8, 1>                    Engineering_Data_3;
+    typedef Signal<9, 1>                    Engineering_Data_4;
+    typedef Signal<10, 1>                   LCP_PB_Unlock_Next_Fault;
+    typedef Signal<11, 1>                   LCP_PB_Dual_Lane_Fault;
+    typedef Signal<12, 1>                   NVM_Integrity_Check_Fault;
+    typedef Signal<13, 1>                   NVM_Checksum_Fault;
+    typedef Signal<14, 1>                   PB_Zone_Stop_Fault;
+    typedef Signal<15, 1>                   OPSW_CRC_Fault;
+    typedef Signal<16, 2>                   LCP_Mux_Current_Voltage;
+    typedef Signal<18, 3, CP_STATE>         LCP_Panel_Status;
+    typedef Signal<21, 2>                   LCP_TGLS_Drive_Fault;
+    typedef Signal<23, 1>                   LCP_PB_Lamp_Test_Fault;
+    typedef Signal<24, 8>                   Engineering_Data_5;
+    typedef Signal<32, 16>                  LCP_Measured_Current_Voltage;
+    typedef Signal<48, 1>                   LCP_Switch_Fault_Status;
+    typedef Signal<49, 1>                   LCP_PB_PDU_Stop_Fault;
+    typedef Signal<50, 14>                  Engineering_Data_6;
+
+    typedef SignalLayout<Engineering_Data_1, Engineering_Data_2, LCP_PB_Zone_Stop,
+                         LCP_PB_Unlock_Next, LCP_PB_Dual_Lane, LCP_TGLS_Drive_AFT,
+                         LCP_TGLS_Drive_FWD, LCP_PB_PDU_Stop, Engineering_Data_3,
+                         Engineering_Data_4, LCP_PB_Unlock_Next_Fault,
+                         LCP_PB_Dual_Lane_Fault, NVM_Integrity_Check_Fault,
+                         NVM_Checksum_Fault, PB_Zone_Stop_Fault, OPSW_CRC_Fault,
+                         LCP_Mux_Current_Voltage, LCP_Panel_Status, LCP_TGLS_Drive_Fault,
+                         LCP_PB_Lamp_Test_Fault, Engineering_Data_5,
+                         LCP_Measured_Current_Voltage, LCP_Switch_Fault_Status,
+                         LCP_PB_PDU_Stop_Fault, Engineering_Data_6> Layout;
+
+    //Sent by the LCP as soon as they change (LCP_TxEventMask), the rest goes
+    //out with the next change or heartbeat
+    typedef SignalLayout<LCP_PB_Zone_Stop, LCP_PB_Unlock_Next, LCP_PB_Dual_Lane,
+                         LCP_TGLS_Drive_AFT, LCP_TGLS_Drive_FWD, LCP_PB_PDU_Stop,
+                         LCP_PB_Unlock_Next_Fault, LCP_PB_Dual_Lane_Fault,
+                         NVM_Integrity_Check_Fault, NVM_Checksum_Fault, PB_Zone_Stop_Fault,
+                         OPSW_CRC_Fault, LCP_Panel_Status, LCP_TGLS_Drive_Fault,
+                         LCP_PB_Lamp_Test_Fault, LCP_Switch_Fault_Status,
+                         LCP_PB_PDU_Stop_Fault> Events;
+
+    //Fault and error signals, watched by the fault event stage
+    typedef SignalLayout<LCP_PB_Unlock_Next_Fault, LCP_PB_Dual_Lane_Fault,
+                         NVM_Integrity_Check_Fault, NVM_Checksum_Fault, PB_Zone_Stop_Fault,
+                         OPSW_CRC_Fault, LCP_TGLS_Drive_Fault, LCP_PB_Lamp_Test_Fault,
+                         LCP_Switch_Fault_Status, LCP_PB_PDU_Stop_Fault> Faults;
+};
+
+static_assert(ICD_LCP_Panel_CMD::Layout::Disjoint(), "ICD_LCP_Panel_CMD signals overlap");
+
+/*-----------------------------------------------------------------------------
+ *  Description : LCP schedule report in the Panel Command engineering bits,
+ *                one slot per Panel Command (see SchedulerReportForLCP). Slot 0-4 is
+ *                a task of LCP_SchedTable, FrameSlot the minor frame.
+ *                Counts and times saturate.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_LCP_Schedule_Report
+{
+    static constexpr uint8_t FrameSlot = 7;
+
+    typedef Signal<24, 3>                   Slot;
+    typedef Signal<27, 5>                   Overruns;
+    typedef Signal<50, 14>                  WCET_us;
+
+    typedef SignalLayout<Slot, Overruns, WCET_us> Layout;
+};
+
+static_assert(ICD_LCP_Schedule_Report::Layout::UsedMask() ==
+              (ICD_LCP_Panel_CMD::Engineering_Data_5::PayloadMask |
+               ICD_LCP_Panel_CMD::Engineering_Data_6::PayloadMask),
+              "ICD_LCP_Schedule_Report does not match the engineering bits");
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sequence counter of the LCP Panel Command, split over the
+ *                single engineering bits. It steps once per frame sent, a
+ *                gap at the CRDC means lost frames.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_LCP_Sequence
+{
+    static constexpr uint8_t Modulo = 16;
+
+    typedef Signal<0, 2>                    Low;
+    typedef Signal<8, 2>                    High;
+
+    static constexpr uint8_t Value(uint64_t Payload){
+        return (uint8_t)(Low::Get(Payload) | (High::Get(Payload) << 2));
+    }
+};
+
+static_assert((ICD_LCP_Sequence::Low::PayloadMask | ICD_LCP_Sequence::High::PayloadMask) ==
+              (ICD_LCP_Panel_CMD::Engineering_Data_1::PayloadMask |
+               ICD_LCP_Panel_CMD::Engineering_Data_2::PayloadMask |
+               ICD_LCP_Panel_CMD::Engineering_Data_3::PayloadMask |
+               ICD_LCP_Panel_CMD::Engineering_Data_4::PayloadMask),
+              "ICD_LCP_Sequence does not match the engineering bits");
+
+/*-----------------------------------------------------------------------------
+ *  Description : MCP Panel Command. MCP_Panel_CMD_Data overlays the same bits.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_MCP_Panel_CMD
+{
+    typedef Signal<0, 1>                    MCP_PB_LCP_LH4_3_Enable;
+    typedef Signal<1, 1>                    MCP_PB_LCP_LH2_1_Enable;
+    typedef Signal<2, 1>                    MCP_PB_Zone_Select_FWD;
+    typedef Signal<3, 1>                    MCP_PB_Zone_Select_AFT;
+    typedef Signal<4, 1>                    MCP_PB_Side_Select_Right;
+    typedef Signal<5, 1>                    MCP_PB_Side_Select_Left;
+    typedef Signal<6, 1>                    MCP_PB_PDU_Stop;
+    typedef Signal<7, 1>                    MCP_PB_Power_On_Off;
+    typedef Signal<8, 1>                    MCP_Joystick_OUT;
+    typedef Signal<9, 1>                    MCP_Joystick_IN;
+    typedef Signal<10, 1>                   MCP_Joystick_FWD;
+    typedef Signal<11, 1>                   MCP_Joystick_AFT;
+    typedef Signal<12, 1>                   MCP_PB_20FT;
+    typedef Signal<13, 1>                   MCP_PB_Dual_Operator;
+    typedef Signal<14, 1>                   MCP_PB_LCP_RH4_3_Enable;
+    typedef Signal<15, 1>                   MCP_PB_LCP_RH2_1_Enable;
+    typedef Signal<16, 1>                   NVM_Integrity_Check_Fault;
+    typedef Signal<17, 1>                   NVM_Checksum_Fault;
+    typedef Signal<18, 1>                   Engineering_Data_1;
+    typedef Signal<19, 1>                   OPSW_CRC_Fault;
+    typedef Signal<20, 1>                   MCP_PB_Spin;
+    typedef Signal<21, 1>                   MCP_TGLS_20FT_IN;
+    typedef Signal<22, 1>                   MCP_TGLS_20FT_OUT;
+    typedef Signal<23, 1>                   MCP_Joystick_NEUTRAL;
+    typedef Signal<24, 1>                   MCP_PB_LCP_RH2_1_Enable_Fault;
+    typedef Signal<25, 1>                   MCP_PB_LCP_LH4_3_Enable_Fault;
+    typedef Signal<26, 1>                   MCP_PB_LCP_LH2_1_Enable_Fault;
+    typedef Signal<27, 1>                   MCP_PB_Zone_Select_FWD_Fault;
+    typedef Signal<28, 1>                   MCP_PB_Zone_Select_AFT_Fault;
+    typedef Signal<29, 1>                   MCP_PB_Side_Select_Right_Fault;
+    typedef Signal<30, 1>                   MCP_PB_Side_Select_Left_Fault;
+    typedef Signal<31, 1>                   MCP_PB_Power_On_Off_Fault;
+    typedef Signal<32, 3, CP_STATE>         MCP_Panel_Status;
+    typedef Signal<35, 1>                   MCP_PB_Lamp_Test_Fault;
+    typedef Signal<36, 1>                   MCP_PB_Spin_Fault;
+    typedef Signal<37, 1>                   MCP_PB_20FT_Fault;
+    typedef Signal<38, 1>                   MCP_PB_Dual_Operator_Fault;
+    typedef Signal<39, 1>                   MCP_PB_LCP_RH4_3_Enable_Fault;
+    typedef Signal<40, 2>                   Engineering_Data_2;
+    typedef Signal<42, 2>                   MCP_Mux_Current_Voltage;
+    typedef Signal<44, 2>                   MCP_TGLS_20FT_Fault;
+    typedef Signal<46, 2>                   MCP_Joystick_Fault;
+    typedef Signal<48, 16>                  MCP_Measured_Current_Voltage;
+
+    typedef SignalLayout<MCP_PB_LCP_LH4_3_Enable, MCP_PB_LCP_LH2_1_Enable,
+                         MCP_PB_Zone_Select_FWD, MCP_PB_Zone_Select_AFT,
+                         MCP_PB_Side_Select_Right, MCP_PB_Side_Select_Left, MCP_PB_PDU_Stop,
+                         MCP_PB_Power_On_Off, MCP_Joystick_OUT, MCP_Joystick_IN,
+                         MCP_Joystick_FWD, MCP_Joystick_AFT, MCP_PB_20FT,
+                         MCP_PB_Dual_Operator, MCP_PB_LCP_RH4_3_Enable,
+                         MCP_PB_LCP_RH2_1_Enable, NVM_Integrity_Check_Fault,
+                         NVM_Checksum_Fault, Engineering_Data_1, OPSW_CRC_Fault,
+                         MCP_PB_Spin, MCP_TGLS_20FT_IN, MCP_TGLS_20FT_OUT,
+                         MCP_Joystick_NEUTRAL, MCP_PB_LCP_RH2_1_Enable_Fault,
+                         MCP_PB_LCP_LH4_3_Enable_Fault, MCP_PB_LCP_LH2_1_Enable_Fault,
+                         MCP_PB_Zone_Select_FWD_Fault, MCP_PB_Zone_Select_AFT_Fault,
+                         MCP_PB_Side_Select_Right_Fault, MCP_PB_Side_Select_Left_Fault,
+                         MCP_PB_Power_On_Off_Fault, MCP_Panel_Status,
+                         MCP_PB_Lamp_Test_Fault, MCP_PB_Spin_Fault, MCP_PB_20FT_Fault,
+                         MCP_PB_Dual_Operator_Fault, MCP_PB_LCP_RH4_3_Enable_Fault,
+                         Engineering_Data_2, MCP_Mux_Current_Voltage, MCP_TGLS_20FT_Fault,
+                         MCP_Joystick_Fault, MCP_Measured_Current_Voltage> Layout;
+
+    //Fault and error signals, watched by the fault event stage
+    typedef SignalLayout<NVM_Integrity_Check_Fault, NVM_Checksum_Fault, OPSW_CRC_Fault,
+                         MCP_PB_LCP_RH2_1_Enable_Fault, MCP_PB_LCP_LH4_3_Enable_Fault,
+                         MCP_PB_LCP_LH2_1_Enable_Fault, MCP_PB_Zone_Select_FWD_Fault,
+                         MCP_PB_Zone_Select_AFT_Fault, MCP_PB_Side_Select_Right_Fault,
+                         MCP_PB_Side_Select_Left_Fault, MCP_PB_Power_On_Off_Fault,
+                         MCP_PB_Lamp_Test_Fault, MCP_PB_Spin_Fault, MCP_PB_20FT_Fault,
+                         MCP_PB_Dual_Operator_Fault, MCP_PB_LCP_RH4_3_Enable_Fault,
+                         MCP_TGLS_20FT_Fault, MCP_Joystick_Fault> Faults;
+};
+
+static_assert(ICD_MCP_Panel_CMD::Layout::Disjoint(), "ICD_MCP_Panel_CMD signals overlap");
+
+/*-----------------------------------------------------------------------------
+ *  Description : OCP Panel Command. OCP_Panel_CMD_Data overlays the same bits.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_OCP_Panel_CMD
+{
+    typedef Signal<0, 1>                    OCP_TGLS_20FT_OUT;
+    typedef Signal<1, 1>                    OCP_TGLS_20FT_IN;
+    typedef Signal<2, 1>                    OCP_PB_Zone_Select_FWD;
+    typedef Signal<3, 1>                    OCP_PB_Zone_Select_AFT;
+    typedef Signal<4, 1>                    OCP_PB_Side_Select_Right;
+    typedef Signal<5, 1>                    OCP_PB_Side_Select_Left;
+    typedef Signal<6, 1>                    OCP_PB_PDU_Stop;
+    typedef Signal<7, 1>                    OCP_PB_Power_On_Off;
+    typedef Signal<8, 1>                    Engineering_Data_1;
+    typedef Signal<9, 1>                    Engineering_Data_2;
+    typedef Signal<10, 1>                   OCP_TGLS_L_R_AFT;
+    typedef Signal<11, 1>                   OCP_TGLS_L_R_FWD;
+    typedef Signal<12, 1>                   OCP_TGLS_IN_OUT_OUT;
+    typedef Signal<13, 1>                   OCP_TGLS_IN_OUT_IN;
+    typedef Signal<14, 1>                   OCP_PB_20FT;
+    typedef Signal<15, 1>                   OCP_PB_Dual_Operator;
+    typedef Signal<16, 1>                   OCP_PB_Zone_Select_AFT_Fault;
+    typedef Signal<17, 1>                   OCP_PB_Side_Select_Right_Fault;
+    typedef Signal<18, 1>                   OCP_PB_Side_Select_Left_Fault;
+    typedef Signal<19, 1>                   OCP_PB_Power_On_Off_Fault;
+    typedef Signal<20, 1>                   NVM_Integrity_Check_Fault;
+    typedef Signal<21, 1>                   NVM_Checksum_Fault;
+    typedef Signal<22, 1>                   Engineering_Data_3;
+    typedef Signal<23, 1>                   OPSW_CRC_Fault;
+    typedef Signal<24, 2>                   OCP_TGLS_IN_OUT_Fault;
+    typedef Signal<26, 2>                   OCP_TGLS_20FT_Fault;
+    typedef Signal<28, 1>                   OCP_PB_Lamp_Test_Fault;
+    typedef Signal<29, 1>                   OCP_PB_20FT_Fault;
+    typedef Signal<30, 1>                   OCP_PB_Dual_Operator_Fault;
+    typedef Signal<31, 1>                   OCP_PB_Zone_Select_FWD_Fault;
+    typedef Signal<32, 1>                   Engineering_Data_4;
+    typedef Signal<33, 2>                   OCP_Mux_Current_Voltage;
+    typedef Signal<35, 3, CP_STATE>         OCP_Panel_Status;
+    typedef Signal<38, 2>                   OCP_TGLS_L_R_Fault;
+    typedef Signal<40, 8>                   Engineering_Data_5;
+    typedef Signal<48, 16>                  OCP_Measured_Current_Voltage;
+
+    typedef SignalLayout<OCP_TGLS_20FT_OUT, OCP_TGLS_20FT_IN, OCP_PB_Zone_Select_FWD,
+                         OCP_PB_Zone_Select_AFT, OCP_PB_Side_Select_Right,
+                         OCP_PB_Side_Select_Left, OCP_PB_PDU_Stop, OCP_PB_Power_On_Off,
+                         Engineering_Data_1, Engineering_Data_2, OCP_TGLS_L_R_AFT,
+                         OCP_TGLS_L_R_FWD, OCP_TGLS_IN_OUT_OUT, OCP_TGLS_IN_OUT_IN,
+                         OCP_PB_20FT, OCP_PB_Dual_Operator, OCP_PB_Zone_Select_AFT_Fault,
+                         OCP_PB_Side_Select_Right_Fault, OCP_PB_Side_Select_Left_Fault,
+                         OCP_PB_Power_On_Off_Fault, NVM_Integrity_Check_Fault,
+                         NVM_Checksum_Fault, Engineering_Data_3, OPSW_CRC_Fault,
+                         OCP_TGLS_IN_OUT_Fault, OCP_TGLS_20FT_Fault, OCP_PB_Lamp_Test_Fault,
+                         OCP_PB_20FT_Fault, OCP_PB_Dual_Operator_Fault,
+                         OCP_PB_Zone_Select_FWD_Fault, Engineering_Data_4,
+                         OCP_Mux_Current_Voltage, OCP_Panel_Status, OCP_TGLS_L_R_Fault,
+                         Engineering_Data_5, OCP_Measured_Current_Voltage> Layout;
+
+    //Fault and error signals, watched by the fault event stage
+    typedef SignalLayout<OCP_PB_Zone_Select_AFT_Fault, OCP_PB_Side_Select_Right_Fault,
+                         OCP_PB_Side_Select_Left_Fault, OCP_PB_Power_On_Off_Fault,
+                         NVM_Integrity_Check_Fault, NVM_Checksum_Fault, OPSW_CRC_Fault,
+                         OCP_TGLS_IN_OUT_Fault, OCP_TGLS_20FT_Fault, OCP_PB_Lamp_Test_Fault,
+                         OCP_PB_20FT_Fault, OCP_PB_Dual_Operator_Fault,
+                         OCP_PB_Zone_Select_FWD_Fault, OCP_TGLS_L_R_Fault> Faults;
+};
+
+static_assert(ICD_OCP_Panel_CMD::Layout::Disjoint(), "ICD_OCP_Panel_CMD signals overlap");
+
+/*-----------------------------------------------------------------------------
+ *  Description : ICP Panel Command. ICP_Panel_CMD_Data overlays the same bits.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_ICP_Panel_CMD
+{
+    typedef Signal<0, 1>                    ICP_PB_Power_On_Off;
+    typedef Signal<1, 1>                    ICP_PB_PDU_Stop;
+    typedef Signal<2, 1>                    ICP_PB_Side_Select_Left;
+    typedef Signal<3, 1>                    ICP_PB_Side_Select_Right;
+    typedef Signal<4, 1>                    ICP_PB_Zone_Select_AFT;
+    typedef Signal<5, 1>                    ICP_PB_Zone_Select_FWD;
+    typedef Signal<6, 1>                    ICP_PB_LCP_LH2_1_Enable;
+    typedef Signal<7, 1>                    ICP_PB_LCP_LH4_3_Enable;
+    typedef Signal<8, 1>                    ICP_PB_LCP_RH2_1_Enable;
+    typedef Signal<9, 1>                    ICP_PB_LCP_RH4_3_Enable;
+    typedef Signal<10, 1>                   ICP_PB_Dual_Operator;
+    typedef Signal<11, 1>                   ICP_PB_20FT;
+    typedef Signal<12, 1>                   ICP_Joystick_AFT;
+    typedef Signal<13, 1>                   ICP_Joystick_FWD;
+    typedef Signal<14, 1>                   ICP_Joystick_IN;
+    typedef Signal<15, 1>                   ICP_Joystick_OUT;
+    typedef Signal<16, 1>                   ICP_Joystick_NEUTRAL;
+    typedef Signal<17, 1>                   ICP_TGLS_20FT_OUT;
+    typedef Signal<18, 1>                   ICP_TGLS_20FT_IN;
+    typedef Signal<19, 1>                   ICP_PB_Spin;
+    typedef Signal<20, 1>                   ICP_Switch_Fault_Status;
+    typedef Signal<21, 1>                   ICP_PB_Power_On_Off_Fault;
+    typedef Signal<22, 1>                   ICP_PB_PDU_Stop_Fault;
+    typedef Signal<23, 1>                   ICP_PB_Side_Select_Left_Fault;
+    typedef Signal<24, 1>                   ICP_PB_Side_Select_Right_Fault;
+    typedef Signal<25, 1>                   ICP_PB_Zone_Select_AFT_Fault;
+    typedef Signal<26, 1>                   ICP_PB_Zone_Select_FWD_Fault;
+    typedef Signal<27, 1>                   ICP_PB_LCP_LH2_1_Enable_Fault;
+    typedef Signal<28, 1>                   ICP_PB_LCP_LH4_3_Enable_Fault;
+    typedef Signal<29, 1>                   ICP_PB_LCP_RH2_1_Enable_Fault;
+    typedef Signal<30, 1>                   ICP_PB_LCP_RH4_3_Enable_Fault;
+    typedef Signal<31, 1>                   ICP_PB_Dual_Operator_Fault;
+    typedef Signal<32, 1>                   ICP_PB_20FT_Fault;
+    typedef Signal<33, 1>                   ICP_Joystick_Fault;
+    typedef Signal<34, 1>                   ICP_TGLS_20FT_Fault;
+    typedef Signal<35, 1>                   ICP_PB_Spin_Fault;
+    typedef Signal<36, 1>                   ICP_PB_Lamp_Test_Fault;
+    typedef Signal<37, 1>                   ICP_LED_System_Active_Fault;
+    typedef Signal<38, 2>                   ICP_Mux_Current_Voltage;
+    typedef Signal<40, 4, CP_STATE>         ICP_Panel_Status;
+    typedef Signal<44, 16>                  ICP_Measured_Current_Voltage;
+
+    typedef SignalLayout<ICP_PB_Power_On_Off, ICP_PB_PDU_Stop, ICP_PB_Side_Select_Left,
+                         ICP_PB_Side_Select_Right, ICP_PB_Zone_Select_AFT,
+                         ICP_PB_Zone_Select_FWD, ICP_PB_LCP_LH2_1_Enable,
+                         ICP_PB_LCP_LH4_3_Enable, ICP_PB_LCP_RH2_1_Enable,
+                         ICP_PB_LCP_RH4_3_Enable, ICP_PB_Dual_Operator, ICP_PB_20FT,
+                         ICP_Joystick_AFT, ICP_Joystick_FWD, ICP_Joystick_IN,
+                         ICP_Joystick_OUT, ICP_Joystick_NEUTRAL, ICP_TGLS_20FT_OUT,
+                         ICP_TGLS_20FT_IN, ICP_PB_Spin, ICP_Switch_Fault_Status,
+                         ICP_PB_Power_On_Off_Fault, ICP_PB_PDU_Stop_Fault,
+                         ICP_PB_Side_Select_Left_Fault, ICP_PB_Side_Select_Right_Fault,
+                         ICP_PB_Zone_Select_AFT_Fault, ICP_PB_Zone_Select_FWD_Fault,
+                         ICP_PB_LCP_LH2_1_Enable_Fault, ICP_PB_LCP_LH4_3_Enable_Fault,
+                         ICP_PB_LCP_RH2_1_Enable_Fault, ICP_PB_LCP_RH4_3_Enable_Fault,
+                         ICP_PB_Dual_Operator_Fault, ICP_PB_20FT_Fault, ICP_Joystick_Fault,
+                         ICP_TGLS_20FT_Fault, ICP_PB_Spin_Fault, ICP_PB_Lamp_Test_Fault,
+                         ICP_LED_System_Active_Fault, ICP_Mux_Current_Voltage,
+                         ICP_Panel_Status, ICP_Measured_Current_Voltage> Layout;
+
+    //Fault and error signals, watched by the fault event stage
+    typedef SignalLayout<ICP_Switch_Fault_Status, ICP_PB_Power_On_Off_Fault,
+                         ICP_PB_PDU_Stop_Fault, ICP_PB_Side_Select_Left_Fault,
+                         ICP_PB_Side_Select_Right_Fault, ICP_PB_Zone_Select_AFT_Fault,
+                         ICP_PB_Zone_Select_FWD_Fault, ICP_PB_LCP_LH2_1_Enable_Fault,
+                         ICP_PB_LCP_LH4_3_Enable_Fault, ICP_PB_LCP_RH2_1_Enable_Fault,
+                         ICP_PB_LCP_RH4_3_Enable_Fault, ICP_PB_Dual_Operator_Fault,
+                         ICP_PB_20FT_Fault, ICP_Joystick_Fault, ICP_TGLS_20FT_Fault,
+                         ICP_PB_Spin_Fault, ICP_PB_Lamp_Test_Fault,
+                         ICP_LED_System_Active_Fault> Faults;
+};
+
+static_assert(ICD_ICP_Panel_CMD::Layout::Disjoint(), "ICD_ICP_Panel_CMD signals overlap");
+
+/*-----------------------------------------------------------------------------
+ *  Description : PDU STATUS Message 1. PDU_Status_MSG1_Data overlays the same bits.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_PDU_Status_MSG1
+{
+    typedef Signal<0, 2, PDU_ROLLER_POSITION>PDU_Roller_Position;
+    typedef Signal<2, 2, PDU_COVER_STATUS>  PDU_Cover_Status;
+    typedef Signal<4, 2, PDU_HEALTH_STATUS> PDU_Health_Status;
+    typedef Signal<6, 2, PDU_TYPE>          PDU_Type;
+    typedef Signal<8, 4, PDU_STATE>         PDU_State;
+    typedef Signal<12, 4, PDU_MODE>         PDU_Mode;
+    typedef Signal<16, 4, DRIVE_MOTOR_STATE>Drive_Motor_State;
+    typedef Signal<20, 2, LIFT_MOTOR_MODE>  Lift_Motor_Mode;
+    typedef Signal<22, 2, DRIVE_MOTOR_MODE> Drive_Motor_Mode;
+    typedef Signal<24, 2, PDU_DRIVE_COMMAND_DIR>Active_Drive_Command_Direction;
+    typedef Signal<26, 2, LIFT_MOTOR_STATE> Lift_Motor_State;
+    typedef Signal<28, 4, LM_CTRL_SEQ_STATE>Lift_Motor_Control_Seq_State;
+    typedef Signal<32, 1>                   Lift_Motor_Hall_Sensor_State_Error;
+    typedef Signal<33, 1>                   Drive_Motor_Hall_Sensor_State_Error;
+    typedef Signal<34, 1>                   VAC115_Phase_Fault;
+    typedef Signal<35, 1>                   Board_Over_Temperature_Fault;
+    typedef Signal<36, 1>                   IGBT_Protection_Trip;
+    typedef Signal<37, 1>                   HVDC_Under_Voltage_Fault;
+    typedef Signal<38, 1>                   HVDC_Over_Voltage_Fault;
+    typedef Signal<39, 1, PDU_HOLD_STATUS>  Hold_Status;
+    typedef Signal<40, 1>                   NVM_Integrity_Check_Fault;
+    typedef Signal<41, 1>                   NVM_Checksum_Fault;
+    typedef Signal<42, 1>                   OPSW_CRC_Fault;
+    typedef Signal<43, 1>                   Engineering_Data_1;
+    typedef Signal<44, 1>                   Lift_Mechanism_Fault;
+    typedef Signal<45, 1>                   Lift_Motor_State_Machine_Error;
+    typedef Signal<46, 1>                   Drive_Motor_State_Machine_Error;
+    typedef Signal<47, 1>                   Engineering_Data_2;
+    typedef Signal<48, 1>                   Engineering_Data_3;
+    typedef Signal<49, 1>                   LM_Current_Fault_Monitoring_Status;
+    typedef Signal<50, 1>                   DM_Current_Fault_Monitoring_Status;
+    typedef Signal<51, 1>                   IGBT_Onchip_Over_Temperature_Fault;
+    typedef Signal<52, 1>                   Drive_Motor_Over_Temperature_Fault;
+    typedef Signal<53, 1>                   ATRU_Left_Coil_Over_Temperature_Fault;
+    typedef Signal<54, 1>                   ATRU_Right_Coil_Over_Temperature_Fault;
+
+    typedef SignalLayout<PDU_Roller_Position, PDU_Cover_Status, PDU_Health_Status, PDU_Type,
+                         PDU_State, PDU_Mode, Drive_Motor_State, Lift_Motor_Mode,
+                         Drive_Motor_Mode, Active_Drive_Command_Direction, Lift_Motor_State,
+                         Lift_Motor_Control_Seq_State, Lift_Motor_Hall_Sensor_State_Error,
+                         Drive_Motor_Hall_Sensor_State_Error, VAC115_Phase_Fault,
+                         Board_Over_Temperature_Fault, IGBT_Protection_Trip,
+                         HVDC_Under_Voltage_Fault, HVDC_Over_Voltage_Fault, Hold_Status,
+                         NVM_Integrity_Check_Fault, NVM_Checksum_Fault, OPSW_CRC_Fault,
+                         Engineering_Data_1, Lift_Mechanism_Fault,
+                         Lift_Motor_State_Machine_Error, Drive_Motor_State_Machine_Error,
+                         Engineering_Data_2, Engineering_Data_3,
+                         LM_Current_Fault_Monitoring_Status,
+                         DM_Current_Fault_Monitoring_Status,
+                         IGBT_Onchip_Over_Temperature_Fault,
+                         Drive_Motor_Over_Temperature_Fault,
+                         ATRU_Left_Coil_Over_Temperature_Fault,
+                         ATRU_Right_Coil_Over_Temperature_Fault> Layout;
+
+    //Fault and error signals, watched by the fault event stage
+    typedef SignalLayout<Lift_Motor_Hall_Sensor_State_Error,
+                         Drive_Motor_Hall_Sensor_State_Error, VAC115_Phase_Fault,
+                         Board_Over_Temperature_Fault, IGBT_Protection_Trip,
+                         HVDC_Under_Voltage_Fault, HVDC_Over_Voltage_Fault,
+                         NVM_Integrity_Check_Fault, NVM_Checksum_Fault, OPSW_CRC_Fault,
+                         Lift_Mechanism_Fault, Lift_Motor_State_Machine_Error,
+                         Drive_Motor_State_Machine_Error,
+                         LM_Current_Fault_Monitoring_Status,
+                         DM_Current_Fault_Monitoring_Status,
+                         IGBT_Onchip_Over_Temperature_Fault,
+                         Drive_Motor_Over_Temperature_Fault,
+                         ATRU_Left_Coil_Over_Temperature_Fault,
+                         ATRU_Right_Coil_Over_Temperature_Fault> Faults;
+
+    //Faults that make a healthy PDU Abnormal on the PDU Status page
+    typedef SignalLayout<HVDC_Over_Voltage_Fault, HVDC_Under_Voltage_Fault, VAC115_Phase_Fault,
+                         ATRU_Left_Coil_Over_Temperature_Fault,
+                         ATRU_Right_Coil_Over_Temperature_Fault,
+                         Drive_Motor_Over_Temperature_Fault, Board_Over_Temperature_Fault,
+                         IGBT_Onchip_Over_Temperature_Fault, IGBT_Protection_Trip> Abnormal;
+};
+
+static_assert(ICD_PDU_Status_MSG1::Layout::Disjoint(), "ICD_PDU_Status_MSG1 signals overlap");
+
+/*-----------------------------------------------------------------------------
+ *  Description : PDU STATUS Message 2
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_PDU_Status_MSG2
+{
+    typedef Signal<0, 2>                    Current_Mux;
+    typedef Signal<2, 2>                    Voltage_Mux;
+    typedef Signal<4, 4>                    Temperature_Mux;
+    typedef Signal<8, 16>                   Measured_Current;
+    typedef Signal<24, 16>                  Measured_Voltage;
+    typedef Signal<40, 16>                  Measured_Temperature;
+
+    typedef SignalLayout<Current_Mux, Voltage_Mux, Temperature_Mux, Measured_Current,
+                         Measured_Voltage, Measured_Temperature> Layout;
+};
+
+static_assert(ICD_PDU_Status_MSG2::Layout::Disjoint(), "ICD_PDU_Status_MSG2 signals overlap");
+
+/*-----------------------------------------------------------------------------
+ *  Description : PDU STATUS Message 3
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_PDU_Status_MSG3
+{
+    typedef Signal<0, 16>                   PDU_Roller_Speed;
+    typedef Signal<16, 16>                  PDU_LM_Speed;
+    typedef Signal<32, 16>                  PDU_LM_Hall_Count;
+
+    typedef SignalLayout<PDU_Roller_Speed, PDU_LM_Speed, PDU_LM_Hall_Count> Layout;
+};
+
+static_assert(ICD_PDU_Status_MSG3::Layout::Disjoint(), "ICD_PDU_Status_MSG3 signals overlap");
+
+/*-----------------------------------------------------------------------------
+ *  Description : ULD Status Message
+ *                Offsets as the former ULD_Status_Signals bitfield laid them
+ *                out in the 8 byte frame, Engineering_Data in the low bits.
+ *                Its declaration is 73 bits: ULD_Movement and ULD_ID start the
+ *                second 64 bit unit, bit 64 of the bitfield, and are read from
+ *                ULD_Status::Data1. No frame fills that word yet.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct ICD_ULD_Status
+{
+    typedef Signal<0, 9>                    Engineering_Data;
+    typedef Signal<9, 6>                    ULD_LH_Lagging_Edge_PDU;
+    typedef Signal<15, 6>                   ULD_RH_Next_PDU;
+    typedef Signal<21, 6>                   ULD_LH_Next_PDU;
+    typedef Signal<27, 2>                   ULD_type;
+    typedef Signal<29, 6>                   ULD_RH_Lagging_Edge_PDU;
+    typedef Signal<35, 6>                   ULD_RH_Trailing_Edge_PDU;
+    typedef Signal<41, 6>                   ULD_LH_Trailing_Edge_PDU;
+    typedef Signal<47, 6>                   ULD_RH_Leading_Edge_PDU;
+    typedef Signal<53, 6>                   ULD_LH_Leading_Edge_PDU;
+    typedef Signal<59, 3>                   ULD_Size;
+    typedef Signal<62, 1>                   ULD_SW_Latch;
+
+    typedef SignalLayout<Engineering_Data, ULD_LH_Lagging_Edge_PDU, ULD_RH_Next_PDU,
+                         ULD_LH_Next_PDU, ULD_type, ULD_RH_Lagging_Edge_PDU,
+                         ULD_RH_Trailing_Edge_PDU, ULD_LH_Trailing_Edge_PDU,
+                         ULD_RH_Leading_Edge_PDU, ULD_LH_Leading_Edge_PDU, ULD_Size,
+                         ULD_SW_Latch> Layout;
+
+    //Second 64 bit unit, ULD_Status::Data1
+    typedef Signal<0, 4>                    ULD_Movement;
+    typedef Signal<4, 6>                    ULD_ID;
+
+    typedef SignalLayout<ULD_Movement, ULD_ID> Layout1;
+};
+
+static_assert(ICD_ULD_Status::Layout::Disjoint() && ICD_ULD_Status::Layout1::Disjoint(),
+              "ICD_ULD_Status signals overlap");
+
+/*------------------------------ CODEC SELF CHECK ---------------------------*/
+static_assert(ICD_PDU_Status_MSG2::Measured_Current::Get(0x0000000000ABCD00ULL) == 0xABCD,
+              "Intel signal extract");
+static_assert(ICD_PDU_Status_MSG3::PDU_LM_Speed::Set(0, 0x1234) == 0x0000000012340000ULL,
+              "Intel signal pack");
+static_assert(Signal<7, 16, uint64_t, SIGNAL_MOTOROLA>::Get(0x000000000000CDABULL) == 0xABCD,
+              "Motorola signal extract");
+static_assert(Signal<7, 16, uint64_t, SIGNAL_MOTOROLA>::Set(0, 0xABCD) == 0x000000000000CDABULL,
+              "Motorola signal pack");
+static_assert(ICD_ULD_Status::Layout::UsedMask() == 0x7FFFFFFFFFFFFFFFULL, "ULD Status bit 63 is not used");
+//Frame the former ULD_Status_Signals bitfield packs from {Engineering_Data 0x1FF, LH Lagging 1, RH Next 2, LH Next 3, type 2,
+//RH Lagging 4, RH Trailing 5, LH Trailing 6, RH Leading 7, LH Leading 8, Size 5, Latch 1, Movement 9, ID 10}
+static_assert(ICD_ULD_Status::ULD_LH_Lagging_Edge_PDU::Get(0x69038C28906103FFULL) == 1 &&
+              ICD_ULD_Status::ULD_RH_Next_PDU::Get(0x69038C28906103FFULL) == 2 &&
+              ICD_ULD_Status::ULD_LH_Next_PDU::Get(0x69038C28906103FFULL) == 3 &&
+              ICD_ULD_Status::ULD_type::Get(0x69038C28906103FFULL) == 2 &&
+              ICD_ULD_Status::ULD_RH_Lagging_Edge_PDU::Get(0x69038C28906103FFULL) == 4 &&
+              ICD_ULD_Status::ULD_RH_Trailing_Edge_PDU::Get(0x69038C28906103FFULL) == 5 &&
+              ICD_ULD_Status::ULD_LH_Trailing_Edge_PDU::Get(0x69038C28906103FFULL) == 6 &&
+              ICD_ULD_Status::ULD_RH_Leading_Edge_PDU::Get(0x69038C28906103FFULL) == 7 &&
+              ICD_ULD_Status::ULD_LH_Leading_Edge_PDU::Get(0x69038C28906103FFULL) == 8 &&
+              ICD_ULD_Status::ULD_Size::Get(0x69038C28906103FFULL) == 5 &&
+              ICD_ULD_Status::ULD_SW_Latch::Get(0x69038C28906103FFULL) == 1 &&
+              ICD_ULD_Status::ULD_Movement::Get(0x00000000000000A9ULL) == 9 &&
+              ICD_ULD_Status::ULD_ID::Get(0x00000000000000A9ULL) == 10,
+              "ULD Status decode");
+static_assert(ICD_LCP_Panel_CMD::Layout::UsedMask() == ~0ULL, "LCP Panel Command must fill the payload");
+
+#endif // ICDSIGNALS_H
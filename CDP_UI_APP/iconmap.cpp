@@ -0,0 +1,88 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : iconmap.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "iconmap.h"
+#include "commondata.h"
+#include <QHash>
+#include <QDebug>
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+//PNG of every ICON_ID, relative to BaseFolder
+static const char *const IconFiles[ICON_COUNT] = {
+    "MCPGN.png", "MCPGR.png", "MCPAM.png", "MCPRA.png", "MCPRG.png",
+    "ICPGN.png", "ICPGR.png", "ICPAM.png", "ICPRA.png", "ICPRG.png",
+    "OCPGN.png", "OCPGR.png", "OCPAM.png", "OCPRA.png", "OCPRG.png",
+    "PDUGR.png", "AMAF.png", "AMFW.png", "AMIN.png", "AMOU.png",
+    "GNAF.png", "GNFW.png", "GNIN.png", "GNOU.png", "PDUAM.png",
+    "PDUGN.png", "PDURD.png", "PDUWA.png", "PDUWH.png", "PDUWR.png",
+    "1LHGN.png", "2LHGN.png", "3LHGN.png", "4LHGN.png",
+    "1RHGN.png", "2RHGN.png", "3RHGN.png", "4RHGN.png",
+    "1LHGY.png", "2LHGY.png", "3LHGY.png", "4LHGY.png",
+    "1RHGY.png", "2RHGY.png", "3RHGY.png", "4RHGY.png",
+    "1LHAM.png", "2LHAM.png", "3LHAM.png", "4LHAM.png",
+    "1RHAM.png", "2RHAM.png", "3RHAM.png", "4RHAM.png",
+    "1LHRA.png", "2LHRA.png", "3LHRA.png", "4LHRA.png",
+    "1RHRA.png", "2RHRA.png", "3RHRA.png", "4RHRA.png",
+    "1LHRG.png", "2LHRG.png", "3LHRG.png", "4LHRG.png",
+    "1RHRG.png", "2RHRG.png", "3RHRG.png", "4RHRG.png"};
+
+static QPixmap                  IconSource[ICON_COUNT];
+static QHash<quint64, QPixmap>  ScaledIcons;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Returns the icon scaled to the given size, decoding and
+ *                scaling it on the first request of that size only
+ *
+ *  Arguments   : ICON_ID, Width, Height
+ *
+ *  Return Value: Cached pixmap
+ *
+ *-----------------------------------------------------------------------------
+ */
+const QPixmap &GetIcon(int Icon, int Width, int Height)
+{
+    quint64 Key = ((quint64)Icon << 32) | ((quint64)(Width & 0xFFFF) << 16) | (quint64)(Height & 0xFFFF);
+    QHash<quint64, QPixmap>::iterator Scaled = ScaledIcons.find(Key);
+
+    if(Scaled == ScaledIcons.end()){
+        //Decoded on its first request, icons of pages never opened are not loaded
+        if(IconSource[Icon].isNull() && !IconSource[Icon].load(BaseFolder + IconFiles[Icon])){
+            qDebug() << "Icon not loaded" << IconFiles[Icon];
+        }
+        Scaled = ScaledIcons.insert(Key, IconSource[Icon].scaled(Width, Height, Qt::KeepAspectRatio));
+    }
+    return Scaled.value();
+}
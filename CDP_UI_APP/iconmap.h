@@ -0,0 +1,111 @@
+
+
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : iconmap.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef ICONMAP_H
+#define ICONMAP_H
+
+/****************************** HEADER FILES *********************************/
+#include <QPixmap>
+
+/********************* ENUMS  *****************************/
+//Indicator icons, one per PNG of the PICS folder
+enum ICON_ID {ICON_MCP_GREEN = 0, ICON_MCP_GREY, ICON_MCP_AMBER, ICON_MCP_RDAM, ICON_MCP_RDGN,
+              ICON_ICP_GREEN, ICON_ICP_GREY, ICON_ICP_AMBER, ICON_ICP_RDAM, ICON_ICP_RDGN,
+              ICON_OCP_GREEN, ICON_OCP_GREY, ICON_OCP_AMBER, ICON_OCP_RDAM, ICON_OCP_RDGN,
+              ICON_PDU_GREY, ICON_PDU_AMBAF, ICON_PDU_AMBFW, ICON_PDU_AMBIN, ICON_PDU_AMBOU,
+              ICON_PDU_GRNAF, ICON_PDU_GRNFW, ICON_PDU_GRNIN, ICON_PDU_GRNOU, ICON_PDU_AMBER,
+              ICON_PDU_GREEN, ICON_PDU_RED, ICON_PDU_WHAMB, ICON_PDU_WHITE, ICON_PDU_WHRED,
+              ICON_LCP_GREEN,                       //8 icons each, indexed by LCP_NUM
+              ICON_LCP_GREY = ICON_LCP_GREEN + 8,
+              ICON_LCP_AMBER = ICON_LCP_GREY + 8,
+              ICON_LCP_RDAM = ICON_LCP_AMBER + 8,
+              ICON_LCP_RDGN = ICON_LCP_RDAM + 8,
+              ICON_COUNT = ICON_LCP_RDGN + 8};
+
+/*-----------------------------------------------------------------------------
+ *  Description : Returns the icon scaled to the given size. An icon is decoded
+ *                on its first request, each (icon, size) pair is scaled once
+ *                and then shared by every label using it.
+ *
+ *-----------------------------------------------------------------------------
+ */
+const QPixmap &GetIcon(int Icon, int Width, int Height);
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     MCP_GREEN_PIX   GetIcon(ICON_MCP_GREEN, MCPWt, MCPHt)
+#define     MCP_GREY_PIX   GetIcon(ICON_MCP_GREY, MCPWt, MCPHt)
+#define     MCP_AMBER_PIX   GetIcon(ICON_MCP_AMBER, MCPWt, MCPHt)
+#define     MCP_RDAM_PIX   GetIcon(ICON_MCP_RDAM, MCPWt, MCPHt)
+#define     MCP_RDGN_PIX   GetIcon(ICON_MCP_RDGN, MCPWt, MCPHt)
+
+#define     ICP_GREEN_PIX   GetIcon(ICON_ICP_GREEN, ICPWt, ICPHt)
+#define     ICP_GREY_PIX   GetIcon(ICON_ICP_GREY, ICPWt, ICPHt)
+#define     ICP_AMBER_PIX   GetIcon(ICON_ICP_AMBER, ICPWt, ICPHt)
+#define     ICP_RDAM_PIX   GetIcon(ICON_ICP_RDAM, ICPWt, ICPHt)
+#define     ICP_RDGN_PIX   GetIcon(ICON_ICP_RDGN, ICPWt, ICPHt)
+
+#define     OCP_GREEN_PIX   GetIcon(ICON_OCP_GREEN, OCPWt, OCPHt)
+#define     OCP_GREY_PIX   GetIcon(ICON_OCP_GREY, ICPWt, ICPHt)
+#define     OCP_AMBER_PIX   GetIcon(ICON_OCP_AMBER, ICPWt, ICPHt)
+#define     OCP_RDAM_PIX   GetIcon(ICON_OCP_RDAM, ICPWt, ICPHt)
+#define     OCP_RDGN_PIX   GetIcon(ICON_OCP_RDGN, ICPWt, ICPHt)
+
+
+#define     PDU_GREY_PIX   GetIcon(ICON_PDU_GREY, PDUWt, PDUHt)
+#define     PDU_AMBAF_PIX   GetIcon(ICON_PDU_AMBAF, PDUWt, PDUHt)
+#define     PDU_AMBFW_PIX   GetIcon(ICON_PDU_AMBFW, PDUWt, PDUHt)
+#define     PDU_AMBIN_PIX   GetIcon(ICON_PDU_AMBIN, PDUWt, PDUHt)
+#define     PDU_AMBOU_PIX   GetIcon(ICON_PDU_AMBOU, PDUWt, PDUHt)
+#define     PDU_GRNAF_PIX   GetIcon(ICON_PDU_GRNAF, PDUWt, PDUHt)
+#define     PDU_GRNFW_PIX   GetIcon(ICON_PDU_GRNFW, PDUWt, PDUHt)
+#define     PDU_GRNIN_PIX   GetIcon(ICON_PDU_GRNIN, PDUWt, PDUHt)
+#define     PDU_GRNOU_PIX   GetIcon(ICON_PDU_GRNOU, PDUWt, PDUHt)
+#define     PDU_AMBER_PIX   GetIcon(ICON_PDU_AMBER, PDUWt, PDUHt)
+#define     PDU_GREEN_PIX   GetIcon(ICON_PDU_GREEN, PDUWt, PDUHt)
+#define     PDU_RED_PIX   GetIcon(ICON_PDU_RED, PDUWt, PDUHt)
+#define     PDU_WHAMB_PIX   GetIcon(ICON_PDU_WHAMB, PDUWt, PDUHt)
+#define     PDU_WHITE_PIX   GetIcon(ICON_PDU_WHITE, PDUWt, PDUHt)
+#define     PDU_WHRED_PIX   GetIcon(ICON_PDU_WHRED, PDUWt, PDUHt)
+
+#define     LCP_GREEN_PIX(Pos)   GetIcon(ICON_LCP_GREEN + (Pos), LCPWt, LCPHt)
+#define     LCP_GREY_PIX(Pos)   GetIcon(ICON_LCP_GREY + (Pos), ICPWt, ICPHt)
+#define     LCP_AMBER_PIX(Pos)   GetIcon(ICON_LCP_AMBER + (Pos), ICPWt, ICPHt)
+#define     LCP_RDAM_PIX(Pos)   GetIcon(ICON_LCP_RDAM + (Pos), ICPWt, ICPHt)
+#define     LCP_RDGN_PIX(Pos)   GetIcon(ICON_LCP_RDGN + (Pos), ICPWt, ICPHt)
+
+
+#endif // ICONMAP_H
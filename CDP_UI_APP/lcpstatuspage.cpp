@@ -0,0 +1,286 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : lcptstatuspage.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : The CDP OPSW to manage all fields in the LCP status display
+ *                Provides tabular information on the status of the CP Signals
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "lcpstatuspage.h"
+#include "ui_lcpstatuspage.h"
+#include "panelimage.h"
+#include "common.h"
+#include "commondata.h"
+#include <QDebug>
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the LCP Status application
+ *
+ *  Arguments   : Parent Class
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+LCPStatusPage::LCPStatusPage(QWidget *parent) :
+    QDialog(parent),
+    ui(new Ui::LCPStatusPage)
+{
+    ui->setupUi(this);
+
+    //set the page background
+    qDebug() << "LCP Status Page";
+
+    SetPageBackground(this, "LCPStatusPgBkg.png");
+
+    LCPNum = 0;
+
+    BackButton = new QPushButton("", this);
+    BackButton->setGeometry(QRect(QPoint(LCP_BK_BTN_X, LCP_BK_BTN_Y), QSize(LCP_BK_BTN_WT, LCP_BK_BTN_HT)));
+    QPixmap BackButtonBkg(BaseFolder + "BackButton.png");
+    QIcon BackButtonIcon(BackButtonBkg.scaled(LCP_BK_BTN_WT, LCP_BK_BTN_HT,Qt::KeepAspectRatio));
+    BackButton->setIcon(BackButtonIcon);
+    BackButton->setIconSize(BackButtonBkg.rect().size());
+    connect(BackButton, &QPushButton::released, this, &LCPStatusPage::HandleBackButton);
+
+
+    timer = new QTimer(this);
+    connect(timer, SIGNAL(timeout()), this, SLOT(UpdateUI()));
+    //Runs only while the page is shown, see showEvent
+    timer->setInterval(ONE_MS);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Navigation implementation to Cont Monitoring screen
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void LCPStatusPage::HandleBackButton(){
+    CurrPage = PrevPage;
+    PrevPage = LCP_STATUS;
+    hide();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Implementation of continous indicators update on the screen
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void LCPStatusPage::UpdateUI()
+{
+    ui->LCPTable1->setItem(0, 1, new QTableWidgetItem(LCPName));
+    if(CurrPage == LCP_STATUS){
+        //Drive [FWD/AFT] Indicator
+        if(ICD_LCP_Panel_CMD::LCP_TGLS_Drive_Fault::Value(_LCP[LCPNum].Command.Data) == TRUE){
+            //Set to Invalid
+            ui->LCPTable1->setItem(ROW1, COLUMN1, new QTableWidgetItem("Invalid"));
+        }
+        else if(ICD_LCP_Panel_CMD::LCP_TGLS_Drive_AFT::Value(_LCP[LCPNum].Command.Data) == TRUE){
+            //Set to AFT
+            ui->LCPTable1->setItem(ROW1, COLUMN1, new QTableWidgetItem("AFT"));
+        }
+        else if(ICD_LCP_Panel_CMD::LCP_TGLS_Drive_FWD::Value(_LCP[LCPNum].Command.Data)  == TRUE){
+            //Set to OFF
+            ui->LCPTable1->setItem(ROW1, COLUMN1, new QTableWidgetItem("FWD"));
+        }
+
+        //Panel Enabled Indicator
+ /*       if(_LCP[LCPNum].Command.Signal.LCP_LED_Panel_Enabled_Fault == TRUE){
+            //Set to Invalid
+            ui->LCPTable1->setItem(ROW2, COLUMN1, new QTableWidgetItem("Invalid"));
+        }
+        else if(_LCP[LCPNum].Status.Signal.LCP_LED_Panel_Enabled == TRUE){
+            //Set to Enabled
+            ui->LCPTable1->setItem(ROW2, COLUMN1, new QTableWidgetItem("Enabled"));
+        }
+        else if(_LCP[LCPNum].Status.Signal.LCP_LED_Panel_Enabled  == FALSE){
+            //Set to Disabled
+            ui->LCPTable1->setItem(ROW2, COLUMN1, new QTableWidgetItem("Disabled"));
+        }
+*/
+        //PDU Stop Indicator
+        if(ICD_LCP_Panel_CMD::LCP_PB_PDU_Stop_Fault::Value(_LCP[LCPNum].Command.Data)== TRUE){
+            //Set to Invalid
+            ui->LCPTable1->setItem(ROW3, COLUMN1, new QTableWidgetItem("Invalid"));
+        }
+        else if(ICD_LCP_Panel_CMD::LCP_PB_PDU_Stop::Value(_LCP[LCPNum].Command.Data) == TRUE){
+            //Set to ON
+            ui->LCPTable1->setItem(ROW3, COLUMN1, new QTableWidgetItem("ON"));
+        }
+        else if(ICD_LCP_Panel_CMD::LCP_PB_PDU_Stop::Value(_LCP[LCPNum].Command.Data)  == FALSE){
+            //Set to OFF
+            ui->LCPTable1->setItem(ROW3, COLUMN1, new QTableWidgetItem("OFF"));
+        }
+
+        //Dual Lane Indicator
+        if(ICD_LCP_Panel_CMD::LCP_PB_Dual_Lane::Value(_LCP[LCPNum].Command.Data) == TRUE){
+            //Set to Invalid
+            ui->LCPTable1->setItem(ROW4, COLUMN1, new QTableWidgetItem("Invalid"));
+        }
+        else if(ICD_LCP_Panel_Status::LCP_PB_Dual_Lane_LED::Value(_LCP[LCPNum].Status.Data) == TRUE){
+            //Set to Enabled
+            ui->LCPTable1->setItem(ROW4, COLUMN1, new QTableWidgetItem("Enabled"));
+        }
+        else if(ICD_LCP_Panel_Status::LCP_PB_Dual_Lane_LED::Value(_LCP[LCPNum].Status.Data)  == FALSE){
+            //Set to Disabled
+            ui->LCPTable1->setItem(ROW4, COLUMN1, new QTableWidgetItem("Disabled"));
+        }
+
+        //Unlock Next Indicator
+        if(ICD_LCP_Panel_CMD::LCP_PB_Unlock_Next::Value(_LCP[LCPNum].Command.Data) == TRUE){
+            //Set to Invalid
+            ui->LCPTable1->setItem(ROW5, COLUMN1, new QTableWidgetItem("Invalid"));
+        }
+        else if(ICD_LCP_Panel_Status::LCP_PB_Unlock_Next_LED::Value(_LCP[LCPNum].Status.Data) == TRUE){
+            //Set to Enabled
+            ui->LCPTable1->setItem(ROW5, COLUMN1, new QTableWidgetItem("Enabled"));
+        }
+        else if(ICD_LCP_Panel_Status::LCP_PB_Unlock_Next_LED::Value(_LCP[LCPNum].Status.Data)  == FALSE){
+            //Set to Disabled
+            ui->LCPTable1->setItem(ROW5, COLUMN1, new QTableWidgetItem("Disabled"));
+        }
+
+        ui->LCPTable1->setItem(ROW7,COLUMN1, new QTableWidgetItem(QString::number(ICD_LCP_Panel_CMD::LCP_Mux_Current_Voltage::Value(_LCP[LCPNum].Command.Data))));
+        ui->LCPTable1->setItem(ROW8,COLUMN1, new QTableWidgetItem(QString::number(ICD_LCP_Panel_CMD::LCP_Measured_Current_Voltage::Value(_LCP[LCPNum].Command.Data))));
+
+    }
+
+    //OCP Switch Fault
+    if(ICD_LCP_Panel_CMD::LCP_Switch_Fault_Status::Value(_LCP[LCPNum].Command.Data) == TRUE){
+        ui->LCPTable2->setItem(ROW0,COLUMN1, new QTableWidgetItem("True"));
+    }
+    else {
+        ui->LCPTable2->setItem(ROW0,COLUMN1, new QTableWidgetItem("False"));
+    }
+
+    //PDU Stop Fault
+    if(ICD_LCP_Panel_CMD::LCP_PB_PDU_Stop_Fault::Value(_LCP[LCPNum].Command.Data) == TRUE){
+        ui->LCPTable2->setItem(ROW1,COLUMN1, new QTableWidgetItem("True"));
+    }
+    else {
+        ui->LCPTable2->setItem(ROW1,COLUMN1, new QTableWidgetItem("False"));
+    }
+
+    //TGL Switch Drive Fault
+    if(ICD_LCP_Panel_CMD::LCP_TGLS_Drive_Fault::Value(_LCP[LCPNum].Command.Data) == TRUE){
+        ui->LCPTable2->setItem(ROW2,COLUMN1, new QTableWidgetItem("True"));
+    }
+    else {
+        ui->LCPTable2->setItem(ROW2,COLUMN1, new QTableWidgetItem("False"));
+    }
+
+    //Dual Lane Fault
+    if(ICD_LCP_Panel_CMD::LCP_PB_Dual_Lane_Fault::Value(_LCP[LCPNum].Command.Data) == TRUE){
+        ui->LCPTable2->setItem(ROW3,COLUMN1, new QTableWidgetItem("True"));
+    }
+    else {
+        ui->LCPTable2->setItem(ROW3,COLUMN1, new QTableWidgetItem("False"));
+    }
+
+    //Unlock Next Fault
+    if(ICD_LCP_Panel_CMD::LCP_PB_Unlock_Next_Fault::Value(_LCP[LCPNum].Command.Data) == TRUE){
+        ui->LCPTable2->setItem(ROW4,COLUMN1, new QTableWidgetItem("True"));
+    }
+    else {
+        ui->LCPTable2->setItem(ROW4,COLUMN1, new QTableWidgetItem("False"));
+    }
+
+    //Lamp Test Fault
+    if(ICD_LCP_Panel_CMD::LCP_PB_Lamp_Test_Fault::Value(_LCP[LCPNum].Command.Data) == TRUE){
+        ui->LCPTable2->setItem(ROW5,COLUMN1, new QTableWidgetItem("True"));
+    }
+    else {
+        ui->LCPTable2->setItem(ROW5,COLUMN1, new QTableWidgetItem("False"));
+    }
+
+    //LED Panel Enabled Fault
+/*    if(_LCP[LCPNum].Command.Signal.LCP_LED_Panel_Enabled_Fault == TRUE){
+        ui->LCPTable2->setItem(ROW6,COLUMN1, new QTableWidgetItem("True"));
+    }
+    else {
+        ui->LCPTable2->setItem(ROW6,COLUMN1, new QTableWidgetItem("False"));
+    }
+*/
+
+    timer->setInterval(ONE_SEC);
+
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Starts the table update when the page is opened, the first
+ *                update runs right away
+ *
+ *  Arguments   : Show event
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void LCPStatusPage::showEvent(QShowEvent *Event)
+{
+    QDialog::showEvent(Event);
+    timer->start(ONE_MS);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Stops the table update while the page is hidden
+ *
+ *  Arguments   : Hide event
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void LCPStatusPage::hideEvent(QHideEvent *Event)
+{
+    timer->stop();
+    QDialog::hideEvent(Event);
+}
+
+LCPStatusPage::~LCPStatusPage()
+{
+    delete ui;
+}
@@ -0,0 +1,81 @@
+
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : lcptstatuspage.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef LCPSTATUSPAGE_H
+#define LCPSTATUSPAGE_H
+
+#include <QDialog>
+#include <QTimer>
+#include <QPushButton>
+#include <QString>
+#include <QDebug>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+
+#define LCP_BK_BTN_WT       80
+#define LCP_BK_BTN_HT       80
+#define LCP_BK_BTN_X        60
+#define LCP_BK_BTN_Y        40
+
+namespace Ui {
+class LCPStatusPage;
+}
+
+class LCPStatusPage : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit LCPStatusPage(QWidget *parent = 0);
+    ~LCPStatusPage();
+    QString     LCPName;
+    int         LCPNum;
+
+protected:
+    void showEvent(QShowEvent *Event);
+    void hideEvent(QHideEvent *Event);
+
+private slots:
+    void UpdateUI();
+    void HandleBackButton();
+
+private:
+    Ui::LCPStatusPage *ui;
+    QTimer *timer;
+    QPushButton             *BackButton;
+};
+
+#endif // LCPSTATUSPAGE_H
@@ -0,0 +1,71 @@
+
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : legendsmenupage.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef LEGENDSMENUPAGE_H
+#define LEGENDSMENUPAGE_H
+
+#include <QDialog>
+#include <QPushButton>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+
+#define LMI_BK_BTN_WT       80
+#define LMI_BK_BTN_HT       80
+#define LMI_BK_BTN_X        60
+#define LMI_BK_BTN_Y        40
+
+
+namespace Ui {
+class LegendsMenuPage;
+}
+
+class LegendsMenuPage : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit LegendsMenuPage(QWidget *parent = 0);
+    ~LegendsMenuPage();
+
+private slots:
+    void HandleBackButton();
+
+private:
+    Ui::LegendsMenuPage *ui;
+    QPushButton  *BackButton;
+};
+
+#endif // LEGENDSMENUPAGE_H
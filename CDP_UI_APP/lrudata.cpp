@@ -0,0 +1,49 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : lrudata.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "lrudata.h"
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+//Decoded LRU state, written by the parser thread and read by the pages
+
+Cargo_Zone cargoZone;
+MCP _MCP;
+ICP _ICP;
+OCP _OCP;
+LCP _LCP[8];
+LCP20FT _LCP20FT[2];
+ULD_Status _ULD[ULD_MAX_COUNT];
+PowerDriveUnit _PDU[PDU_MAX_COUNT];
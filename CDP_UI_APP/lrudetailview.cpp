@@ -0,0 +1,155 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : lrudetailview.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "lrudetailview.h"
+#include "common.h"
+#include "trace.h"
+#include <QDebug>
+#include <ctype.h>
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the LRU detail view, no page is
+ *                built yet
+ *
+ *  Arguments   : Parent of the status pages
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+LRUDetailView::LRUDetailView(QWidget *Parent) : Parent(Parent)
+{
+    PDUPage = nullptr;
+    MCPPage = nullptr;
+    OCPPage = nullptr;
+    LCPPage = nullptr;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Title of the status page of an item, e.g. "PDU T L 01" for
+ *                the label "TL01" or "LCP 4LH" for "4LH"
+ *
+ *  Arguments   : Section item
+ *
+ *  Return Value: Name
+ *
+ *-----------------------------------------------------------------------------
+ */
+QString LRUDetailView::ItemName(const SectionItem &Item)
+{
+    const char *Label = Item.Label;
+    QString Name;
+
+    switch(Item.Type){
+    case SECTION_PDU:
+        Name = "PDU";
+        for(; *Label != '\0' && !isdigit((unsigned char)*Label); Label++){
+            Name += ' ';
+            Name += *Label;
+        }
+        return Name + ' ' + Label;
+    case SECTION_LCP:
+        return QString("LCP ") + Label;
+    default:
+        return QString(Label);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Binds the status page of the item's LRU type to its node and
+ *                shows it
+ *
+ *  Arguments   : Section item
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void LRUDetailView::Show(const SectionItem &Item)
+{
+    TRACE_BEGIN(BuildStart);
+
+    switch(Item.Type){
+    case SECTION_PDU:
+        if(Item.Node >= PDU_MAX_COUNT){
+            qDebug() << "No PDU node for" << Item.Label;
+            return;
+        }
+        if(PDUPage == nullptr){
+            PDUPage = new PDUStatPg(Parent);
+            TRACE_END(TRACE_PAGE_BUILD, BuildStart, PDU_STATUS);
+        }
+        PDUPage->PDUNum = Item.Node;
+        PDUPage->PDUName = ItemName(Item);
+        CurrPage = PDU_STATUS;
+        PrevPage = ACC_ZONE;
+        PDUPage->show();
+        break;
+    case SECTION_MCP:
+    case SECTION_ICP:
+        if(MCPPage == nullptr){
+            MCPPage = new MCPStatusPage(Parent);
+            TRACE_END(TRACE_PAGE_BUILD, BuildStart, MCP_STATUS);
+        }
+        MCPPage->CPName = ItemName(Item);
+        CurrPage = MCP_STATUS;
+        PrevPage = ACC_ZONE;
+        MCPPage->show();
+        break;
+    case SECTION_OCP:
+        if(OCPPage == nullptr){
+            OCPPage = new OCPStatusPage(Parent);
+            TRACE_END(TRACE_PAGE_BUILD, BuildStart, OCP_STATUS);
+        }
+        CurrPage = OCP_STATUS;
+        PrevPage = ACC_ZONE;
+        OCPPage->show();
+        break;
+    case SECTION_LCP:
+        if(LCPPage == nullptr){
+            LCPPage = new LCPStatusPage(Parent);
+            TRACE_END(TRACE_PAGE_BUILD, BuildStart, LCP_STATUS);
+        }
+        LCPPage->LCPNum = Item.Node;
+        LCPPage->LCPName = ItemName(Item);
+        CurrPage = LCP_STATUS;
+        PrevPage = ACC_ZONE;
+        LCPPage->show();
+        break;
+    default:
+        break;
+    }
+}
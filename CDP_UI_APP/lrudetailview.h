@@ -0,0 +1,71 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : lrudetailview.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef LRUDETAILVIEW_H
+#define LRUDETAILVIEW_H
+
+/****************************** HEADER FILES *********************************/
+#include <QWidget>
+#include <QString>
+#include "sectionlayout.h"
+#include "pdustatpg.h"
+#include "mcpstatuspage.h"
+#include "ocpstatuspage.h"
+#include "lcpstatuspage.h"
+
+/*-----------------------------------------------------------------------------
+ *  Description : Status page of a section item. One page per LRU type is
+ *                built on its first opening and rebound to the node of each
+ *                item shown, however many zones and items the layout has.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class LRUDetailView
+{
+public:
+    explicit LRUDetailView(QWidget *Parent);
+
+    void Show(const SectionItem &Item);
+    static QString ItemName(const SectionItem &Item);
+
+private:
+    QWidget                 *Parent;
+    PDUStatPg               *PDUPage;
+    MCPStatusPage           *MCPPage;
+    OCPStatusPage           *OCPPage;
+    LCPStatusPage           *LCPPage;
+};
+
+#endif // LRUDETAILVIEW_H
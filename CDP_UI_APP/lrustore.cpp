@@ -0,0 +1,297 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : lrustore.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "lrustore.h"
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+LRUStore                lruStore;
+
+//UI thread copy of the versions, consistent with the LRU globals
+static uint32_t         SnapshotVersion[LRU_VERSION_COUNT];
+static uint8_t          SnapshotNodeState[NODE_HEALTH_COUNT];
+static uint8_t          SnapshotFaultClass[NODE_HEALTH_COUNT];
+
+//Snapshot destinations of the panels, indexed by PANEL_SLOT
+static uint64_t *const PanelStatusData[PANEL_SLOT_COUNT] = {
+    &_MCP.Status.Data, &_OCP.Status.Data, &_ICP.Status.Data,
+    &_LCP[LCP1LH].Status.Data, &_LCP[LCP2LH].Status.Data,
+    &_LCP[LCP3LH].Status.Data, &_LCP[LCP4LH].Status.Data,
+    &_LCP[LCP1RH].Status.Data, &_LCP[LCP2RH].Status.Data,
+    &_LCP[LCP3RH].Status.Data, &_LCP[LCP4RH].Status.Data};
+
+static uint64_t *const PanelCommandData[PANEL_SLOT_COUNT] = {
+    &_MCP.Command.Data, &_OCP.Command.Data, &_ICP.Command.Data,
+    &_LCP[LCP1LH].Command.Data, &_LCP[LCP2LH].Command.Data,
+    &_LCP[LCP3LH].Command.Data, &_LCP[LCP4LH].Command.Data,
+    &_LCP[LCP1RH].Command.Data, &_LCP[LCP2RH].Command.Data,
+    &_LCP[LCP3RH].Command.Data, &_LCP[LCP4RH].Command.Data};
+
+/************************ EXPORTED OPERATION DEFINITIONS *********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the LRU store
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+LRUStore::LRUStore()
+{
+    uint32_t Pos;
+
+    for(Pos = 0; Pos < PANEL_SLOT_COUNT; Pos++){
+        Data.PanelStatus[Pos].store(0, std::memory_order_relaxed);
+        Data.PanelCommand[Pos].store(0, std::memory_order_relaxed);
+    }
+    for(Pos = 0; Pos < PDU_MAX_COUNT; Pos++){
+        Data.PDUStatusMSG1[Pos].store(0, std::memory_order_relaxed);
+        Data.PDUStatusMSG2[Pos].store(0, std::memory_order_relaxed);
+        Data.PDUStatusMSG3[Pos].store(0, std::memory_order_relaxed);
+        Data.PDUPrepare[Pos].store(0, std::memory_order_relaxed);
+        Data.PDUMove[Pos].store(0, std::memory_order_relaxed);
+        Data.PDURetract[Pos].store(0, std::memory_order_relaxed);
+    }
+    for(Pos = 0; Pos < ULD_MAX_COUNT; Pos++){
+        Data.ULDStatus[Pos].store(0, std::memory_order_relaxed);
+    }
+    for(Pos = 0; Pos < LRU_VERSION_COUNT; Pos++){
+        Data.Version[Pos].store(0, std::memory_order_relaxed);
+    }
+    for(Pos = 0; Pos < NODE_HEALTH_COUNT; Pos++){
+        Data.NodeState[Pos].store(NODE_STATE_UNKNOWN, std::memory_order_relaxed);
+        Data.FaultClass[Pos].store(0, std::memory_order_relaxed);
+    }
+    Data.CargoZone.store(0, std::memory_order_relaxed);
+    Sequence.store(0, std::memory_order_relaxed);
+    WriteOpen = false;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Makes the sequence odd. The release fence keeps the data
+ *                stores that follow from becoming visible before it.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void LRUStore::BeginWrite()
+{
+    Sequence.store(Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    WriteOpen = true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Stores one word if it changed
+ *
+ *  Arguments   : Word of Data, new value
+ *
+ *  Return Value: true when the word changed
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool LRUStore::Store(std::atomic<uint64_t> &Word, uint64_t Value)
+{
+    //Only this thread writes, the relaxed load sees the last store
+    if(Word.load(std::memory_order_relaxed) == Value){
+        return false;
+    }
+    if(!WriteOpen){
+        BeginWrite();
+    }
+    Word.store(Value, std::memory_order_relaxed);
+    return true;
+}
+
+void LRUStore::BumpVersion(uint32_t Version)
+{
+    if(!WriteOpen){
+        BeginWrite();
+    }
+    Data.Version[Version].store(Data.Version[Version].load(std::memory_order_relaxed) + 1,
+                                std::memory_order_relaxed);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Closes the write window of the current batch
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void LRUStore::Commit()
+{
+    if(WriteOpen){
+        Sequence.store(Sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        WriteOpen = false;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copies a consistent state of the whole deck into the LRU
+ *                globals read by the pages. Gives up after
+ *                LRU_SNAPSHOT_RETRIES reads that overlapped a parser batch,
+ *                leaving the previous snapshot in place.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: true when the LRU globals were updated
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool LRUStore::Snapshot()
+{
+    //Staging copy, the globals only change once the copy is known to be consistent
+    static uint64_t PanelStatus[PANEL_SLOT_COUNT], PanelCommand[PANEL_SLOT_COUNT];
+    static uint64_t MSG1[PDU_MAX_COUNT], MSG2[PDU_MAX_COUNT], MSG3[PDU_MAX_COUNT];
+    static uint64_t Prepare[PDU_MAX_COUNT], Move[PDU_MAX_COUNT], Retract[PDU_MAX_COUNT];
+    static uint64_t ULDStatus[ULD_MAX_COUNT];
+    static uint32_t Version[LRU_VERSION_COUNT];
+    static uint8_t NodeState[NODE_HEALTH_COUNT], FaultClass[NODE_HEALTH_COUNT];
+    uint64_t CargoZone;
+    uint32_t Begin, Retry, Pos;
+
+    for(Retry = 0; Retry < LRU_SNAPSHOT_RETRIES; Retry++){
+        Begin = Sequence.load(std::memory_order_acquire);
+        if(Begin & 1){
+            continue;
+        }
+        for(Pos = 0; Pos < PANEL_SLOT_COUNT; Pos++){
+            PanelStatus[Pos] = Data.PanelStatus[Pos].load(std::memory_order_relaxed);
+            PanelCommand[Pos] = Data.PanelCommand[Pos].load(std::memory_order_relaxed);
+        }
+        for(Pos = 0; Pos < PDU_MAX_COUNT; Pos++){
+            MSG1[Pos] = Data.PDUStatusMSG1[Pos].load(std::memory_order_relaxed);
+            MSG2[Pos] = Data.PDUStatusMSG2[Pos].load(std::memory_order_relaxed);
+            MSG3[Pos] = Data.PDUStatusMSG3[Pos].load(std::memory_order_relaxed);
+            Prepare[Pos] = Data.PDUPrepare[Pos].load(std::memory_order_relaxed);
+            Move[Pos] = Data.PDUMove[Pos].load(std::memory_order_relaxed);
+            Retract[Pos] = Data.PDURetract[Pos].load(std::memory_order_relaxed);
+        }
+        for(Pos = 0; Pos < ULD_MAX_COUNT; Pos++){
+            ULDStatus[Pos] = Data.ULDStatus[Pos].load(std::memory_order_relaxed);
+        }
+        for(Pos = 0; Pos < LRU_VERSION_COUNT; Pos++){
+            Version[Pos] = Data.Version[Pos].load(std::memory_order_relaxed);
+        }
+        for(Pos = 0; Pos < NODE_HEALTH_COUNT; Pos++){
+            NodeState[Pos] = (uint8_t)Data.NodeState[Pos].load(std::memory_order_relaxed);
+            FaultClass[Pos] = (uint8_t)Data.FaultClass[Pos].load(std::memory_order_relaxed);
+        }
+        CargoZone = Data.CargoZone.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(Sequence.load(std::memory_order_relaxed) != Begin){
+            continue;
+        }
+
+        for(Pos = 0; Pos < PANEL_SLOT_COUNT; Pos++){
+            *PanelStatusData[Pos] = PanelStatus[Pos];
+            *PanelCommandData[Pos] = PanelCommand[Pos];
+        }
+        for(Pos = 0; Pos < PDU_MAX_COUNT; Pos++){
+            _PDU[Pos].StatusMSG1.Data = MSG1[Pos];
+            _PDU[Pos].StatusMSG2.Data = MSG2[Pos];
+            _PDU[Pos].StatusMSG3.Data = MSG3[Pos];
+            _PDU[Pos].PrepareData.Data = Prepare[Pos];
+            _PDU[Pos].MoveData.Data = Move[Pos];
+            _PDU[Pos].RetractData.Data = Retract[Pos];
+        }
+        for(Pos = 0; Pos < ULD_MAX_COUNT; Pos++){
+            _ULD[Pos].Data = ULDStatus[Pos];
+        }
+        for(Pos = 0; Pos < LRU_VERSION_COUNT; Pos++){
+            SnapshotVersion[Pos] = Version[Pos];
+        }
+        for(Pos = 0; Pos < NODE_HEALTH_COUNT; Pos++){
+            SnapshotNodeState[Pos] = NodeState[Pos];
+            SnapshotFaultClass[Pos] = FaultClass[Pos];
+        }
+        cargoZone.CargoZoneData.Data = (uint32_t)CargoZone;
+        return true;
+    }
+    return false;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : LRU version of the last snapshot
+ *
+ *  Arguments   : LRU version
+ *
+ *  Return Value: uint32_t
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t GetSnapshotVersion(uint32_t Version)
+{
+    return SnapshotVersion[Version];
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Node state of the last snapshot
+ *
+ *  Arguments   : Node (LRU version)
+ *
+ *  Return Value: NODE_STATE
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint8_t GetSnapshotNodeState(uint32_t Node)
+{
+    if(Node >= NODE_HEALTH_COUNT){
+        return NODE_STATE_UNKNOWN;
+    }
+    return SnapshotNodeState[Node];
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Fault class of the last snapshot
+ *
+ *  Arguments   : Node (LRU version)
+ *
+ *  Return Value: FAULT_CLASS
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint8_t GetSnapshotFaultClass(uint32_t Node)
+{
+    if(Node >= NODE_HEALTH_COUNT){
+        return 0;
+    }
+    return SnapshotFaultClass[Node];
+}
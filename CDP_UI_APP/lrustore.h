@@ -0,0 +1,133 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : lrustore.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef LRUSTORE_H
+#define LRUSTORE_H
+
+/****************************** HEADER FILES *********************************/
+#include <atomic>
+#include <cstdint>
+#include "candispatch.h"
+#include "nodehealth.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     LRU_SNAPSHOT_RETRIES    4           //Reads overlapping a parser batch before giving up a frame
+
+/*-----------------------------------------------------------------------------
+ *  Description : Decoded LRU state as written by the parser thread, one array
+ *                per message so every word of a kind is contiguous. Panels
+ *                are indexed by PANEL_SLOT, PDUs and ULDs by their slot.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct LRUStoreData{
+    std::atomic<uint64_t>   PanelStatus[PANEL_SLOT_COUNT];
+    std::atomic<uint64_t>   PanelCommand[PANEL_SLOT_COUNT];
+    std::atomic<uint64_t>   PDUStatusMSG1[PDU_MAX_COUNT];
+    std::atomic<uint64_t>   PDUStatusMSG2[PDU_MAX_COUNT];
+    std::atomic<uint64_t>   PDUStatusMSG3[PDU_MAX_COUNT];
+    std::atomic<uint64_t>   PDUPrepare[PDU_MAX_COUNT];
+    std::atomic<uint64_t>   PDUMove[PDU_MAX_COUNT];
+    std::atomic<uint64_t>   PDURetract[PDU_MAX_COUNT];
+    std::atomic<uint64_t>   ULDStatus[ULD_MAX_COUNT];
+    std::atomic<uint64_t>   CargoZone;
+    std::atomic<uint64_t>   NodeState[NODE_HEALTH_COUNT];          //NODE_STATE
+    std::atomic<uint64_t>   FaultClass[NODE_HEALTH_COUNT];         //FAULT_CLASS
+    std::atomic<uint32_t>   Version[LRU_VERSION_COUNT];
+};
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sequence locked LRU store between the parser thread (single
+ *                writer) and the UI thread (reader).
+ *
+ *                The writer opens a write window on the first change of a
+ *                batch and closes it in Commit, so a batch is published as a
+ *                whole. It never waits for the reader.
+ *
+ *                The reader copies the store and keeps the copy only if the
+ *                sequence was even and unchanged across it. All words are
+ *                atomics with relaxed ordering, so a 64 bit word is never torn
+ *                on the 32 bit or 64 bit ARM targets.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class LRUStore
+{
+public:
+    LRUStore();
+
+    //Parser thread
+    bool Store(std::atomic<uint64_t> &Word, uint64_t Value);
+    void BumpVersion(uint32_t Version);
+    void Commit();
+
+    //UI thread
+    bool Snapshot();
+
+    LRUStoreData        Data;
+
+private:
+    void BeginWrite();
+
+    alignas(64) std::atomic<uint32_t>   Sequence;
+    bool                                WriteOpen;          //Parser thread only
+};
+
+extern LRUStore lruStore;
+
+/*-----------------------------------------------------------------------------
+ *  Description : LRU version of the last snapshot taken by the UI thread
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t GetSnapshotVersion(uint32_t Version);
+
+/*-----------------------------------------------------------------------------
+ *  Description : NODE_STATE of a panel or PDU in the last snapshot, indexed by
+ *                its LRU version
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint8_t GetSnapshotNodeState(uint32_t Node);
+
+/*-----------------------------------------------------------------------------
+ *  Description : FAULT_CLASS of a panel or PDU in the last snapshot, indexed
+ *                by its LRU version
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint8_t GetSnapshotFaultClass(uint32_t Node);
+
+#endif // LRUSTORE_H
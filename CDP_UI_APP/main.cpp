@@ -0,0 +1,107 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : main.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : main function of the CDP OPSW. Creates thread for CAN Message
+ *                processing and Initializes the UI display.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+#include "cdpmainw.h"
+#include "canreadwrite.h"
+#include "parser.h"
+#include "displayrefresh.h"
+#include "nvmstorgae.h"
+#include "readout.h"
+#include "dataload.h"
+#include "trace.h"
+#include "powersupply.h"
+#include <QApplication>
+#include <QList>
+#include <QDebug>
+
+#include "common.h"
+
+
+int main(int argc, char *argv[])
+{
+    QApplication a(argc, argv);
+    int Result;
+
+    //Histograms are always kept, the dump socket is optional
+    if(!TraceOpen(nullptr)){
+        qDebug() << "Trace socket not opened";
+    }
+    //Recovered before the parser can raise faults, a missing NVM is not fatal
+    if(!NVMOpen(nullptr)){
+        qDebug() << "NVM journal not opened";
+    }
+    //Readouts are pulled on demand, the display runs without them
+    if(!ReadoutOpen(getenv(CAN_INTERFACE_ENV) ? getenv(CAN_INTERFACE_ENV) : CAN_INTERFACE_NAME)){
+        qDebug() << "Readout engine not started";
+    }
+    if(!DataloadOpen(getenv(CAN_INTERFACE_ENV) ? getenv(CAN_INTERFACE_ENV) : CAN_INTERFACE_NAME)){
+        qDebug() << "Dataload engine not started";
+    }
+    //Threshold crossings reach the pages through displayRefresh
+    PowerSupplySetSink(DisplayRefresh::PostSensorEvent);
+    if(!PowerSupplyOpen(getenv(POWER_SUPPLY_DEV_ENV))){
+        qDebug() << "Power supply sampling not started";
+    }
+    a.installEventFilter(&displayRefresh);
+    CDPMAINW w;
+    w.show();
+
+    ParserWorker parserWorker;
+    QObject::connect(&parserWorker, SIGNAL(BatchParsed()), &displayRefresh, SLOT(HandleBatchParsed()));
+    parserWorker.start();
+
+    //Receives on CAN_INTERFACE_NAME, or on CDP_CAN_IF for replay runs
+    CANReadWrite canReadWrite;
+    canReadWrite.start();
+
+    Result = a.exec();
+    //Both threads leave their loop within one wait period
+    canReadWrite.requestInterruption();
+    canReadWrite.wait();
+    parserWorker.requestInterruption();
+    parserWorker.wait();
+    PowerSupplyClose();
+    DataloadClose();
+    ReadoutClose();
+    NVMClose();
+    TraceClose();
+    return Result;
+}
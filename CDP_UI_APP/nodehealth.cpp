@@ -0,0 +1,345 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : nodehealth.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Tracks when every panel and PDU last sent its heartbeat message
+ *                and raises stale / lost events from a hashed timing wheel. The
+ *                parser only stamps the node on a frame, the wheel re-checks a
+ *                node when its deadline slot comes round, so a tick costs the
+ *                nodes due in it and never a scan of the deck.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "nodehealth.h"
+#include "lrustore.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     NODE_TICK_NS            ((uint64_t)NODE_WHEEL_TICK_MS * 1000000ULL)
+
+static_assert(NODE_HEALTH_COUNT < NODE_NONE, "Node links are 8 bit");
+static_assert((NODE_WHEEL_SLOTS & NODE_WHEEL_MASK) == 0, "Wheel size must be a power of 2");
+static_assert(NODE_STALE_TICKS < NODE_LOST_TICKS && NODE_LOST_TICKS < NODE_WHEEL_SLOTS,
+              "Deadlines must stay within one turn of the wheel");
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+NodeHealth              nodeHealth;
+
+/************************ LOCAL OPERATION DEFINITIONS *********************/
+
+//True when tick A is after tick B, wrap safe
+static inline bool TickAfter(uint32_t A, uint32_t B){
+    return (int32_t)(A - B) > 0;
+}
+
+/************************ EXPORTED OPERATION DEFINITIONS *********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the heartbeat tracker. Nodes
+ *                are armed by the first SetTime.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+NodeHealth::NodeHealth()
+{
+    uint32_t Pos;
+
+    CurrentNs = 0;
+    CurrentTick = 0;
+    WheelTick = 0;
+    Started = false;
+    for(Pos = 0; Pos < NODE_WHEEL_SLOTS; Pos++){
+        SlotHead[Pos] = NODE_NONE;
+    }
+    for(Pos = 0; Pos < NODE_HEALTH_COUNT; Pos++){
+        Next[Pos] = NODE_NONE;
+        Prev[Pos] = NODE_NONE;
+        Deadline[Pos] = 0;
+        LastHeard[Pos] = 0;
+        State[Pos] = NODE_STATE_UNKNOWN;
+        LastStamp[Pos] = 0;
+        NextSequence[Pos] = NODE_SEQUENCE_NONE;
+        Frames[Pos].store(0, std::memory_order_relaxed);
+        SequenceLost[Pos].store(0, std::memory_order_relaxed);
+        IntervalUs[Pos].store(0, std::memory_order_relaxed);
+        JitterUs[Pos].store(0, std::memory_order_relaxed);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Adds a node to the slot of its deadline
+ *
+ *-----------------------------------------------------------------------------
+ */
+void NodeHealth::Link(uint32_t Node, uint32_t Tick)
+{
+    uint8_t *Head = &SlotHead[Tick & NODE_WHEEL_MASK];
+
+    Deadline[Node] = Tick;
+    Prev[Node] = NODE_NONE;
+    Next[Node] = *Head;
+    if(*Head != NODE_NONE){
+        Prev[*Head] = (uint8_t)Node;
+    }
+    *Head = (uint8_t)Node;
+}
+
+void NodeHealth::Unlink(uint32_t Node)
+{
+    if(Prev[Node] != NODE_NONE){
+        Next[Prev[Node]] = Next[Node];
+    }
+    else{
+        SlotHead[Deadline[Node] & NODE_WHEEL_MASK] = Next[Node];
+    }
+    if(Next[Node] != NODE_NONE){
+        Prev[Next[Node]] = Prev[Node];
+    }
+    Next[Node] = NODE_NONE;
+    Prev[Node] = NODE_NONE;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Publishes a state change as a change of the node's LRU
+ *
+ *-----------------------------------------------------------------------------
+ */
+void NodeHealth::SetState(uint32_t Node, uint8_t NewState)
+{
+    State[Node] = NewState;
+    lruStore.Store(lruStore.Data.NodeState[Node], NewState);
+    MarkLRUChanged(Node);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Latches the time of the batch about to be parsed. The first
+ *                call arms every node, a node that never reports is lost
+ *                NODE_LOST_TICKS later.
+ *
+ *  Arguments   : Monotonic time in ns
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void NodeHealth::SetTime(uint64_t NowNs)
+{
+    uint32_t Pos;
+
+    CurrentNs = NowNs;
+    CurrentTick = (uint32_t)(NowNs / NODE_TICK_NS);
+
+    if(!Started){
+        WheelTick = CurrentTick;
+        for(Pos = 0; Pos < NODE_HEALTH_COUNT; Pos++){
+            LastHeard[Pos] = CurrentTick;
+            Link(Pos, CurrentTick + NODE_LOST_TICKS);
+        }
+        Started = true;
+    }
+    //After a long stall one turn visits every slot, and every deadline is due
+    else if((CurrentTick - WheelTick) > NODE_WHEEL_SLOTS){
+        WheelTick = CurrentTick - NODE_WHEEL_SLOTS;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Stamps a node on its heartbeat message and updates its
+ *                statistics. Only a node coming back is moved in the wheel.
+ *
+ *  Arguments   : Node (LRU version), receive time stamp in ns or 0
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void NodeHealth::Heard(uint32_t Node, uint64_t TimeStamp)
+{
+    int32_t Delta, Interval, Jitter, Deviation;
+    uint32_t Count;
+
+    if(Node >= NODE_HEALTH_COUNT){
+        return;
+    }
+
+    if(TimeStamp == 0){
+        TimeStamp = CurrentNs;
+    }
+    Count = Frames[Node].load(std::memory_order_relaxed) + 1;
+    Frames[Node].store(Count, std::memory_order_relaxed);
+    if(LastStamp[Node] != 0 && TimeStamp > LastStamp[Node]){
+        Delta = (int32_t)((TimeStamp - LastStamp[Node]) / 1000);
+        Interval = (int32_t)IntervalUs[Node].load(std::memory_order_relaxed);
+        if(Interval == 0){
+            Interval = Delta;
+        }
+        Deviation = (Delta > Interval) ? (Delta - Interval) : (Interval - Delta);
+        Interval += (Delta - Interval) / 8;
+        IntervalUs[Node].store((uint32_t)Interval, std::memory_order_relaxed);
+        Jitter = (int32_t)JitterUs[Node].load(std::memory_order_relaxed);
+        Jitter += (Deviation - Jitter) / 16;
+        JitterUs[Node].store((uint32_t)Jitter, std::memory_order_relaxed);
+    }
+    LastStamp[Node] = TimeStamp;
+
+    //A node back from LOST may have restarted, its sequence starts over
+    if(State[Node] == NODE_STATE_LOST){
+        NextSequence[Node] = NODE_SEQUENCE_NONE;
+    }
+
+    if(!Started){
+        return;
+    }
+    LastHeard[Node] = CurrentTick;
+    if(State[Node] != NODE_STATE_ALIVE){
+        if(State[Node] != NODE_STATE_LOST){
+            Unlink(Node);
+        }
+        Link(Node, CurrentTick + NODE_STALE_TICKS);
+        SetState(Node, NODE_STATE_ALIVE);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Checks a node whose deadline slot came round
+ *
+ *-----------------------------------------------------------------------------
+ */
+void NodeHealth::ExpireNode(uint32_t Node, uint32_t Tick)
+{
+    uint32_t Due;
+
+    if(State[Node] == NODE_STATE_ALIVE){
+        //Heard since it was armed, move it on to its new deadline
+        Due = LastHeard[Node] + NODE_STALE_TICKS;
+        if(TickAfter(Due, Tick)){
+            Link(Node, Due);
+            return;
+        }
+        SetState(Node, NODE_STATE_STALE);
+        Due = LastHeard[Node] + NODE_LOST_TICKS;
+        if(TickAfter(Due, Tick)){
+            Link(Node, Due);
+            return;
+        }
+    }
+    //Lost nodes stay out of the wheel until heard again
+    SetState(Node, NODE_STATE_LOST);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Runs the wheel up to the time of the last SetTime. Called
+ *                after the batch, so a node heard in it is never reported
+ *                stale first.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void NodeHealth::Expire()
+{
+    uint32_t Node, NextNode;
+
+    if(!Started){
+        return;
+    }
+    while(WheelTick != CurrentTick){
+        WheelTick++;
+        Node = SlotHead[WheelTick & NODE_WHEEL_MASK];
+        SlotHead[WheelTick & NODE_WHEEL_MASK] = NODE_NONE;
+        while(Node != NODE_NONE){
+            NextNode = Next[Node];
+            Next[Node] = NODE_NONE;
+            Prev[Node] = NODE_NONE;
+            ExpireNode(Node, WheelTick);
+            Node = NextNode;
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Counts the frames missing in front of one carrying the
+ *                sequence counter of its node. Called after Heard() for the
+ *                same frame.
+ *
+ *  Arguments   : Node (LRU version), sequence of the frame, counter modulo
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void NodeHealth::Sequence(uint32_t Node, uint8_t Value, uint8_t Modulo)
+{
+    uint8_t Missing;
+
+    if(Node >= NODE_HEALTH_COUNT || Modulo == 0){
+        return;
+    }
+    if(NextSequence[Node] != NODE_SEQUENCE_NONE && Value != NextSequence[Node]){
+        Missing = (uint8_t)((Value + Modulo - NextSequence[Node]) % Modulo);
+        SequenceLost[Node].store(SequenceLost[Node].load(std::memory_order_relaxed) + Missing,
+                                 std::memory_order_relaxed);
+    }
+    NextSequence[Node] = (uint8_t)((Value + 1) % Modulo);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Heartbeat statistics of one node
+ *
+ *  Arguments   : Node (LRU version), Stats (out)
+ *
+ *  Return Value: false when the node is not tracked
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool NodeHealth::GetNodeStats(uint32_t Node, NodeStats *Stats) const
+{
+    if(Node >= NODE_HEALTH_COUNT){
+        return false;
+    }
+    Stats->Frames = Frames[Node].load(std::memory_order_relaxed);
+    Stats->SequenceLost = SequenceLost[Node].load(std::memory_order_relaxed);
+    Stats->IntervalUs = IntervalUs[Node].load(std::memory_order_relaxed);
+    Stats->JitterUs = JitterUs[Node].load(std::memory_order_relaxed);
+    Stats->RateHz = (Stats->IntervalUs != 0) ? (1000000.0f / Stats->IntervalUs) : 0.0f;
+    return true;
+}
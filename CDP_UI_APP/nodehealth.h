@@ -0,0 +1,140 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : nodehealth.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef NODEHEALTH_H
+#define NODEHEALTH_H
+
+/****************************** HEADER FILES *********************************/
+#include <atomic>
+#include <cstdint>
+#include "candispatch.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+//Panels and PDUs, indexed by their LRU version
+#define     NODE_HEALTH_COUNT       LRU_VERSION_ULD
+#define     NODE_NONE               0xFF
+#define     NODE_SEQUENCE_NONE      0xFF        //No frame counted since start up or LOST
+
+#define     NODE_WHEEL_TICK_MS      20
+#define     NODE_WHEEL_SLOTS        128         //Must be a power of 2
+#define     NODE_WHEEL_MASK         (NODE_WHEEL_SLOTS - 1)
+#define     NODE_STALE_TICKS        25          //500 ms without a heartbeat
+#define     NODE_LOST_TICKS         100         //2000 ms without a heartbeat
+
+/********************* ENUMS  *****************************/
+//Ordered, every state from NODE_STATE_STALE on is drawn grey
+enum NODE_STATE {NODE_STATE_UNKNOWN = 0,        //Not heard since start up
+                 NODE_STATE_ALIVE,
+                 NODE_STATE_STALE,
+                 NODE_STATE_LOST};
+
+/********************* Structures  *****************************/
+/*-----------------------------------------------------------------------------
+ *  Description : Heartbeat statistics of one node. Interval and jitter are
+ *                smoothed as in RFC 3550, jitter being the mean deviation of
+ *                the interval from its average.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint32_t    Frames;
+    uint32_t    SequenceLost;       //Frames missing from the sequence counter
+    uint32_t    IntervalUs;
+    uint32_t    JitterUs;
+    float       RateHz;
+}NodeStats;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Heartbeat tracker of the parser thread.
+ *
+ *                Every node armed in the wheel sits in exactly one slot, the
+ *                one of its next deadline. Heard() only stamps the node, it
+ *                does not move it. When the slot of a node comes round the
+ *                node is checked against its stamp and either moved to its
+ *                new deadline or taken one state further. An alive node is
+ *                thus touched once per NODE_STALE_TICKS whatever its frame
+ *                rate, and a tick costs the nodes due in it.
+ *
+ *                Deadlines are never further out than NODE_LOST_TICKS, less
+ *                than one turn of the wheel, so a slot never holds nodes of a
+ *                later turn.
+ *
+ *                State changes go through the LRU store as node versions, so
+ *                the pages see them in the same snapshot as the LRU data.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class NodeHealth
+{
+public:
+    NodeHealth();
+
+    //Parser thread
+    void SetTime(uint64_t NowNs);
+    void Heard(uint32_t Node, uint64_t TimeStamp);
+    void Sequence(uint32_t Node, uint8_t Value, uint8_t Modulo);
+    void Expire();
+
+    //Any thread, fields are read one by one
+    bool GetNodeStats(uint32_t Node, NodeStats *Stats) const;
+
+private:
+    void Link(uint32_t Node, uint32_t Deadline);
+    void Unlink(uint32_t Node);
+    void SetState(uint32_t Node, uint8_t State);
+    void ExpireNode(uint32_t Node, uint32_t Tick);
+
+    uint64_t    CurrentNs;
+    uint32_t    CurrentTick;
+    uint32_t    WheelTick;                          //Last tick expired
+    bool        Started;
+    uint8_t     SlotHead[NODE_WHEEL_SLOTS];
+    uint8_t     Next[NODE_HEALTH_COUNT];
+    uint8_t     Prev[NODE_HEALTH_COUNT];
+    uint32_t    Deadline[NODE_HEALTH_COUNT];
+    uint32_t    LastHeard[NODE_HEALTH_COUNT];
+    uint8_t     State[NODE_HEALTH_COUNT];
+    uint64_t    LastStamp[NODE_HEALTH_COUNT];
+    uint8_t     NextSequence[NODE_HEALTH_COUNT];
+
+    std::atomic<uint32_t>   Frames[NODE_HEALTH_COUNT];
+    std::atomic<uint32_t>   SequenceLost[NODE_HEALTH_COUNT];
+    std::atomic<uint32_t>   IntervalUs[NODE_HEALTH_COUNT];
+    std::atomic<uint32_t>   JitterUs[NODE_HEALTH_COUNT];
+};
+
+extern NodeHealth nodeHealth;
+
+#endif // NODEHEALTH_H
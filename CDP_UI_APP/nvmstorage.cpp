@@ -0,0 +1,689 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : nvmstorage.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Append-only journal of the CDP NVM records in a memory mapped
+ *                file. Records are queued lock free by any thread and written by
+ *                one background thread, which syncs once per batch and checkpoints
+ *                the append point every NVM_CHECKPOINT_RECORDS records. At start up
+ *                the NVM image is rebuilt by scanning forward from the newest valid
+ *                checkpoint. Qt free, so it can be exercised against a plain file.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "nvmstorgae.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     NVM_JOURNAL_MAGIC       0x4A4D564E      //"NVMJ"
+#define     NVM_JOURNAL_VERSION     2               //2: Node ID in the fault record
+#define     NVM_SLOT_MAGIC          0x4A52          //"RJ"
+#define     NVM_QUEUE_MASK          (NVM_QUEUE_SIZE - 1)
+
+static_assert((NVM_QUEUE_SIZE & NVM_QUEUE_MASK) == 0, "NVM queue size must be a power of 2");
+//A batch is at most a full queue plus one carry over, the slot a checkpoint
+//points at must survive until the next one
+static_assert(NVM_CHECKPOINT_RECORDS + NVM_QUEUE_SIZE + NVM_CONFIG_RECORDS + NVM_FAULT_RECORDS + 2 < NVM_RECORD_SLOTS,
+              "Checkpointed records must not be overwritten before the next checkpoint");
+
+/********************* Structures  *****************************/
+typedef struct{
+    uint8_t     Type;
+    uint8_t     Length;
+    uint8_t     Payload[sizeof(((NVM_Journal_Slot *)0)->Payload)];
+}NVMQueueItem;
+
+typedef struct{
+    std::atomic<uint32_t>   Sequence;
+    NVMQueueItem            Item;
+}NVMQueueCell;
+
+typedef struct{
+    uint32_t    Table[256];
+}CRCTable;
+
+/************************** TABLE GENERATION *********************************/
+
+static constexpr CRCTable BuildCRCTable(){
+    CRCTable Table{};
+
+    for(uint32_t Pos = 0; Pos < 256; Pos++){
+        uint32_t Value = Pos;
+        for(uint32_t Bit = 0; Bit < 8; Bit++){
+            Value = (Value & 1) ? (0xEDB88320U ^ (Value >> 1)) : (Value >> 1);
+        }
+        Table.Table[Pos] = Value;
+    }
+    return Table;
+}
+
+static constexpr CRCTable CRC32Table = BuildCRCTable();
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+//Bounded multi producer / single consumer queue to the writer thread
+static NVMQueueCell             QueueCells[NVM_QUEUE_SIZE];
+static std::atomic<uint32_t>    QueueEnqueue(0);
+static uint32_t                 QueueDequeue = 0;           //Writer thread only
+static std::atomic<uint32_t>    DroppedCount(0);
+
+static std::atomic<bool>        Opened(false);
+static std::atomic<bool>        Running(false);
+static std::atomic<bool>        FlushRequested(false);
+static std::thread              Writer;
+static int                      JournalFD = -1;
+static int                      WakeFD = -1;
+static uint8_t                 *Journal = nullptr;
+
+//Writer thread only once open
+static uint32_t                 Generation;
+static uint32_t                 NextSequence;
+static uint32_t                 NextSlot;
+static uint32_t                 SinceCheckpoint;
+static bool                     CarryPending;
+static Power_Time_Record        CurrentPowerTime;
+
+//NVM image rebuilt from the journal, shared with NVMReadImage
+static std::mutex               ImageLock;
+static NVM_Layout               Image;
+static bool                     ConfigValid[NVM_CONFIG_RECORDS];
+static uint32_t                 FaultCount;
+static Power_Time_Record        PowerTime;
+static Power_Time_Record        LastPowerTime;
+
+/************************ LOCAL OPERATION DEFINITIONS *********************/
+
+static uint32_t CRC32(const uint8_t *Data, uint32_t Length){
+    uint32_t Value = 0xFFFFFFFFU;
+
+    while(Length--){
+        Value = CRC32Table.Table[(Value ^ *Data++) & 0xFF] ^ (Value >> 8);
+    }
+    return ~Value;
+}
+
+static uint64_t UTCNow(){
+    return (uint64_t)time(nullptr);
+}
+
+static NVM_Journal_Header *HeaderCopy(uint32_t Copy){
+    return (NVM_Journal_Header *)(Journal + (Copy * NVM_SLOT_SIZE));
+}
+
+static NVM_Journal_Slot *RecordSlot(uint32_t Slot){
+    return (NVM_Journal_Slot *)(Journal + ((NVM_HEADER_SLOTS + Slot) * NVM_SLOT_SIZE));
+}
+
+static uint32_t SlotCRC(const NVM_Journal_Slot *Slot){
+    NVM_Journal_Slot Copy = *Slot;
+
+    Copy.CRC = 0;
+    return CRC32((const uint8_t *)&Copy, sizeof(Copy));
+}
+
+static bool SlotValid(uint32_t Slot, uint32_t Sequence){
+    const NVM_Journal_Slot *Record = RecordSlot(Slot);
+
+    return (Record->Magic == NVM_SLOT_MAGIC && Record->Sequence == Sequence &&
+            Record->Length <= sizeof(Record->Payload) && Record->CRC == SlotCRC(Record));
+}
+
+static bool HeaderValid(const NVM_Journal_Header *Header){
+    NVM_Journal_Header Copy = *Header;
+
+    Copy.CRC = 0;
+    return (Header->Magic == NVM_JOURNAL_MAGIC && Header->Version == NVM_JOURNAL_VERSION &&
+            Header->SlotSize == NVM_SLOT_SIZE && Header->RecordSlots == NVM_RECORD_SLOTS &&
+            Header->NextSlot < NVM_RECORD_SLOTS && Header->NextSequence != 0 &&
+            Header->CRC == CRC32((const uint8_t *)&Copy, sizeof(Copy)));
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Producer side of the writer queue
+ *
+ *  Arguments   : Item
+ *
+ *  Return Value: false when the queue is full
+ *
+ *-----------------------------------------------------------------------------
+ */
+static bool QueuePush(const NVMQueueItem &Item){
+    uint32_t Pos = QueueEnqueue.load(std::memory_order_relaxed);
+    NVMQueueCell *Cell;
+    int32_t Diff;
+
+    while(1){
+        Cell = &QueueCells[Pos & NVM_QUEUE_MASK];
+        Diff = (int32_t)(Cell->Sequence.load(std::memory_order_acquire) - Pos);
+        if(Diff == 0){
+            if(QueueEnqueue.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed)){
+                break;
+            }
+        }
+        else if(Diff < 0){
+            return false;
+        }
+        else{
+            Pos = QueueEnqueue.load(std::memory_order_relaxed);
+        }
+    }
+    Cell->Item = Item;
+    Cell->Sequence.store(Pos + 1, std::memory_order_release);
+    return true;
+}
+
+static bool QueuePop(NVMQueueItem *Item){
+    NVMQueueCell *Cell = &QueueCells[QueueDequeue & NVM_QUEUE_MASK];
+
+    if(Cell->Sequence.load(std::memory_order_acquire) != QueueDequeue + 1){
+        return false;
+    }
+    *Item = Cell->Item;
+    Cell->Sequence.store(QueueDequeue + NVM_QUEUE_SIZE, std::memory_order_release);
+    QueueDequeue++;
+    return true;
+}
+
+static bool QueueRecord(uint8_t Type, const void *Record, uint8_t Length){
+    NVMQueueItem Item;
+    uint64_t One = 1;
+
+    if(!Opened.load(std::memory_order_acquire)){
+        return false;
+    }
+    Item.Type = Type;
+    Item.Length = Length;
+    memcpy(Item.Payload, Record, Length);
+    if(!QueuePush(Item)){
+        DroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if(write(WakeFD, &One, sizeof(One)) < 0){
+        /* Counter saturated, writer is awake anyway */
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Applies one journal record to the NVM image
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void ApplyRecord(const NVM_Journal_Slot *Record){
+    std::lock_guard<std::mutex> Lock(ImageLock);
+    Config_Record_Layout Config;
+    Fault_Record_Layout Fault;
+
+    switch(Record->Type){
+    case NVM_RECORD_CONFIG:
+        memcpy(&Config, Record->Payload, sizeof(Config));
+        if(Config.RecordNumber >= 1 && Config.RecordNumber <= NVM_CONFIG_RECORDS){
+            Image.ConfigRecord[Config.RecordNumber - 1] = Config;
+            ConfigValid[Config.RecordNumber - 1] = true;
+        }
+        break;
+
+    case NVM_RECORD_FAULT:
+        //Older than the table, or replaced already by a carried over copy
+        if(Record->Index + NVM_FAULT_RECORDS < FaultCount){
+            break;
+        }
+        memcpy(&Fault, Record->Payload, sizeof(Fault));
+        Image.FaultRecord[Record->Index % NVM_FAULT_RECORDS] = Fault;
+        if(Record->Index >= FaultCount){
+            FaultCount = Record->Index + 1;
+        }
+        break;
+
+    case NVM_RECORD_POWER_TIME:
+        memcpy(&PowerTime, Record->Payload, sizeof(PowerTime));
+        break;
+
+    default:
+        break;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Writes the append point into the older checkpoint copy, so
+ *                a torn checkpoint leaves the other one in place
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void WriteCheckpoint(){
+    NVM_Journal_Header Header;
+
+    memset(&Header, 0, sizeof(Header));
+    Generation++;
+    Header.Magic = NVM_JOURNAL_MAGIC;
+    Header.Version = NVM_JOURNAL_VERSION;
+    Header.SlotSize = NVM_SLOT_SIZE;
+    Header.RecordSlots = NVM_RECORD_SLOTS;
+    Header.Generation = Generation;
+    Header.NextSequence = NextSequence;
+    Header.NextSlot = NextSlot;
+    Header.CRC = CRC32((const uint8_t *)&Header, sizeof(Header));
+    memcpy(HeaderCopy(Generation % NVM_HEADER_SLOTS), &Header, sizeof(Header));
+    SinceCheckpoint = 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Appends one record at the append point. Wrapping round to
+ *                the first slot arms a carry over of the live records.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void AppendRecord(uint8_t Type, uint32_t Index, const void *Record, uint8_t Length){
+    NVM_Journal_Slot Slot;
+
+    memset(&Slot, 0, sizeof(Slot));
+    Slot.Magic = NVM_SLOT_MAGIC;
+    Slot.Type = Type;
+    Slot.Length = Length;
+    Slot.Sequence = NextSequence;
+    Slot.Index = Index;
+    memcpy(Slot.Payload, Record, Length);
+    Slot.CRC = SlotCRC(&Slot);
+    memcpy(RecordSlot(NextSlot), &Slot, sizeof(Slot));
+    ApplyRecord(&Slot);
+
+    NextSequence++;
+    SinceCheckpoint++;
+    if(++NextSlot == NVM_RECORD_SLOTS){
+        NextSlot = 0;
+        CarryPending = true;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Appends a copy of every live record once per turn of the
+ *                journal, so the oldest config and fault records are never
+ *                the ones about to be overwritten. Costs at most
+ *                NVM_CONFIG_RECORDS + NVM_FAULT_RECORDS + 1 slots per turn.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void CarryOver(){
+    uint32_t Pos, Index;
+
+    CarryPending = false;
+    for(Pos = 0; Pos < NVM_CONFIG_RECORDS; Pos++){
+        if(ConfigValid[Pos]){
+            AppendRecord(NVM_RECORD_CONFIG, 0, &Image.ConfigRecord[Pos], sizeof(Config_Record_Layout));
+        }
+    }
+    Index = (FaultCount > NVM_FAULT_RECORDS) ? (FaultCount - NVM_FAULT_RECORDS) : 0;
+    for(; Index < FaultCount; Index++){
+        AppendRecord(NVM_RECORD_FAULT, Index, &Image.FaultRecord[Index % NVM_FAULT_RECORDS],
+                     sizeof(Fault_Record_Layout));
+    }
+    AppendRecord(NVM_RECORD_POWER_TIME, 0, &CurrentPowerTime, sizeof(Power_Time_Record));
+}
+
+static void AppendQueued(const NVMQueueItem &Item){
+    Fault_Record_Layout Fault;
+    uint32_t Index = 0;
+
+    if(Item.Type == NVM_RECORD_FAULT){
+        //Fault numbers are given in journal order, by the writer only
+        memcpy(&Fault, Item.Payload, sizeof(Fault));
+        Index = FaultCount;
+        Fault.RecordNumber = (uint8_t)((Index % NVM_FAULT_RECORDS) + 1);
+        AppendRecord(Item.Type, Index, &Fault, sizeof(Fault));
+    }
+    else{
+        AppendRecord(Item.Type, Index, Item.Payload, Item.Length);
+    }
+    if(CarryPending){
+        CarryOver();
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Makes the records and checkpoint written so far durable.
+ *                On Linux the page cache is shared with the mapping, so
+ *                fdatasync also writes the pages dirtied through it.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void SyncJournal(){
+    if(fdatasync(JournalFD) < 0){
+        /* Retried with the next batch */
+    }
+}
+
+static void FormatJournal(){
+    memset(Journal, 0, NVM_JOURNAL_SIZE);
+    Generation = 0;
+    NextSequence = 1;
+    NextSlot = 0;
+    WriteCheckpoint();
+    SyncJournal();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Finds the append point by scanning forward from the newest
+ *                valid checkpoint, then rebuilds the NVM image from the
+ *                records still in the journal, oldest first. Nothing is
+ *                rewritten except one new checkpoint.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void RecoverJournal(){
+    const NVM_Journal_Header *Newest = nullptr;
+    uint32_t Copy, Scanned, Sequence, Count;
+
+    for(Copy = 0; Copy < NVM_HEADER_SLOTS; Copy++){
+        if(HeaderValid(HeaderCopy(Copy)) &&
+           (Newest == nullptr || (int32_t)(HeaderCopy(Copy)->Generation - Newest->Generation) > 0)){
+            Newest = HeaderCopy(Copy);
+        }
+    }
+    if(Newest == nullptr){
+        FormatJournal();
+        return;
+    }
+    Generation = Newest->Generation;
+    NextSequence = Newest->NextSequence;
+    NextSlot = Newest->NextSlot;
+
+    for(Scanned = 0; Scanned < NVM_RECORD_SLOTS && SlotValid(NextSlot, NextSequence); Scanned++){
+        NextSequence++;
+        NextSlot = (NextSlot + 1) % NVM_RECORD_SLOTS;
+    }
+
+    Count = (NextSequence - 1 < NVM_RECORD_SLOTS) ? (NextSequence - 1) : NVM_RECORD_SLOTS;
+    for(Sequence = NextSequence - Count; Sequence != NextSequence; Sequence++){
+        uint32_t Slot = (NextSlot + NVM_RECORD_SLOTS - (NextSequence - Sequence)) % NVM_RECORD_SLOTS;
+        if(SlotValid(Slot, Sequence)){
+            ApplyRecord(RecordSlot(Slot));
+        }
+    }
+    LastPowerTime = PowerTime;
+
+    WriteCheckpoint();
+    SyncJournal();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Writer thread. Drains the queue, appends the power time
+ *                every NVM_POWER_TIME_PERIOD_S and syncs once per batch, so
+ *                a burst of faults costs one fdatasync.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void WriterThread(){
+    struct pollfd Fd = {WakeFD, POLLIN, 0};
+    uint64_t NextPowerTime = UTCNow(), Now, Value;
+    NVMQueueItem Item;
+    uint32_t Appended;
+    bool Stopping;
+
+    while(1){
+        Now = UTCNow();
+        Stopping = !Running.load(std::memory_order_acquire);
+        if(!Stopping && poll(&Fd, 1, (NextPowerTime > Now) ? (int)((NextPowerTime - Now) * 1000) : 0) > 0){
+            if(read(WakeFD, &Value, sizeof(Value)) < 0){
+                /* Interrupted, the queue is drained anyway */
+            }
+        }
+
+        Appended = 0;
+        while(QueuePop(&Item)){
+            AppendQueued(Item);
+            Appended++;
+        }
+        Now = UTCNow();
+        if(Now >= NextPowerTime || Stopping){
+            CurrentPowerTime.EndTime = Now;
+            AppendRecord(NVM_RECORD_POWER_TIME, 0, &CurrentPowerTime, sizeof(CurrentPowerTime));
+            if(CarryPending){
+                CarryOver();
+            }
+            NextPowerTime = Now + NVM_POWER_TIME_PERIOD_S;
+            Appended++;
+        }
+        if(Appended){
+            SyncJournal();
+        }
+        //The checkpoint only ever points at records already synced
+        if(SinceCheckpoint >= NVM_CHECKPOINT_RECORDS ||
+           FlushRequested.exchange(false) || Stopping){
+            WriteCheckpoint();
+            SyncJournal();
+        }
+        if(Stopping){
+            break;
+        }
+    }
+}
+
+/************************ EXPORTED OPERATION DEFINITIONS *********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens and recovers the journal and starts the writer
+ *
+ *  Arguments   : Journal path or null
+ *
+ *  Return Value: false when the journal could not be opened
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool NVMOpen(const char *Path){
+    struct stat Info;
+    uint32_t Pos;
+    void *Map;
+
+    if(Opened.load(std::memory_order_acquire)){
+        return true;
+    }
+    if(Path == nullptr){
+        Path = getenv(NVM_JOURNAL_PATH_ENV);
+    }
+    if(Path == nullptr){
+        Path = NVM_JOURNAL_PATH;
+    }
+
+    JournalFD = open(Path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if(JournalFD < 0){
+        return false;
+    }
+    if(fstat(JournalFD, &Info) < 0 ||
+       (Info.st_size != NVM_JOURNAL_SIZE && ftruncate(JournalFD, NVM_JOURNAL_SIZE) < 0)){
+        close(JournalFD);
+        JournalFD = -1;
+        return false;
+    }
+    Map = mmap(nullptr, NVM_JOURNAL_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, JournalFD, 0);
+    WakeFD = eventfd(0, EFD_CLOEXEC);
+    if(Map == MAP_FAILED || WakeFD < 0){
+        if(Map != MAP_FAILED){
+            munmap(Map, NVM_JOURNAL_SIZE);
+        }
+        if(WakeFD >= 0){
+            close(WakeFD);
+            WakeFD = -1;
+        }
+        close(JournalFD);
+        JournalFD = -1;
+        return false;
+    }
+    Journal = (uint8_t *)Map;
+
+    for(Pos = 0; Pos < NVM_QUEUE_SIZE; Pos++){
+        QueueCells[Pos].Sequence.store(Pos, std::memory_order_relaxed);
+    }
+    QueueEnqueue.store(0, std::memory_order_relaxed);
+    QueueDequeue = 0;
+    memset(&Image, 0, sizeof(Image));
+    memset(ConfigValid, 0, sizeof(ConfigValid));
+    memset(&PowerTime, 0, sizeof(PowerTime));
+    memset(&LastPowerTime, 0, sizeof(LastPowerTime));
+    FaultCount = 0;
+    SinceCheckpoint = 0;
+    CarryPending = false;
+    //A file of another size was just truncated and fails the checkpoint check
+    RecoverJournal();
+
+    memset(&CurrentPowerTime, 0, sizeof(CurrentPowerTime));
+    CurrentPowerTime.PowerUpTime = UTCNow();
+    CurrentPowerTime.CityCode = PowerTime.CityCode;
+    CurrentPowerTime.NodeId = PowerTime.NodeId;
+
+    Running.store(true, std::memory_order_release);
+    Opened.store(true, std::memory_order_release);
+    Writer = std::thread(WriterThread);
+    return true;
+}
+
+void NVMClose(){
+    uint64_t One = 1;
+
+    if(!Opened.exchange(false)){
+        return;
+    }
+    Running.store(false, std::memory_order_release);
+    if(write(WakeFD, &One, sizeof(One)) < 0){
+        /* Writer checks Running on its next wake up */
+    }
+    Writer.join();
+    munmap(Journal, NVM_JOURNAL_SIZE);
+    Journal = nullptr;
+    close(WakeFD);
+    close(JournalFD);
+    WakeFD = -1;
+    JournalFD = -1;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Queues one fault record, time stamped now
+ *
+ *  Arguments   : Fault ID, Node ID and City code of the faulty LRU
+ *
+ *  Return Value: false when the record was dropped
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool NVMLogFault(uint8_t FSID, uint8_t NodeID, uint32_t CityCode){
+    Fault_Record_Layout Record;
+
+    memset(&Record, 0, sizeof(Record));
+    Record.FSID = FSID;
+    Record.NodeID = NodeID;
+    Record.UTC = UTCNow();
+    Record.CityCode = CityCode;
+    return QueueRecord(NVM_RECORD_FAULT, &Record, sizeof(Record));
+}
+
+bool NVMLogConfig(const Config_Record_Layout &Record){
+    if(Record.RecordNumber < 1 || Record.RecordNumber > NVM_CONFIG_RECORDS){
+        return false;
+    }
+    return QueueRecord(NVM_RECORD_CONFIG, &Record, sizeof(Record));
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Requests a sync and checkpoint from the writer thread
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: false when the journal is not open
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool NVMUpdate(){
+    uint64_t One = 1;
+
+    if(!Opened.load(std::memory_order_acquire)){
+        return false;
+    }
+    FlushRequested.store(true, std::memory_order_release);
+    if(write(WakeFD, &One, sizeof(One)) < 0){
+        /* Counter saturated, writer is awake anyway */
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copies the NVM image, with its header counts and checksum
+ *
+ *  Arguments   : Image (out), Power time of the previous power cycle (out)
+ *
+ *  Return Value: false when the journal is not open
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool NVMReadImage(NVM_Layout *Copy, Power_Time_Record *PreviousPowerTime){
+    std::lock_guard<std::mutex> Lock(ImageLock);
+    const uint8_t *Byte;
+    uint8_t Sum = 0;
+    uint32_t Pos;
+
+    if(!Opened.load(std::memory_order_acquire)){
+        return false;
+    }
+    *Copy = Image;
+    Copy->NVMHeader.ConfRecordCount = 0;
+    for(Pos = 0; Pos < NVM_CONFIG_RECORDS; Pos++){
+        Copy->NVMHeader.ConfRecordCount += ConfigValid[Pos] ? 1 : 0;
+    }
+    Copy->NVMHeader.FaultRecordCount = (uint8_t)((FaultCount < NVM_FAULT_RECORDS) ? FaultCount : NVM_FAULT_RECORDS);
+    Byte = (const uint8_t *)&Copy->NVMHeader;
+    for(Pos = 0; Pos < offsetof(NVM_Header_Layout, HeaderCheckSum); Pos++){
+        Sum += Byte[Pos];
+    }
+    Copy->NVMHeader.HeaderCheckSum = (uint8_t)(0x100 - Sum);
+    if(PreviousPowerTime != nullptr){
+        *PreviousPowerTime = LastPowerTime;
+    }
+    return true;
+}
+
+uint32_t NVMGetDroppedCount(){
+    return DroppedCount.load(std::memory_order_relaxed);
+}
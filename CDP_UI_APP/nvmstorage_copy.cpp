@@ -0,0 +1,9 @@
+#ifndef NVMSTORAGE_CPP
+#define NVMSTORAGE_CPP
+
+#include "common.h"
+
+
+
+
+#endif // NVMSTORAGE_CPP
@@ -0,0 +1,191 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : nvmstorgae.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef NVMSTORGAE_H
+#define NVMSTORGAE_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+#include "nvmcontent.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     NVM_JOURNAL_PATH            "/home/ancra/nvm/cdp_nvm.jnl"
+#define     NVM_JOURNAL_PATH_ENV        "CDP_NVM_PATH"  //e.g. a plain file for host runs
+#define     NVM_SLOT_SIZE               64
+#define     NVM_HEADER_SLOTS            2               //Two checkpoint copies, written in turn
+#define     NVM_RECORD_SLOTS            1024
+#define     NVM_JOURNAL_SIZE            ((NVM_HEADER_SLOTS + NVM_RECORD_SLOTS) * NVM_SLOT_SIZE)
+#define     NVM_CONFIG_RECORDS          5
+#define     NVM_FAULT_RECORDS           50
+#define     NVM_QUEUE_SIZE              256             //Must be a power of 2
+#define     NVM_CHECKPOINT_RECORDS      64              //Records between two checkpoints
+#define     NVM_POWER_TIME_PERIOD_S     60
+
+/********************* ENUMS  *****************************/
+enum NVM_RECORD_TYPE {NVM_RECORD_NONE = 0,
+                      NVM_RECORD_CONFIG,
+                      NVM_RECORD_FAULT,
+                      NVM_RECORD_POWER_TIME};
+
+/********************* Structures  *****************************/
+
+typedef struct{
+    uint8_t  ConfRecordCount;
+    uint8_t  FaultRecordCount;
+    uint8_t  Spare[3];
+    uint8_t  HeaderCheckSum;
+}NVM_Header_Layout;
+
+typedef struct{
+    uint8_t RecordNumber;
+    uint64_t HWFIN;
+    uint8_t SWFIN[12];
+    uint32_t MSN;
+    uint32_t CityCode;
+    uint8_t  NodeID;
+}Config_Record_Layout;
+
+typedef struct{
+    uint8_t HeaderStart;
+    uint8_t DLRequestFlag;
+    uint8_t DLALRUID;
+    uint8_t InformationChecksum;
+}DL_Information_Layout;
+
+typedef struct{
+    uint8_t RecordNumber;
+    uint8_t FSID;
+    uint8_t NodeID;                 //CAN Node ID of the faulty LRU
+    uint64_t UTC;
+    uint32_t CityCode;
+}Fault_Record_Layout;
+
+typedef struct{
+    NVM_Header_Layout       NVMHeader;
+    Config_Record_Layout    ConfigRecord[5];
+    DL_Information_Layout   DLInfo;
+    Fault_Record_Layout     FaultRecord[NVM_FAULT_RECORDS];
+}NVM_Layout;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Checkpoint of the journal, the append point at the time it
+ *                was written. Recovery scans forward from the newest valid
+ *                copy.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint32_t    Magic;
+    uint16_t    Version;
+    uint16_t    SlotSize;
+    uint32_t    RecordSlots;
+    uint32_t    Generation;
+    uint32_t    NextSequence;
+    uint32_t    NextSlot;
+    uint32_t    CRC;
+}NVM_Journal_Header;
+
+/*-----------------------------------------------------------------------------
+ *  Description : One journal record. The CRC covers the whole slot with the
+ *                CRC field zeroed, a slot torn by a power loss never passes.
+ *                Index is the running fault number of a fault record, so
+ *                copies carried over a wrap of the journal replace the same
+ *                entry.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint16_t    Magic;
+    uint8_t     Type;
+    uint8_t     Length;
+    uint32_t    Sequence;
+    uint32_t    CRC;
+    uint32_t    Index;
+    uint8_t     Payload[NVM_SLOT_SIZE - 16];
+}NVM_Journal_Slot;
+
+static_assert(sizeof(NVM_Journal_Header) <= NVM_SLOT_SIZE, "Journal header must fit a slot");
+static_assert(sizeof(NVM_Journal_Slot) == NVM_SLOT_SIZE, "Journal slot layout changed");
+static_assert(sizeof(Config_Record_Layout) <= sizeof(((NVM_Journal_Slot *)0)->Payload) &&
+              sizeof(Fault_Record_Layout) <= sizeof(((NVM_Journal_Slot *)0)->Payload) &&
+              sizeof(Power_Time_Record) <= sizeof(((NVM_Journal_Slot *)0)->Payload),
+              "NVM records must fit a journal slot");
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens the journal, recovers the NVM image from it and starts
+ *                the writer thread. A missing or foreign file is formatted.
+ *                Path may be null for NVM_JOURNAL_PATH_ENV or the default.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool NVMOpen(const char *Path);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Stops the writer after it wrote the queued records, the
+ *                power time and a checkpoint
+ *
+ *-----------------------------------------------------------------------------
+ */
+void NVMClose();
+
+/*-----------------------------------------------------------------------------
+ *  Description : Queue a record for the writer thread. Never block, any
+ *                thread may call them. Return false when the journal is not
+ *                open or the queue is full, the record is then counted as
+ *                dropped.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool NVMLogFault(uint8_t FSID, uint8_t NodeID, uint32_t CityCode);
+bool NVMLogConfig(const Config_Record_Layout &Record);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Asks the writer to sync and checkpoint the journal now
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool NVMUpdate();
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copy of the NVM image and of the power time record of the
+ *                previous power cycle
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool NVMReadImage(NVM_Layout *Image, Power_Time_Record *LastPowerTime);
+
+uint32_t NVMGetDroppedCount();
+
+#endif // NVMSTORGAE_H
@@ -0,0 +1,149 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : panelimage.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "panelimage.h"
+#include "commondata.h"
+#include <QHash>
+#include <QImage>
+#include <QPalette>
+#include <QResource>
+#include <QFileInfo>
+#include <QWidget>
+#include <QDebug>
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static QHash<QString, QPixmap>  Backgrounds;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Frees the inflated resource once the image using it is gone
+ *
+ *  Arguments   : QByteArray holding the baked image
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void ReleaseBakedImage(void *Data)
+{
+    delete static_cast<QByteArray *>(Data);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Wraps a baked image from the resources, the scanlines are
+ *                used in place
+ *
+ *  Arguments   : Resource path
+ *
+ *  Return Value: Image, null when the resource is missing or not valid
+ *
+ *-----------------------------------------------------------------------------
+ */
+static QImage LoadBakedImage(const QString &Path)
+{
+    QResource Resource(Path);
+    QByteArray *Data;
+    const PANEL_IMAGE_HEADER *Header;
+
+    if(!Resource.isValid()){
+        return QImage();
+    }
+#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
+    Data = new QByteArray(Resource.uncompressedData());
+#else
+    if(Resource.isCompressed()){
+        Data = new QByteArray(qUncompress(Resource.data(), (int)Resource.size()));
+    }
+    else {
+        Data = new QByteArray(QByteArray::fromRawData((const char *)Resource.data(), (int)Resource.size()));
+    }
+#endif
+    Header = (const PANEL_IMAGE_HEADER *)Data->constData();
+    if(Data->size() < (int)sizeof(PANEL_IMAGE_HEADER) || Header->Magic != PANEL_IMAGE_MAGIC ||
+            (Header->Format != QImage::Format_RGB32 && Header->Format != QImage::Format_ARGB32_Premultiplied) ||
+            Header->BytesPerLine < (uint32_t)Header->Width * 4 ||
+            (uint64_t)Data->size() < sizeof(PANEL_IMAGE_HEADER) + (uint64_t)Header->BytesPerLine * Header->Height){
+        qDebug() << "Baked image not valid" << Path;
+        delete Data;
+        return QImage();
+    }
+    return QImage((const uchar *)Data->constData() + sizeof(PANEL_IMAGE_HEADER), Header->Width, Header->Height,
+                  (int)Header->BytesPerLine, (QImage::Format)Header->Format, ReleaseBakedImage, Data);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Returns the panel sized background of the given PNG name
+ *
+ *  Arguments   : PNG file name
+ *
+ *  Return Value: Shared pixmap
+ *
+ *-----------------------------------------------------------------------------
+ */
+QPixmap GetPanelBackground(const QString &Name)
+{
+    QHash<QString, QPixmap>::iterator Background = Backgrounds.find(Name);
+    QImage Image;
+
+    if(Background != Backgrounds.end()){
+        return Background.value();
+    }
+    Image = LoadBakedImage(PANEL_IMAGE_FOLDER + QFileInfo(Name).completeBaseName() + PANEL_IMAGE_SUFFIX);
+    if(Image.isNull()){
+        //Not baked into this build, decode and scale at run time
+        Image = QImage(BaseFolder + Name);
+        if(Image.size() != QSize(PANEL_WIDTH, PANEL_HEIGHT)){
+            Image = Image.scaled(PANEL_WIDTH, PANEL_HEIGHT, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+        }
+    }
+    return Backgrounds.insert(Name, QPixmap::fromImage(Image)).value();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sets the background of a page
+ *
+ *  Arguments   : Page, PNG file name
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void SetPageBackground(QWidget *Page, const QString &Name)
+{
+    QPalette Palette;
+
+    Palette.setBrush(QPalette::Window, GetPanelBackground(Name));
+    Page->setPalette(Palette);
+}
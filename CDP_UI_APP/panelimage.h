@@ -0,0 +1,90 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : panelimage.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef PANELIMAGE_H
+#define PANELIMAGE_H
+
+/****************************** HEADER FILES *********************************/
+#include <QPixmap>
+#include <QString>
+#include <cstdint>
+
+class QWidget;
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     PANEL_WIDTH             1920
+#define     PANEL_HEIGHT            1080
+#define     PANEL_IMAGE_MAGIC       0x49504443U     //"CDPI"
+#define     PANEL_IMAGE_SUFFIX      ".cdpi"
+#define     PANEL_IMAGE_FOLDER      ":/images/baked/"
+
+/*-----------------------------------------------------------------------------
+ *  Description : Page background baked at build time by tools/imagebake.
+ *                The PNG is scaled to the panel once on the build host and
+ *                stored as the raw scanlines of the QImage format the raster
+ *                paint engine draws without a conversion, RGB32 when it is
+ *                opaque. rcc deflates it into the binary, so loading costs an
+ *                inflate instead of a PNG decode, a scale and a conversion.
+ *
+ *-----------------------------------------------------------------------------
+ */
+struct PANEL_IMAGE_HEADER{
+    uint32_t    Magic;
+    uint16_t    Width;
+    uint16_t    Height;
+    uint32_t    Format;                 //QImage::Format
+    uint32_t    BytesPerLine;
+};
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Returns the panel sized background of the given PNG name.
+ *                The baked image is used when the build has it, otherwise the
+ *                PNG under BaseFolder is decoded and scaled. Each background
+ *                is loaded once and shared by every page showing it.
+ *
+ *-----------------------------------------------------------------------------
+ */
+QPixmap GetPanelBackground(const QString &Name);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sets the background of a page
+ *
+ *-----------------------------------------------------------------------------
+ */
+void SetPageBackground(QWidget *Page, const QString &Name);
+
+#endif // PANELIMAGE_H
@@ -0,0 +1,193 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : parser.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Implementation of validating anf parsing the CAN Messages recieved
+ *                All messages received are parsed and respective signals of LRUs
+ *                are updated accordibgly
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "parser.h"
+#include "candispatch.h"
+#include "lrustore.h"
+#include "nodehealth.h"
+#include "trace.h"
+#include <QDebug>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+CANRingBuffer        canBuffer;
+
+bool ValidateNodeID(){
+    return true;
+}
+
+
+bool ValidateFunctionID(){
+    return true;
+}
+
+bool ValidateCRC(){
+    return true;
+}
+
+
+/*-----------------------------------------------------------------------------
+ *  Description : Validates one received frame and updates the signals of the
+ *                LRU messages it carries
+ *
+ *  Arguments   : CAN Message
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ParseMessage(const CAN_DATA &CANPayload){
+    const struct canfd_frame &Frame = CANPayload.Frame;
+    ARBITRATION_FIELD Arbitration;
+    uint8_t FunctionID, NodeID;
+
+    //Error and remote frames carry no LRU data
+    if(Frame.can_id & (CAN_ERR_FLAG | CAN_RTR_FLAG)){
+        return;
+    }
+
+    //Validate Node ID
+    if(ValidateNodeID()){
+        //Validate CRC
+        if(ValidateCRC()){
+            //Validate Function_ID
+            if(ValidateFunctionID()){
+                Arbitration.Data = Frame.can_id & CAN_EFF_MASK;
+                FunctionID = Arbitration.Bits.FuntionIdentifier;
+                NodeID = Arbitration.Bits.NodeIdentifier;
+                TRACE_FRAME(FunctionID);
+                //Decoded in place, a CAN-FD frame may carry several messages
+                if(!DispatchFrame(FunctionID, NodeID, PayloadView(Frame.data, Frame.len),
+                                  CANPayload.TimeStamp, CANPayload.WallTime)){
+                    TRACE_INVALID(FunctionID);
+                }
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Drains the CAN ring buffer in batches of PARSER_BATCH_SIZE
+ *                messages and parses each of them. Every batch is committed
+ *                to the LRU store as a whole.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ParserThread(){
+    static CAN_DATA Batch[PARSER_BATCH_SIZE];
+    uint32_t Count, Pos;
+
+    do{
+        Count = canBuffer.PopBatch(Batch, PARSER_BATCH_SIZE);
+        TRACE_BEGIN(Start);
+        for(Pos = 0; Pos < Count; Pos++){
+            TRACE_AGE(Batch[Pos].TimeStamp);
+            ParseMessage(Batch[Pos]);
+        }
+        //Keeps the write window to one batch so the UI snapshot gets a gap
+        lruStore.Commit();
+        if(Count > 0){
+            TRACE_END(TRACE_DECODE, Start, Count);
+        }
+    }while(Count == PARSER_BATCH_SIZE);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the Parser thread
+ *
+ *  Arguments   : Parent Class
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+ParserWorker::ParserWorker(QObject *parent) : QThread(parent)
+{
+
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the main thread funcationlity of Parser thread. Runs
+ *                on its own core and drains the CAN ring buffer every time the
+ *                CAN thread signals a new batch. The UI is woken once per
+ *                batch, only if the batch changed LRU data. A silent bus
+ *                still wakes it every wheel tick to expire the node
+ *                heartbeats.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ParserWorker::run(){
+    cpu_set_t CpuSet;
+    struct timespec Now;
+    bool Changed;
+
+    CPU_ZERO(&CpuSet);
+    CPU_SET(PARSER_CPU_CORE, &CpuSet);
+    if(pthread_setaffinity_np(pthread_self(), sizeof(CpuSet), &CpuSet) != 0){
+        qDebug() << "Parser thread affinity not set";
+    }
+
+    while(!isInterruptionRequested()){
+        canBuffer.WaitFor(NODE_WHEEL_TICK_MS);
+        clock_gettime(CLOCK_MONOTONIC, &Now);
+        nodeHealth.SetTime(((uint64_t)Now.tv_sec * 1000000000ULL) + Now.tv_nsec);
+        ParserThread();
+        nodeHealth.Expire();
+        TRACE_BEGIN(PublishStart);
+        Changed = PublishLRUChanges();
+        TRACE_END(TRACE_PUBLISH, PublishStart, Changed);
+        if(Changed){
+            emit BatchParsed();
+        }
+    }
+}
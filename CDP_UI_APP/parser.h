@@ -0,0 +1,77 @@
+
+
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : parser.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef PARSER_H
+#define PARSER_H
+
+
+#include <QList>
+#include <QThread>
+#include "common.h"
+#include "canringbuffer.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     PARSER_BATCH_SIZE       64
+#define     PARSER_CPU_CORE         1
+
+bool ValidateNodeID();
+bool ValidateCRC();
+
+
+bool ValidateFunctionID();
+
+
+bool GetPayloadData(CAN_DATA *data);
+
+void ParseMessage(const CAN_DATA &CANPayload);
+
+void ParserThread();
+
+class ParserWorker : public QThread
+{
+    Q_OBJECT
+
+public:
+    ParserWorker(QObject *parent=0);
+    void run();
+
+signals:
+    //One per drained batch that changed LRU data, see PublishLRUChanges
+    void BatchParsed();
+};
+
+#endif // PARSER_H
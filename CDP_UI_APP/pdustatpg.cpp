@@ -0,0 +1,578 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : pdustatuspage.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : The CDP OPSW to manage all fields in the PDU status display
+ *                Provides tabular information on the status of the PDU Signals
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "pdustatpg.h"
+#include "ui_pdustatpg.h"
+#include "panelimage.h"
+#include "common.h"
+#include "displayrefresh.h"
+#include "tablecell.h"
+#include "lrustore.h"
+#include "faultevents.h"
+#include <QString>
+#include <QDebug>
+
+PDUStatPg::PDUStatPg(QWidget *parent) :
+    QDialog(parent),
+    ui(new Ui::PDUStatPg)
+{
+    ui->setupUi(this);
+
+    PDUNum = 0;
+    DisplayedPDU = -1;
+
+    SetPageBackground(this, "PDUStatusPgBkg.png");
+    BackButton = new QPushButton("", this);
+
+    BackButton->setGeometry(QRect(QPoint(PDU_BK_BTN_X, PDU_BK_BTN_Y), QSize(PDU_BK_BTN_WT, PDU_BK_BTN_HT)));
+    QPixmap BackButtonBkg(BaseFolder + "BackButton.png");
+    QIcon BackButtonIcon(BackButtonBkg.scaled(PDU_BK_BTN_WT, PDU_BK_BTN_HT,Qt::KeepAspectRatio));
+    BackButton->setIcon(BackButtonIcon);
+    BackButton->setIconSize(BackButtonBkg.rect().size());
+    connect(BackButton, &QPushButton::released, this, &PDUStatPg::HandleBackButton);
+
+
+    connect(&displayRefresh, SIGNAL(LRUDataChanged(quint32)), this, SLOT(UpdateUI(quint32)));
+
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Navigation implementation to Cont Monitoring screen
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void PDUStatPg::HandleBackButton(){
+    CurrPage = PrevPage;
+    PrevPage = PDU_STATUS;
+    hide();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Updates the status table when the shown PDU changed or a
+ *                different PDU was selected
+ *
+ *  Arguments   : LRU_CHANGED groups
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void PDUStatPg::UpdateUI(quint32 ChangedGroups)
+{
+    //Every section page owns a PDU Status page, only the visible one redraws
+    if((ChangedGroups & LRU_CHANGED_PDU) == 0 || !isVisible()){
+        return;
+    }
+
+    if(DisplayedPDU != PDUNum){
+        DisplayedPDU = PDUNum;
+        Versions.Invalidate();
+        SetCell(ui->PDUTable1, ROW0, COLUMN1, PDUName);
+    }
+
+    if(CurrPage == PDU_STATUS && Versions.Changed(LRU_VERSION_PDU + PDUNum)){
+        //Classified by the fault event stage when the fault bits changed
+        uint8_t FaultClass = GetSnapshotFaultClass(LRU_VERSION_PDU + PDUNum);
+        bool PDUAbnormal = (FaultClass == FAULT_CLASS_ABNORMAL);
+
+        //Geneal Status
+        if(FaultClass == FAULT_CLASS_FAULTY){
+            //Set General Status to Faulty
+            SetCell(ui->PDUTable1, ROW3, COLUMN1, QStringLiteral("Faulty"));
+        }
+        else if(PDUAbnormal == TRUE){
+
+            //Set General Status to Abnormal
+            SetCell(ui->PDUTable1, ROW3, COLUMN1, QStringLiteral("Abnormal"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY &&
+               ICD_PDU_Status_MSG3::PDU_Roller_Speed::Value(_PDU[PDUNum].StatusMSG3.Data) > 0 ){
+            //Set General Status to Driving & Healthy
+            SetCell(ui->PDUTable1, ROW3, COLUMN1, QStringLiteral("Driving & Healthy"));
+
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY){
+            //Set General Status to Healthy'
+            SetCell(ui->PDUTable1, ROW3, COLUMN1, QStringLiteral("Healthy"));
+        }
+        else if(ICD_PDU_Status_MSG3::PDU_Roller_Speed::Value(_PDU[PDUNum].StatusMSG3.Data) > 0 && PDUAbnormal == 1){
+            //Set General Status toDriving and Abnormal
+            SetCell(ui->PDUTable1, ROW3, COLUMN1, QStringLiteral("Driving & Abnormal"));
+        }
+        else{
+             SetCell(ui->PDUTable1, ROW3, COLUMN1, QStringLiteral("xxxxxxx"));
+        }
+
+
+        //PDU Type
+        if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Type == PDU_TYPE::SELF_LIFT){
+            //Set to Self Lift
+            SetCell(ui->PDUTable1, ROW2, COLUMN1, QStringLiteral("Self Lift"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Type == PDU_TYPE::SPRING_LOADED){
+            //Set to Spring Loaded
+            SetCell(ui->PDUTable1, ROW2, COLUMN1, QStringLiteral("Spring Loaded"));
+        }
+        else {
+            SetCell(ui->PDUTable1, ROW2, COLUMN1, QStringLiteral("xxxxxxxxx"));
+        }
+
+        //Hold/Release Indicator
+        if(_PDU[PDUNum].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::HOLD_ACTIVE){
+            SetCell(ui->PDUTable1, ROW4, COLUMN1, QStringLiteral("Hold"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Hold_Status == PDU_HOLD_STATUS::RELEASE_ACTIVE){
+            SetCell(ui->PDUTable1, ROW4, COLUMN1, QStringLiteral("Released"));
+        }
+        else {
+            SetCell(ui->PDUTable1, ROW4, COLUMN1, QStringLiteral("xxxxxxxxx"));
+        }
+
+        //Lift Status Indicator
+        if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Roller_Position == PDU_ROLLER_POSITION::DEFAULT){
+            SetCell(ui->PDUTable1, ROW5, COLUMN1, QStringLiteral("Default"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Roller_Position == PDU_ROLLER_POSITION::FULLY_LIFT){
+            SetCell(ui->PDUTable1, ROW5, COLUMN1, QStringLiteral("Fully Lift"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Roller_Position == PDU_ROLLER_POSITION::HOME){
+            SetCell(ui->PDUTable1, ROW5, COLUMN1, QStringLiteral("Home"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Roller_Position == PDU_ROLLER_POSITION::PARTITAL_LIFT){
+            SetCell(ui->PDUTable1, ROW5, COLUMN1, QStringLiteral("Partial Lift"));
+        }
+        else {
+            SetCell(ui->PDUTable1, ROW5, COLUMN1, QStringLiteral("xxxxxxxxx"));
+        }
+
+        //Health Status
+        if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::DEFAULT){
+            SetCell(ui->PDUTable1, ROW6, COLUMN1, QStringLiteral("Default"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::NOT_HEALTHY){
+            SetCell(ui->PDUTable1, ROW6, COLUMN1, QStringLiteral("Not Healthy"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Health_Status == PDU_HEALTH_STATUS::OVERALL_HEALTHY){
+            SetCell(ui->PDUTable1, ROW6, COLUMN1, QStringLiteral("Overall Healthy"));
+        }
+        else {
+            SetCell(ui->PDUTable1, ROW6, COLUMN1, QStringLiteral("xxxxxxxxx"));
+        }
+
+        //Cover Status
+        if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Cover_Status == PDU_COVER_STATUS::COVERED){
+            SetCell(ui->PDUTable1, ROW7, COLUMN1, QStringLiteral("Covered"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Cover_Status == PDU_COVER_STATUS::DEFAULT){
+            SetCell(ui->PDUTable1, ROW7, COLUMN1, QStringLiteral("Default"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Cover_Status == PDU_COVER_STATUS::NOT_COVERED){
+            SetCell(ui->PDUTable1, ROW7, COLUMN1, QStringLiteral("Not Covered"));
+        }
+        else {
+            SetCell(ui->PDUTable1, ROW7, COLUMN1, QStringLiteral("xxxxxxxxx"));
+        }
+
+        //PDU_MODE
+        if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Mode == PDU_MODE::BIT_MODE){
+            SetCell(ui->PDUTable1, ROW8, COLUMN1, QStringLiteral("BIT_MODE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Mode == PDU_MODE::DL_MODE){
+            SetCell(ui->PDUTable1, ROW8, COLUMN1, QStringLiteral("DL_MODE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Mode == PDU_MODE::INIT_MODE){
+            SetCell(ui->PDUTable1, ROW8, COLUMN1, QStringLiteral("INIT_MODE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Mode == PDU_MODE::OFF_MODE){
+            SetCell(ui->PDUTable1, ROW8, COLUMN1, QStringLiteral("OFF_MODE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_Mode == PDU_MODE::OP_MODE){
+            SetCell(ui->PDUTable1, ROW8, COLUMN1, QStringLiteral("OP_MODE"));
+        }
+        else {
+            SetCell(ui->PDUTable1, ROW8, COLUMN1, QStringLiteral("xxxxxxxxx"));
+        }
+
+        //PDU State
+
+        if(_PDU[PDUNum].StatusMSG1.Signal.PDU_State == PDU_STATE::LIFT_BRAKE){
+            SetCell(ui->PDUTable1, ROW9, COLUMN1, QStringLiteral("PDU_ST_LIFT_BRAKE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_State == PDU_STATE::LIFT_DRIVE){
+            SetCell(ui->PDUTable1, ROW9, COLUMN1, QStringLiteral("PDU_ST_LIFT_DRIVE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_State == PDU_STATE::LIFT_HOLD){
+            SetCell(ui->PDUTable1, ROW9, COLUMN1, QStringLiteral("PDU_ST_LIFT_HOLD"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_State == PDU_STATE::POWERUP){
+            SetCell(ui->PDUTable1, ROW9, COLUMN1, QStringLiteral("PDU_ST_POWER_UP"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_State == PDU_STATE::REGENERATIVE){
+            SetCell(ui->PDUTable1, ROW9, COLUMN1, QStringLiteral("PDU_ST_REGENERATIVE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_State == PDU_STATE::RETRACT_HOLD){
+            SetCell(ui->PDUTable1, ROW9, COLUMN1, QStringLiteral("PDU_ST_RETRACT_HOLD"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_State == PDU_STATE::STANDBY){
+            SetCell(ui->PDUTable1, ROW9, COLUMN1, QStringLiteral("PDU_ST_STANDBY"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.PDU_State == PDU_STATE::ST_FAULTY){
+            SetCell(ui->PDUTable1, ROW9, COLUMN1, QStringLiteral("PDU_ST_FAULTY"));
+        }
+        else {
+            SetCell(ui->PDUTable1, ROW9, COLUMN1, QStringLiteral("xxxxxxxxx"));
+        }
+
+        //DMM Mode
+        if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_Mode == DRIVE_MOTOR_MODE::DMM_HOLD){
+            SetCell(ui->PDUTable1, ROW10, COLUMN1, QStringLiteral("DMM_HOLD"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_Mode == DRIVE_MOTOR_MODE::DMM_MOTOR){
+            SetCell(ui->PDUTable1, ROW10, COLUMN1, QStringLiteral("DMM_MOTOR"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_Mode == DRIVE_MOTOR_MODE::DMM_STANDBY){
+            SetCell(ui->PDUTable1, ROW10, COLUMN1, QStringLiteral("DMM_STANDBY"));
+        }
+
+        //LM Mode
+        if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Mode == LIFT_MOTOR_MODE::LMM_IDLE){
+            SetCell(ui->PDUTable1, ROW11, COLUMN1, QStringLiteral("LMM_IDLE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Mode == LIFT_MOTOR_MODE::LMM_MOVE){
+            SetCell(ui->PDUTable1, ROW11, 1, QStringLiteral("LMM_MOVE"));
+        }
+
+        //DM State
+        if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_State == DRIVE_MOTOR_STATE::DM_ST_CHARGE){
+            SetCell(ui->PDUTable1, ROW12, COLUMN1, QStringLiteral("DM_ST_CHARGE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_State == DRIVE_MOTOR_STATE::DM_ST_FIX){
+            SetCell(ui->PDUTable1, ROW12, COLUMN1, QStringLiteral("DM_ST_FIX"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_State == DRIVE_MOTOR_STATE::DM_ST_IDLE){
+            SetCell(ui->PDUTable1, ROW12, COLUMN1, QStringLiteral("DM_ST_IDLE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_State == DRIVE_MOTOR_STATE::DM_ST_POS){
+            SetCell(ui->PDUTable1, ROW12, COLUMN1, QStringLiteral("DM_ST_POS"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_State == DRIVE_MOTOR_STATE::DM_ST_POWERUP){
+            SetCell(ui->PDUTable1, ROW12, COLUMN1, QStringLiteral("DM_ST_POWERUP"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_State == DRIVE_MOTOR_STATE::DM_ST_SC){
+            SetCell(ui->PDUTable1, ROW12, COLUMN1, QStringLiteral("DM_ST_SC"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_State == DRIVE_MOTOR_STATE::DM_ST_SPEED){
+            SetCell(ui->PDUTable1, ROW12, COLUMN1, QStringLiteral("DM_ST_SPEED"));
+        }
+
+        //LM Ctrl Seq State
+        if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_AWAIT_CONTAINER){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_AWAIT_CONTAINER"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_BW_DRV_CTRL){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_BW_DRV_CTRL"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_BW_DRV_DONE){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_BW_DRV_DONE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_FLT_STATE){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_FLT_STATE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_HOLD_UP_HI_FORCE){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_HOLD_UP_HI_FORCE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_HOLD_UP_LOW_FORCE){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_HOLD_UP_LOW_FORCE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_HOLD_UP_MED_FORCE){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_HOLD_UP_MED_FORCE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_RAISE_FAST){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_RAISE_FAST"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_RAISE_SLOW){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_RAISE_SLOW"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_RETRACTED){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_RETRACTED"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_RETRACTING_FAST){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_RETRACTING_FAST"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTLSEQ_RETRACTING_SLOW){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTLSEQ_RETRACTING_SLOW"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTRL_SEQ_GOHOME){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTRL_SEQ_GOHOME"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Control_Seq_State == LM_CTRL_SEQ_STATE::CTRL_SEQ_POWERUP){
+            SetCell(ui->PDUTable1, ROW13, COLUMN1, QStringLiteral("CTRL_SEQ_POWERUP"));
+        }
+
+        //LM State
+        if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_State == LIFT_MOTOR_STATE::LMM_MOVING){
+            SetCell(ui->PDUTable1, ROW14, COLUMN1, QStringLiteral("LMM_MOVING"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_State == LIFT_MOTOR_STATE::LMM_ST_CHARGE){
+            SetCell(ui->PDUTable1, ROW14, COLUMN1, QStringLiteral("LMM_ST_CHARGE"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_State == LIFT_MOTOR_STATE::LMM_ST_IDLE){
+            SetCell(ui->PDUTable1, ROW14, COLUMN1, QStringLiteral("LMM_ST_IDLE"));
+        }
+
+        //Active Direction
+        if(_PDU[PDUNum].StatusMSG1.Signal.Active_Drive_Command_Direction== PDU_DRIVE_COMMAND_DIR::DEFAULT){
+            SetCell(ui->PDUTable1, ROW15, COLUMN1, QStringLiteral("DEFAULT"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Active_Drive_Command_Direction== PDU_DRIVE_COMMAND_DIR::DIR_A){
+            SetCell(ui->PDUTable1, ROW15, COLUMN1, QStringLiteral("DIR_A"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Active_Drive_Command_Direction== PDU_DRIVE_COMMAND_DIR::DIR_B){
+            SetCell(ui->PDUTable1, ROW15, COLUMN1, QStringLiteral("DIR_B"));
+        }
+
+        //DM Curr Fault Mon Status
+        if(_PDU[PDUNum].StatusMSG1.Signal.DM_Current_Fault_Monitoring_Status== TRUE){
+            SetCell(ui->PDUTable1, ROW16, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.DM_Current_Fault_Monitoring_Status== FALSE){
+            SetCell(ui->PDUTable1, ROW16, COLUMN1, QStringLiteral("False"));
+        }
+
+        //LM Curr Fault Mon Status
+        if(_PDU[PDUNum].StatusMSG1.Signal.LM_Current_Fault_Monitoring_Status == TRUE){
+            SetCell(ui->PDUTable1, ROW17, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.LM_Current_Fault_Monitoring_Status == FALSE){
+            SetCell(ui->PDUTable1, ROW17, COLUMN1, QStringLiteral("False"));
+        }
+
+        //HVDC Over Voltage
+        if(_PDU[PDUNum].StatusMSG1.Signal.HVDC_Over_Voltage_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW0, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.HVDC_Over_Voltage_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW0, COLUMN1, QStringLiteral("False"));
+        }
+
+        //HVDC Under Voltage
+        if(_PDU[PDUNum].StatusMSG1.Signal.HVDC_Under_Voltage_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW1, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.HVDC_Under_Voltage_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW1, COLUMN1, QStringLiteral("False"));
+        }
+
+        //IGBT Protection Trip
+        if(_PDU[PDUNum].StatusMSG1.Signal.IGBT_Protection_Trip == TRUE){
+            SetCell(ui->PDUTable2, ROW2, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.IGBT_Protection_Trip == FALSE){
+            SetCell(ui->PDUTable2, ROW2, COLUMN1, QStringLiteral("False"));
+        }
+
+        //Board Over Temp
+        if(_PDU[PDUNum].StatusMSG1.Signal.Board_Over_Temperature_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW3, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Board_Over_Temperature_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW3, COLUMN1, QStringLiteral("False"));
+        }
+
+        //115VAC Phase
+        if(_PDU[PDUNum].StatusMSG1.Signal.VAC115_Phase_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW4, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.VAC115_Phase_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW4, COLUMN1, QStringLiteral("False"));
+        }
+
+        //Drive Motor Hall Sensor
+        if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_Hall_Sensor_State_Error == TRUE){
+            SetCell(ui->PDUTable2, ROW5, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_Hall_Sensor_State_Error == FALSE){
+            SetCell(ui->PDUTable2, ROW5, COLUMN1, QStringLiteral("False"));
+        }
+
+        //Lift Motor Hall Sensor
+        if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Hall_Sensor_State_Error == TRUE){
+            SetCell(ui->PDUTable2, ROW6, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_Hall_Sensor_State_Error == FALSE){
+            SetCell(ui->PDUTable2, ROW6, COLUMN1, QStringLiteral("False"));
+        }
+
+        //Drive Motor State Machine
+        if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_State_Machine_Error == TRUE){
+            SetCell(ui->PDUTable2, ROW7, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_State_Machine_Error == FALSE){
+            SetCell(ui->PDUTable2, ROW7, COLUMN1, QStringLiteral("False"));
+        }
+
+        //Lift Motor State Machine
+        if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_State_Machine_Error == TRUE){
+            SetCell(ui->PDUTable2, ROW8, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Motor_State_Machine_Error == FALSE){
+            SetCell(ui->PDUTable2, ROW8, COLUMN1, QStringLiteral("False"));
+        }
+
+        //Lift Mechanism
+        if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Mechanism_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW9, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Lift_Mechanism_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW9, COLUMN1, QStringLiteral("False"));
+        }
+
+        //CAN Address Pin Parity
+/*        if(_PDU[PDUNum].StatusMSG1.Signal.CAN_Address_Pin_Parity_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW10, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.CAN_Address_Pin_Parity_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW10, COLUMN1, QStringLiteral("False"));
+        }
+
+        //Program Integrity Check
+        if(_PDU[PDUNum].StatusMSG1.Signal.Program_Integrity_Check_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW11, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Program_Integrity_Check_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW11, COLUMN1, QStringLiteral("False"));
+        }
+
+        //RAM Fault
+        if(_PDU[PDUNum].StatusMSG1.Signal.RAM_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW12, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.RAM_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW12, COLUMN1, QStringLiteral("False"));
+        }
+
+        //NVM Fault
+        if(_PDU[PDUNum].StatusMSG1.Signal.NVM_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW13, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.NVM_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW13, COLUMN1, QStringLiteral("False"));
+        }
+
+        //HVDC Over Current
+        if(_PDU[PDUNum].StatusMSG1.Signal.HVDC_Over_Current_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW14, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.HVDC_Over_Current_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW14, COLUMN1, QStringLiteral("False"));
+        }
+*/
+        //ATRU Right Coil Over Temp
+        if(_PDU[PDUNum].StatusMSG1.Signal.ATRU_Right_Coil_Over_Temperature_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW15, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.ATRU_Right_Coil_Over_Temperature_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW15, COLUMN1, QStringLiteral("False"));
+        }
+
+        //ATRU Left Coil Over Temp
+        if(_PDU[PDUNum].StatusMSG1.Signal.ATRU_Left_Coil_Over_Temperature_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW16, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.ATRU_Left_Coil_Over_Temperature_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW16, COLUMN1, QStringLiteral("False"));
+        }
+
+        //Drive Motor Over Temperature
+        if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_Over_Temperature_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW17, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.Drive_Motor_Over_Temperature_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW17, COLUMN1, QStringLiteral("False"));
+        }
+
+        //IGBT Onchip over Temperature
+        if(_PDU[PDUNum].StatusMSG1.Signal.IGBT_Onchip_Over_Temperature_Fault == TRUE){
+            SetCell(ui->PDUTable2, ROW18, COLUMN1, QStringLiteral("True"));
+        }
+        else if(_PDU[PDUNum].StatusMSG1.Signal.IGBT_Onchip_Over_Temperature_Fault == FALSE){
+            SetCell(ui->PDUTable2, ROW18, COLUMN1, QStringLiteral("False"));
+        }
+
+        //Current Mux
+        SetCell(ui->PDUTable3, ROW0, COLUMN1, (qulonglong)ICD_PDU_Status_MSG2::Current_Mux::Value(_PDU[PDUNum].StatusMSG2.Data));
+
+        //Voltage Mux
+        SetCell(ui->PDUTable3, ROW1, COLUMN1, (qulonglong)ICD_PDU_Status_MSG2::Voltage_Mux::Value(_PDU[PDUNum].StatusMSG2.Data));
+
+        //Temp Mux
+        SetCell(ui->PDUTable3, ROW2, COLUMN1, (qulonglong)ICD_PDU_Status_MSG2::Temperature_Mux::Value(_PDU[PDUNum].StatusMSG2.Data));
+
+        //Measured Current
+        SetCell(ui->PDUTable3, ROW3, COLUMN1, (qulonglong)ICD_PDU_Status_MSG2::Measured_Current::Value(_PDU[PDUNum].StatusMSG2.Data));
+
+        //Measured Voltage
+        SetCell(ui->PDUTable3, ROW4, COLUMN1, (qulonglong)ICD_PDU_Status_MSG2::Measured_Voltage::Value(_PDU[PDUNum].StatusMSG2.Data));
+
+        //Measured Temp
+        SetCell(ui->PDUTable3, ROW5, COLUMN1, (qulonglong)ICD_PDU_Status_MSG2::Measured_Temperature::Value(_PDU[PDUNum].StatusMSG2.Data));
+
+        //Roller Speed
+        SetCell(ui->PDUTable3, ROW6, COLUMN1, (qulonglong)ICD_PDU_Status_MSG3::PDU_Roller_Speed::Value(_PDU[PDUNum].StatusMSG3.Data));
+
+        //LM Speed
+        SetCell(ui->PDUTable3, ROW7, COLUMN1, (qulonglong)ICD_PDU_Status_MSG3::PDU_LM_Speed::Value(_PDU[PDUNum].StatusMSG3.Data));
+
+        //LM HALL Count
+        SetCell(ui->PDUTable3, ROW8, COLUMN1, (qulonglong)ICD_PDU_Status_MSG3::PDU_LM_Hall_Count::Value(_PDU[PDUNum].StatusMSG3.Data));
+
+    }
+}
+PDUStatPg::~PDUStatPg()
+{
+    delete ui;
+}
@@ -0,0 +1,79 @@
+
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : pdustatuspage.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef PDUSTATPG_H
+#define PDUSTATPG_H
+
+#include <QDialog>
+#include <QTimer>
+#include <QPushButton>
+#include <QString>
+#include "candispatch.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define PDU_BK_BTN_WT       80
+#define PDU_BK_BTN_HT       80
+#define PDU_BK_BTN_X        60
+#define PDU_BK_BTN_Y        40
+
+
+namespace Ui {
+class PDUStatPg;
+}
+
+class PDUStatPg : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit PDUStatPg(QWidget *parent = 0);
+    ~PDUStatPg();
+
+    QString                 PDUName;
+    int                     PDUNum;
+
+private slots:
+    void UpdateUI(quint32 ChangedGroups);
+    void HandleBackButton();
+
+private:
+    Ui::PDUStatPg *ui;
+    LRUVersionView          Versions;
+    int                     DisplayedPDU;
+    QPushButton             *BackButton;
+};
+
+#endif // PDUSTATPG_H
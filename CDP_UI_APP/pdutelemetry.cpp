@@ -0,0 +1,470 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : pdutelemetry.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Keeps the current, voltage, temperature and speed trends of every PDU
+ *                from PDU Status MSG2 and MSG3: a raw ring and minute and quarter hour
+ *                min / max / average rollups per series, range queries and a binary
+ *                export.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "pdutelemetry.h"
+#include "lrudata.h"
+#include "icdsignals.h"
+#include <atomic>
+#include <cstdio>
+#include <climits>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     TELEMETRY_SERIES_PER_PDU    (TELEMETRY_CURRENT_MUX + TELEMETRY_VOLTAGE_MUX + TELEMETRY_TEMPERATURE_MUX + 2)
+#define     TELEMETRY_SERIES_COUNT      (PDU_MAX_COUNT * TELEMETRY_SERIES_PER_PDU)
+#define     TELEMETRY_ROLLUP_COUNT      (TELEMETRY_LEVEL_COUNT - 1)
+#define     TELEMETRY_NS_PER_MS         1000000ULL
+#define     TELEMETRY_TAG_USED          0x8000      //Tag of a bucket written at least once
+#define     TELEMETRY_TAG_MASK          0x7FFF
+
+static_assert(ICD_PDU_Status_MSG2::Current_Mux::Mask + 1 == TELEMETRY_CURRENT_MUX, "Current mux out of step with the ICD");
+static_assert(ICD_PDU_Status_MSG2::Voltage_Mux::Mask + 1 == TELEMETRY_VOLTAGE_MUX, "Voltage mux out of step with the ICD");
+static_assert(ICD_PDU_Status_MSG2::Temperature_Mux::Mask + 1 == TELEMETRY_TEMPERATURE_MUX,
+              "Temperature mux out of step with the ICD");
+static_assert((TELEMETRY_RAW_SIZE & (TELEMETRY_RAW_SIZE - 1)) == 0, "Raw ring size must be a power of 2");
+
+/********************* Structures  *****************************/
+/*-----------------------------------------------------------------------------
+ *  Description : One rollup level, a ring of TELEMETRY_ROLLUP_SIZE buckets
+ *                per series. Bucket n of a series sits in slot
+ *                n % TELEMETRY_ROLLUP_SIZE, tagged with the low bits of n so
+ *                a slot left over from an earlier lap is never taken for it.
+ *                The bucket still filling is only folded into its slot when
+ *                the first sample of a later bucket arrives.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    std::atomic<uint16_t>   Tag[TELEMETRY_SERIES_COUNT][TELEMETRY_ROLLUP_SIZE];
+    std::atomic<uint16_t>   Min[TELEMETRY_SERIES_COUNT][TELEMETRY_ROLLUP_SIZE];
+    std::atomic<uint16_t>   Max[TELEMETRY_SERIES_COUNT][TELEMETRY_ROLLUP_SIZE];
+    std::atomic<uint16_t>   Avg[TELEMETRY_SERIES_COUNT][TELEMETRY_ROLLUP_SIZE];
+
+    std::atomic<uint32_t>   Bucket[TELEMETRY_SERIES_COUNT];
+    std::atomic<uint32_t>   Count[TELEMETRY_SERIES_COUNT];       //0 when no bucket is filling
+    std::atomic<uint16_t>   FillMin[TELEMETRY_SERIES_COUNT];
+    std::atomic<uint16_t>   FillMax[TELEMETRY_SERIES_COUNT];
+    std::atomic<uint64_t>   FillSum[TELEMETRY_SERIES_COUNT];
+}TelemetryRollup;
+
+typedef struct{
+    std::atomic<uint32_t>   Sequence[TELEMETRY_SERIES_COUNT];    //Odd while the parser writes the series
+    std::atomic<uint32_t>   RawHead[TELEMETRY_SERIES_COUNT];
+    std::atomic<uint32_t>   RawTime[TELEMETRY_SERIES_COUNT][TELEMETRY_RAW_SIZE];     //ms from Epoch
+    std::atomic<uint16_t>   RawValue[TELEMETRY_SERIES_COUNT][TELEMETRY_RAW_SIZE];
+    TelemetryRollup         Rollup[TELEMETRY_ROLLUP_COUNT];
+}TelemetryColumns;
+
+/*************************** REGISTRATIONS *********************************/
+
+//First series of every channel within the series of a PDU
+static constexpr uint32_t ChannelBase[TELEMETRY_CHANNEL_COUNT] = {
+    0,
+    TELEMETRY_CURRENT_MUX,
+    TELEMETRY_CURRENT_MUX + TELEMETRY_VOLTAGE_MUX,
+    TELEMETRY_CURRENT_MUX + TELEMETRY_VOLTAGE_MUX + TELEMETRY_TEMPERATURE_MUX,
+    TELEMETRY_CURRENT_MUX + TELEMETRY_VOLTAGE_MUX + TELEMETRY_TEMPERATURE_MUX + 1};
+
+static constexpr uint32_t MuxCount[TELEMETRY_CHANNEL_COUNT] = {
+    TELEMETRY_CURRENT_MUX, TELEMETRY_VOLTAGE_MUX, TELEMETRY_TEMPERATURE_MUX, 1, 1};
+
+static constexpr uint32_t WidthMs[TELEMETRY_LEVEL_COUNT] = {
+    0, TELEMETRY_MINUTE_MS, TELEMETRY_QUARTER_MS};
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static TelemetryColumns         Columns;
+static std::atomic<uint64_t>    Epoch(0);           //Wall time of the first sample
+static std::atomic<bool>        Started(false);
+
+/************************ LOCAL OPERATION DEFINITIONS ***********************/
+
+static inline uint32_t SeriesOf(uint8_t Slot, uint8_t Channel, uint32_t Mux){
+    return (uint32_t)Slot * TELEMETRY_SERIES_PER_PDU + ChannelBase[Channel] + Mux;
+}
+
+static uint32_t MsSinceEpoch(uint64_t TimeStamp){
+    uint64_t Start = Epoch.load(std::memory_order_relaxed);
+    uint64_t Ms;
+
+    if(TimeStamp <= Start){
+        return 0;
+    }
+    Ms = (TimeStamp - Start) / TELEMETRY_NS_PER_MS;
+    return (Ms > UINT32_MAX) ? UINT32_MAX : (uint32_t)Ms;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Closes the filling bucket of one level into its slot
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void CloseBucket(TelemetryRollup &Level, uint32_t Series, uint32_t Bucket, uint32_t Count){
+    uint32_t Slot = Bucket % TELEMETRY_ROLLUP_SIZE;
+
+    Level.Tag[Series][Slot].store((uint16_t)(TELEMETRY_TAG_USED | (Bucket & TELEMETRY_TAG_MASK)), std::memory_order_relaxed);
+    Level.Min[Series][Slot].store(Level.FillMin[Series].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    Level.Max[Series][Slot].store(Level.FillMax[Series].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    Level.Avg[Series][Slot].store((uint16_t)(Level.FillSum[Series].load(std::memory_order_relaxed) / Count),
+                                  std::memory_order_relaxed);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Appends one sample to a series. A sample older than the
+ *                last one of the series is taken as at the time of the last
+ *                one, so the raw ring stays in time order.
+ *
+ *  Arguments   : Series, raw value, receive time stamp
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void AddSample(uint32_t Series, uint16_t Value, uint64_t TimeStamp){
+    uint32_t Sequence = Columns.Sequence[Series].load(std::memory_order_relaxed);
+    uint32_t Head = Columns.RawHead[Series].load(std::memory_order_relaxed);
+    uint32_t Ms = MsSinceEpoch(TimeStamp);
+    uint32_t Level, Bucket, Filling, Count;
+    uint16_t Min, Max;
+
+    if(Head != 0){
+        uint32_t Last = Columns.RawTime[Series][(Head - 1) & (TELEMETRY_RAW_SIZE - 1)].load(std::memory_order_relaxed);
+        Ms = (Ms < Last) ? Last : Ms;
+    }
+
+    Columns.Sequence[Series].store(Sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Columns.RawTime[Series][Head & (TELEMETRY_RAW_SIZE - 1)].store(Ms, std::memory_order_relaxed);
+    Columns.RawValue[Series][Head & (TELEMETRY_RAW_SIZE - 1)].store(Value, std::memory_order_relaxed);
+    Columns.RawHead[Series].store(Head + 1, std::memory_order_relaxed);
+
+    for(Level = 0; Level < TELEMETRY_ROLLUP_COUNT; Level++){
+        TelemetryRollup &Rollup = Columns.Rollup[Level];
+
+        Bucket = Ms / WidthMs[Level + 1];
+        Filling = Rollup.Bucket[Series].load(std::memory_order_relaxed);
+        Count = Rollup.Count[Series].load(std::memory_order_relaxed);
+
+        if(Count != 0 && Bucket > Filling){
+            CloseBucket(Rollup, Series, Filling, Count);
+            Count = 0;
+        }
+        if(Count == 0){
+            Rollup.Bucket[Series].store(Bucket, std::memory_order_relaxed);
+            Rollup.FillMin[Series].store(Value, std::memory_order_relaxed);
+            Rollup.FillMax[Series].store(Value, std::memory_order_relaxed);
+            Rollup.FillSum[Series].store(Value, std::memory_order_relaxed);
+        }
+        else{
+            Min = Rollup.FillMin[Series].load(std::memory_order_relaxed);
+            Max = Rollup.FillMax[Series].load(std::memory_order_relaxed);
+            if(Value < Min){
+                Rollup.FillMin[Series].store(Value, std::memory_order_relaxed);
+            }
+            if(Value > Max){
+                Rollup.FillMax[Series].store(Value, std::memory_order_relaxed);
+            }
+            Rollup.FillSum[Series].store(Rollup.FillSum[Series].load(std::memory_order_relaxed) + Value,
+                                         std::memory_order_relaxed);
+        }
+        Rollup.Count[Series].store(Count + 1, std::memory_order_relaxed);
+    }
+
+    Columns.Sequence[Series].store(Sequence + 2, std::memory_order_release);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Raw samples of a series between FromMs and ToMs. The first
+ *                one is found by a binary search of the ring.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static uint32_t CopyRaw(uint32_t Series, uint32_t FromMs, uint32_t ToMs,
+                        TelemetryPoint *Points, uint32_t Count){
+    uint64_t Start = Epoch.load(std::memory_order_relaxed);
+    uint32_t Head = Columns.RawHead[Series].load(std::memory_order_relaxed);
+    uint32_t Low = (Head > TELEMETRY_RAW_SIZE) ? Head - TELEMETRY_RAW_SIZE : 0;
+    uint32_t High = Head, Middle, Ms, Copied = 0;
+    uint16_t Value;
+
+    while(Low < High){
+        Middle = Low + (High - Low) / 2;
+        if(Columns.RawTime[Series][Middle & (TELEMETRY_RAW_SIZE - 1)].load(std::memory_order_relaxed) < FromMs){
+            Low = Middle + 1;
+        }
+        else{
+            High = Middle;
+        }
+    }
+    for(; Low < Head && Copied < Count; Low++){
+        Ms = Columns.RawTime[Series][Low & (TELEMETRY_RAW_SIZE - 1)].load(std::memory_order_relaxed);
+        if(Ms > ToMs){
+            break;
+        }
+        Value = Columns.RawValue[Series][Low & (TELEMETRY_RAW_SIZE - 1)].load(std::memory_order_relaxed);
+        Points[Copied].TimeStamp = Start + (uint64_t)Ms * TELEMETRY_NS_PER_MS;
+        Points[Copied].Min = Points[Copied].Max = Points[Copied].Avg = Value;
+        Copied++;
+    }
+    return Copied;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Buckets of one rollup level between FromMs and ToMs, the
+ *                closed ones from their slots and then the one filling
+ *
+ *-----------------------------------------------------------------------------
+ */
+static uint32_t CopyRollup(uint32_t Series, uint8_t Level, uint32_t FromMs, uint32_t ToMs,
+                           TelemetryPoint *Points, uint32_t Count){
+    const TelemetryRollup &Rollup = Columns.Rollup[Level - 1];
+    uint64_t Start = Epoch.load(std::memory_order_relaxed);
+    uint64_t Width = WidthMs[Level];
+    uint32_t Filling = Rollup.Bucket[Series].load(std::memory_order_relaxed);
+    uint32_t Samples = Rollup.Count[Series].load(std::memory_order_relaxed);
+    uint32_t First = FromMs / Width, Last = ToMs / Width;
+    uint32_t Bucket, Slot, Copied = 0;
+
+    if(Samples == 0){
+        return 0;
+    }
+    if(Filling >= TELEMETRY_ROLLUP_SIZE && First < Filling - (TELEMETRY_ROLLUP_SIZE - 1)){
+        First = Filling - (TELEMETRY_ROLLUP_SIZE - 1);
+    }
+    for(Bucket = First; Bucket < Filling && Bucket <= Last && Copied < Count; Bucket++){
+        Slot = Bucket % TELEMETRY_ROLLUP_SIZE;
+        if(Rollup.Tag[Series][Slot].load(std::memory_order_relaxed) !=
+           (uint16_t)(TELEMETRY_TAG_USED | (Bucket & TELEMETRY_TAG_MASK))){
+            continue;                           //No sample in that bucket
+        }
+        Points[Copied].TimeStamp = Start + (uint64_t)Bucket * Width * TELEMETRY_NS_PER_MS;
+        Points[Copied].Min = Rollup.Min[Series][Slot].load(std::memory_order_relaxed);
+        Points[Copied].Max = Rollup.Max[Series][Slot].load(std::memory_order_relaxed);
+        Points[Copied].Avg = Rollup.Avg[Series][Slot].load(std::memory_order_relaxed);
+        Copied++;
+    }
+    if(Filling >= First && Filling <= Last && Copied < Count){
+        Points[Copied].TimeStamp = Start + (uint64_t)Filling * Width * TELEMETRY_NS_PER_MS;
+        Points[Copied].Min = Rollup.FillMin[Series].load(std::memory_order_relaxed);
+        Points[Copied].Max = Rollup.FillMax[Series].load(std::memory_order_relaxed);
+        Points[Copied].Avg = (uint16_t)(Rollup.FillSum[Series].load(std::memory_order_relaxed) / Samples);
+        Copied++;
+    }
+    return Copied;
+}
+
+/************************ EXPORTED OPERATION DEFINITIONS ********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Demultiplexes a PDU Status MSG2 into its current, voltage
+ *                and temperature series
+ *
+ *  Arguments   : PDU slot, payload, software receive time
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void TelemetryIngestMSG2(uint8_t Slot, uint64_t Payload, uint64_t WallTime){
+    if(Slot >= PDU_MAX_COUNT){
+        return;
+    }
+    if(!Started.load(std::memory_order_relaxed)){
+        Epoch.store(WallTime, std::memory_order_relaxed);
+        Started.store(true, std::memory_order_release);
+    }
+    AddSample(SeriesOf(Slot, TELEMETRY_CURRENT, (uint32_t)ICD_PDU_Status_MSG2::Current_Mux::Get(Payload)),
+              (uint16_t)ICD_PDU_Status_MSG2::Measured_Current::Get(Payload), WallTime);
+    AddSample(SeriesOf(Slot, TELEMETRY_VOLTAGE, (uint32_t)ICD_PDU_Status_MSG2::Voltage_Mux::Get(Payload)),
+              (uint16_t)ICD_PDU_Status_MSG2::Measured_Voltage::Get(Payload), WallTime);
+    AddSample(SeriesOf(Slot, TELEMETRY_TEMPERATURE, (uint32_t)ICD_PDU_Status_MSG2::Temperature_Mux::Get(Payload)),
+              (uint16_t)ICD_PDU_Status_MSG2::Measured_Temperature::Get(Payload), WallTime);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Takes the roller and linear motor speeds of a PDU Status
+ *                MSG3
+ *
+ *  Arguments   : PDU slot, payload, software receive time
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void TelemetryIngestMSG3(uint8_t Slot, uint64_t Payload, uint64_t WallTime){
+    if(Slot >= PDU_MAX_COUNT){
+        return;
+    }
+    if(!Started.load(std::memory_order_relaxed)){
+        Epoch.store(WallTime, std::memory_order_relaxed);
+        Started.store(true, std::memory_order_release);
+    }
+    AddSample(SeriesOf(Slot, TELEMETRY_ROLLER_SPEED, 0),
+              (uint16_t)ICD_PDU_Status_MSG3::PDU_Roller_Speed::Get(Payload), WallTime);
+    AddSample(SeriesOf(Slot, TELEMETRY_LM_SPEED, 0),
+              (uint16_t)ICD_PDU_Status_MSG3::PDU_LM_Speed::Get(Payload), WallTime);
+}
+
+uint32_t TelemetryMuxCount(uint8_t Channel){
+    return (Channel < TELEMETRY_CHANNEL_COUNT) ? MuxCount[Channel] : 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copies the points of one series between two times
+ *
+ *  Arguments   : PDU slot, TELEMETRY_CHANNEL, mux value, TELEMETRY_LEVEL,
+ *                first and last time, point buffer and its size
+ *
+ *  Return Value: Points copied
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t TelemetryQuery(uint8_t PDU, uint8_t Channel, uint8_t Mux, uint8_t Level,
+                        uint64_t From, uint64_t To, TelemetryPoint *Points, uint32_t Count){
+    uint32_t Series, Sequence, Retry, Copied;
+    uint32_t FromMs, ToMs;
+
+    if(!Started.load(std::memory_order_acquire) || PDU >= PDU_MAX_COUNT ||
+       Channel >= TELEMETRY_CHANNEL_COUNT || Mux >= MuxCount[Channel] ||
+       Level >= TELEMETRY_LEVEL_COUNT || To < From || To < Epoch.load(std::memory_order_relaxed)){
+        return 0;
+    }
+    Series = SeriesOf(PDU, Channel, Mux);
+    FromMs = MsSinceEpoch(From);
+    ToMs = MsSinceEpoch(To);
+
+    for(Retry = 0; Retry < TELEMETRY_READ_RETRIES; Retry++){
+        Sequence = Columns.Sequence[Series].load(std::memory_order_acquire);
+        if(Sequence & 1){
+            continue;
+        }
+        Copied = (Level == TELEMETRY_RAW) ? CopyRaw(Series, FromMs, ToMs, Points, Count) :
+                                            CopyRollup(Series, Level, FromMs, ToMs, Points, Count);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(Columns.Sequence[Series].load(std::memory_order_relaxed) == Sequence){
+            return Copied;
+        }
+    }
+    return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Writes the export file, through a temporary file so a
+ *                reader never sees half of one
+ *
+ *  Arguments   : File path, first and last time
+ *
+ *  Return Value: false when the file could not be written
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool TelemetryExport(const char *Path, uint64_t From, uint64_t To){
+    static TelemetryPoint Points[TELEMETRY_ROLLUP_SIZE + 1];
+    TelemetryFileHeader Header = {};
+    TelemetryFileBlock Block;
+    char TempPath[PATH_MAX];
+    uint64_t Start = Epoch.load(std::memory_order_relaxed);
+    uint32_t PDU, Channel, Mux, Level, Count, Pos, TimeMs;
+    bool Written = true;
+    FILE *File;
+
+    if(snprintf(TempPath, sizeof(TempPath), "%s.tmp", Path) >= (int)sizeof(TempPath)){
+        return false;
+    }
+    File = fopen(TempPath, "wb");
+    if(File == nullptr){
+        return false;
+    }
+    Header.Magic = TELEMETRY_FILE_MAGIC;
+    Header.Version = TELEMETRY_FILE_VERSION;
+    for(Level = 0; Level < TELEMETRY_LEVEL_COUNT; Level++){
+        Header.WidthMs[Level] = WidthMs[Level];
+    }
+    Header.Epoch = Start;
+    Written &= (fwrite(&Header, sizeof(Header), 1, File) == 1);
+
+    for(PDU = 0; PDU < PDU_MAX_COUNT; PDU++){
+        for(Channel = 0; Channel < TELEMETRY_CHANNEL_COUNT; Channel++){
+            for(Mux = 0; Mux < MuxCount[Channel]; Mux++){
+                for(Level = 0; Level < TELEMETRY_LEVEL_COUNT; Level++){
+                    Count = TelemetryQuery((uint8_t)PDU, (uint8_t)Channel, (uint8_t)Mux, (uint8_t)Level,
+                                           From, To, Points, TELEMETRY_ROLLUP_SIZE + 1);
+                    if(Count == 0){
+                        continue;
+                    }
+                    Block.PDU = (uint8_t)PDU;
+                    Block.Channel = (uint8_t)Channel;
+                    Block.Mux = (uint8_t)Mux;
+                    Block.Level = (uint8_t)Level;
+                    Block.Count = Count;
+                    Written &= (fwrite(&Block, sizeof(Block), 1, File) == 1);
+
+                    for(Pos = 0; Pos < Count; Pos++){
+                        TimeMs = (uint32_t)((Points[Pos].TimeStamp - Start) / TELEMETRY_NS_PER_MS);
+                        Written &= (fwrite(&TimeMs, sizeof(TimeMs), 1, File) == 1);
+                        if(Level == TELEMETRY_RAW){
+                            Written &= (fwrite(&Points[Pos].Avg, sizeof(uint16_t), 1, File) == 1);
+                        }
+                        else{
+                            Written &= (fwrite(&Points[Pos].Min, sizeof(uint16_t), 1, File) == 1);
+                            Written &= (fwrite(&Points[Pos].Max, sizeof(uint16_t), 1, File) == 1);
+                            Written &= (fwrite(&Points[Pos].Avg, sizeof(uint16_t), 1, File) == 1);
+                        }
+                    }
+                    Header.Blocks++;
+                }
+            }
+        }
+    }
+
+    //The block count is only known now
+    Written &= (fseek(File, 0, SEEK_SET) == 0);
+    Written &= (fwrite(&Header, sizeof(Header), 1, File) == 1);
+    Written &= (fclose(File) == 0);
+    if(!Written || rename(TempPath, Path) != 0){
+        remove(TempPath);
+        return false;
+    }
+    return true;
+}
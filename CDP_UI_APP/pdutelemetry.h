@@ -0,0 +1,161 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : pdutelemetry.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef PDUTELEMETRY_H
+#define PDUTELEMETRY_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+//Measurements a PDU multiplexes onto MSG2, one series each
+#define     TELEMETRY_CURRENT_MUX       4           //Current_Mux
+#define     TELEMETRY_VOLTAGE_MUX       4           //Voltage_Mux
+#define     TELEMETRY_TEMPERATURE_MUX   16          //Temperature_Mux
+
+#define     TELEMETRY_RAW_SIZE          64          //Last samples of a series, power of 2
+#define     TELEMETRY_ROLLUP_SIZE       96          //Buckets kept per rollup level
+#define     TELEMETRY_MINUTE_MS         60000       //96 minutes of 1 minute buckets
+#define     TELEMETRY_QUARTER_MS        900000      //24 hours of 15 minute buckets
+#define     TELEMETRY_READ_RETRIES      4
+
+#define     TELEMETRY_FILE_MAGIC        0x54504443  //"CDPT"
+#define     TELEMETRY_FILE_VERSION      2           //2: Epoch is CLOCK_REALTIME
+
+/********************* ENUMS  *****************************/
+enum TELEMETRY_CHANNEL {TELEMETRY_CURRENT = 0,
+                        TELEMETRY_VOLTAGE,
+                        TELEMETRY_TEMPERATURE,
+                        TELEMETRY_ROLLER_SPEED,
+                        TELEMETRY_LM_SPEED,
+                        TELEMETRY_CHANNEL_COUNT};
+
+enum TELEMETRY_LEVEL {TELEMETRY_RAW = 0,
+                      TELEMETRY_MINUTE,
+                      TELEMETRY_QUARTER,
+                      TELEMETRY_LEVEL_COUNT};
+
+/********************* Structures  *****************************/
+/*-----------------------------------------------------------------------------
+ *  Description : One point of a series. A raw sample has Min = Max = Avg; a
+ *                bucket is stamped with its start. Values are the raw
+ *                signal values of the ICD.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint64_t    TimeStamp;          //CLOCK_REALTIME, ns
+    uint16_t    Min;
+    uint16_t    Max;
+    uint16_t    Avg;
+}TelemetryPoint;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Export file, little endian. The header is followed by
+ *                Blocks blocks, a TelemetryFileBlock each followed by Count
+ *                points: TimeMs (uint32, ms from Epoch) and the value
+ *                (uint16) for TELEMETRY_RAW, TimeMs and Min, Max, Avg
+ *                (uint16 each) for the rollups. Epoch is the CLOCK_REALTIME
+ *                receive time of the first sample, so Epoch + TimeMs is
+ *                wall clock time whatever stamps the CAN controller gives.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct __attribute__((packed)){
+    uint32_t    Magic;
+    uint16_t    Version;
+    uint16_t    Reserved;
+    uint32_t    Blocks;
+    uint32_t    WidthMs[TELEMETRY_LEVEL_COUNT];     //0 for TELEMETRY_RAW
+    uint64_t    Epoch;                              //CLOCK_REALTIME, ns
+}TelemetryFileHeader;
+
+typedef struct __attribute__((packed)){
+    uint8_t     PDU;
+    uint8_t     Channel;
+    uint8_t     Mux;
+    uint8_t     Level;
+    uint32_t    Count;
+}TelemetryFileBlock;
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Telemetry store of all PDUs, fed from PDU Status MSG2 and
+ *                MSG3 on the parser thread.
+ *
+ *                Every (PDU, channel, mux) is one series. A series keeps its
+ *                last TELEMETRY_RAW_SIZE samples and two rollup levels of
+ *                min / max / average buckets. The columns are static, so a
+ *                frame costs a fixed number of stores and no allocation; the
+ *                bucket a sample falls in is found from its time alone.
+ *                The columns take about 6 MB of bss, of which only the pages
+ *                of series actually reported become resident.
+ *
+ *                Readers in any thread copy a series under its sequence
+ *                lock and retry when the parser wrote to it meanwhile.
+ *
+ *                Samples carry the software receive time of their frame
+ *                (CAN_DATA::WallTime), never the hardware stamp, which has
+ *                its own time base.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void TelemetryIngestMSG2(uint8_t Slot, uint64_t Payload, uint64_t WallTime);
+void TelemetryIngestMSG3(uint8_t Slot, uint64_t Payload, uint64_t WallTime);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copies the points of one series between From and To
+ *                (CLOCK_REALTIME, ns, both included) in time order, at most Count.
+ *                A bucket still filling is included with the samples so far.
+ *                Returns the points copied, 0 as well when the series kept
+ *                changing under the copy.
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t TelemetryQuery(uint8_t PDU, uint8_t Channel, uint8_t Mux, uint8_t Level,
+                        uint64_t From, uint64_t To, TelemetryPoint *Points, uint32_t Count);
+
+uint32_t TelemetryMuxCount(uint8_t Channel);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Writes every level of every series with points between
+ *                From and To to a file, see TelemetryFileHeader
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool TelemetryExport(const char *Path, uint64_t From, uint64_t To);
+
+#endif // PDUTELEMETRY_H
@@ -0,0 +1,457 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : powersupply.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Samples the power supply monitor and the other I2C sensors at a
+ *                fixed rate, one I2C_RDWR transfer per sample, into a lock free ring
+ *                with running statistics and threshold events.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "powersupply.h"
+#include <atomic>
+#include <thread>
+#include <ctime>
+#include <cerrno>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/eventfd.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     SENSOR_NS_PER_MS        1000000ULL
+
+static_assert((SENSOR_RING_SIZE & (SENSOR_RING_SIZE - 1)) == 0, "Sample ring size must be a power of 2");
+
+/********************* Structures  *****************************/
+/*-----------------------------------------------------------------------------
+ *  Description : One sensor read by the service. The register is big endian,
+ *                Value = Raw * Scale micro units. The level changes when the
+ *                value leaves [Low, High] and changes back once it is
+ *                Hysteresis inside again.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint8_t     Address;
+    uint8_t     Register;
+    uint32_t    PeriodMs;
+    int32_t     Scale;
+    int32_t     Low;
+    int32_t     High;
+    int32_t     Hysteresis;
+}SensorChannel;
+
+typedef struct{
+    std::atomic<uint64_t>   Sequence;       //2 * sample + 2 once written, odd while written
+    std::atomic<uint64_t>   TimeStamp;
+    std::atomic<uint32_t>   Word;           //Sensor << 16 | Raw
+    std::atomic<int32_t>    Value;
+}SensorSlot;
+
+typedef struct{
+    std::atomic<uint32_t>   Samples;
+    std::atomic<uint32_t>   Errors;
+    std::atomic<uint32_t>   Overruns;
+    std::atomic<int32_t>    Last;
+    std::atomic<int32_t>    Min;
+    std::atomic<int32_t>    Max;
+    std::atomic<int64_t>    Sum;
+    std::atomic<uint8_t>    Level;
+}SensorState;
+
+/*************************** REGISTRATIONS *********************************/
+
+//3.125 mV per bit on the 28 V bus
+static constexpr SensorChannel Sensors[SENSOR_COUNT] = {
+    {POWER_SUPPLY_SLAVE_ADD, BUS_VOLTAGE_REG_ADD, 100, 3125, 22000000, 32000000, 500000}};
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static SensorSlot               Ring[SENSOR_RING_SIZE];
+static std::atomic<uint64_t>    Head(0);
+static SensorState              State[SENSOR_COUNT];
+static std::atomic<SensorSink>  Sink(nullptr);
+
+static std::atomic<bool>        Opened(false);
+static std::atomic<bool>        Running(false);
+static std::thread              Sampler;
+static I2CTransfer              Transfer = nullptr;
+static int                      DeviceFD = -1;
+static int                      WakeFD = -1;
+
+//Sampling thread only
+static uint64_t                 NextDue[SENSOR_COUNT];
+static uint32_t                 Failures[SENSOR_COUNT];
+
+/************************ LOCAL OPERATION DEFINITIONS ***********************/
+
+static uint64_t MonotonicNs(){
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+}
+
+static int IoctlTransfer(int FD, struct i2c_rdwr_ioctl_data *Data){
+    return ioctl(FD, I2C_RDWR, Data);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Level of a value, from the level it had before
+ *
+ *-----------------------------------------------------------------------------
+ */
+static uint8_t Classify(const SensorChannel &Channel, uint8_t Level, int32_t Value){
+    if(Level == SENSOR_LEVEL_LOW && Value < Channel.Low + Channel.Hysteresis){
+        return SENSOR_LEVEL_LOW;
+    }
+    if(Level == SENSOR_LEVEL_HIGH && Value > Channel.High - Channel.Hysteresis){
+        return SENSOR_LEVEL_HIGH;
+    }
+    if(Value < Channel.Low){
+        return SENSOR_LEVEL_LOW;
+    }
+    if(Value > Channel.High){
+        return SENSOR_LEVEL_HIGH;
+    }
+    return SENSOR_LEVEL_NORMAL;
+}
+
+static void SetLevel(uint8_t Sensor, uint8_t Level, int32_t Value, uint64_t TimeStamp){
+    SensorState &Item = State[Sensor];
+    uint8_t Prev = Item.Level.load(std::memory_order_relaxed);
+    SensorSink Handler;
+    SensorEvent Event;
+
+    if(Level == Prev){
+        return;
+    }
+    Item.Level.store(Level, std::memory_order_relaxed);
+
+    Handler = Sink.load(std::memory_order_acquire);
+    if(Handler != nullptr){
+        Event.TimeStamp = TimeStamp;
+        Event.Sensor = Sensor;
+        Event.Level = Level;
+        Event.PrevLevel = Prev;
+        Event.Value = Value;
+        Handler(Event);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Publishes one sample in the ring. The slot sequence is odd
+ *                while the fields change, readers drop a slot whose
+ *                sequence moved under them.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void PushSample(uint8_t Sensor, uint16_t Raw, int32_t Value, uint64_t TimeStamp){
+    uint64_t Index = Head.load(std::memory_order_relaxed);
+    SensorSlot &Slot = Ring[Index & (SENSOR_RING_SIZE - 1)];
+
+    Slot.Sequence.store(2 * Index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    Slot.TimeStamp.store(TimeStamp, std::memory_order_relaxed);
+    Slot.Word.store(((uint32_t)Sensor << 16) | Raw, std::memory_order_relaxed);
+    Slot.Value.store(Value, std::memory_order_relaxed);
+    Slot.Sequence.store(2 * Index + 2, std::memory_order_release);
+    Head.store(Index + 1, std::memory_order_release);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Reads one sensor, register write and read in one transfer
+ *
+ *  Arguments   : Sensor, monotonic time in ns
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void Sample(uint8_t Sensor, uint64_t Now){
+    const SensorChannel &Channel = Sensors[Sensor];
+    SensorState &Item = State[Sensor];
+    uint8_t Register = Channel.Register;
+    uint8_t Buffer[2];
+    struct i2c_msg Msgs[2] = {
+        {Channel.Address, 0, 1, &Register},
+        {Channel.Address, I2C_M_RD, 2, Buffer}};
+    struct i2c_rdwr_ioctl_data Data = {Msgs, 2};
+    uint16_t Raw;
+    int32_t Value;
+    uint32_t Samples;
+
+    if(Transfer(DeviceFD, &Data) != 2){
+        Item.Errors.fetch_add(1, std::memory_order_relaxed);
+        if(++Failures[Sensor] == SENSOR_FAIL_COUNT){
+            SetLevel(Sensor, SENSOR_LEVEL_FAILED, 0, Now);
+        }
+        return;
+    }
+    Failures[Sensor] = 0;
+
+    Raw = (uint16_t)((Buffer[0] << 8) | Buffer[1]);
+    Value = (int32_t)Raw * Channel.Scale;
+    PushSample(Sensor, Raw, Value, Now);
+
+    Samples = Item.Samples.load(std::memory_order_relaxed);
+    if(Samples == 0 || Value < Item.Min.load(std::memory_order_relaxed)){
+        Item.Min.store(Value, std::memory_order_relaxed);
+    }
+    if(Samples == 0 || Value > Item.Max.load(std::memory_order_relaxed)){
+        Item.Max.store(Value, std::memory_order_relaxed);
+    }
+    Item.Sum.fetch_add(Value, std::memory_order_relaxed);
+    Item.Last.store(Value, std::memory_order_relaxed);
+    Item.Samples.store(Samples + 1, std::memory_order_release);
+
+    SetLevel(Sensor, Classify(Channel, Item.Level.load(std::memory_order_relaxed), Value), Value, Now);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Milliseconds to the next sensor due, rounded up
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int NextTimeout(uint64_t Now){
+    uint64_t Due = NextDue[0];
+    uint32_t Sensor;
+
+    for(Sensor = 1; Sensor < SENSOR_COUNT; Sensor++){
+        if(NextDue[Sensor] < Due){
+            Due = NextDue[Sensor];
+        }
+    }
+    return (Due <= Now) ? 0 : (int)((Due - Now + SENSOR_NS_PER_MS - 1) / SENSOR_NS_PER_MS);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Samples every sensor on its own fixed rate grid. A sensor
+ *                that fell a whole period behind skips the periods missed
+ *                instead of sampling in a burst.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void SamplerThread(){
+    struct pollfd Fds = {WakeFD, POLLIN, 0};
+    uint64_t Now, Period, Value;
+    uint32_t Sensor;
+
+    Now = MonotonicNs();
+    for(Sensor = 0; Sensor < SENSOR_COUNT; Sensor++){
+        NextDue[Sensor] = Now;
+        Failures[Sensor] = 0;
+    }
+
+    while(Running.load(std::memory_order_acquire)){
+        if(poll(&Fds, 1, NextTimeout(MonotonicNs())) > 0 && (Fds.revents & POLLIN)){
+            if(read(WakeFD, &Value, sizeof(Value)) < 0){
+                /* Interrupted, Running is checked anyway */
+            }
+            continue;
+        }
+        Now = MonotonicNs();
+        for(Sensor = 0; Sensor < SENSOR_COUNT; Sensor++){
+            if(NextDue[Sensor] > Now){
+                continue;
+            }
+            Sample((uint8_t)Sensor, Now);
+
+            Period = (uint64_t)Sensors[Sensor].PeriodMs * SENSOR_NS_PER_MS;
+            NextDue[Sensor] += Period;
+            if(NextDue[Sensor] <= Now){
+                State[Sensor].Overruns.fetch_add((uint32_t)((Now - NextDue[Sensor]) / Period) + 1,
+                                                 std::memory_order_relaxed);
+                NextDue[Sensor] += ((Now - NextDue[Sensor]) / Period + 1) * Period;
+            }
+        }
+    }
+}
+
+/************************ EXPORTED OPERATION DEFINITIONS ********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens the I2C bus of the sensors and starts the service
+ *
+ *  Arguments   : i2c-dev device, nullptr for POWER_SUPPLY_DEV_PATH
+ *
+ *  Return Value: false when the bus cannot do combined transfers
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool PowerSupplyOpen(const char *Device){
+    unsigned long Funcs = 0;
+    int FD;
+
+    FD = open((Device != nullptr) ? Device : POWER_SUPPLY_DEV_PATH, O_RDWR | O_CLOEXEC);
+    if(FD < 0){
+        return false;
+    }
+    if(ioctl(FD, I2C_FUNCS, &Funcs) < 0 || (Funcs & I2C_FUNC_I2C) == 0 ||
+       !PowerSupplyOpenDevice(FD, nullptr)){
+        close(FD);
+        return false;
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Resets the samples and statistics and starts the sampling
+ *                thread
+ *
+ *  Arguments   : Open device, transfer function or nullptr
+ *
+ *  Return Value: false when already open
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool PowerSupplyOpenDevice(int FD, I2CTransfer Handler){
+    uint32_t Pos;
+
+    if(Opened.load(std::memory_order_acquire)){
+        return false;
+    }
+    WakeFD = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if(WakeFD < 0){
+        return false;
+    }
+    DeviceFD = FD;
+    Transfer = (Handler != nullptr) ? Handler : IoctlTransfer;
+
+    for(Pos = 0; Pos < SENSOR_RING_SIZE; Pos++){
+        Ring[Pos].Sequence.store(0, std::memory_order_relaxed);
+    }
+    Head.store(0, std::memory_order_relaxed);
+    for(Pos = 0; Pos < SENSOR_COUNT; Pos++){
+        State[Pos].Samples.store(0, std::memory_order_relaxed);
+        State[Pos].Errors.store(0, std::memory_order_relaxed);
+        State[Pos].Overruns.store(0, std::memory_order_relaxed);
+        State[Pos].Last.store(0, std::memory_order_relaxed);
+        State[Pos].Min.store(0, std::memory_order_relaxed);
+        State[Pos].Max.store(0, std::memory_order_relaxed);
+        State[Pos].Sum.store(0, std::memory_order_relaxed);
+        State[Pos].Level.store(SENSOR_LEVEL_NORMAL, std::memory_order_relaxed);
+    }
+
+    Running.store(true, std::memory_order_release);
+    Opened.store(true, std::memory_order_release);
+    Sampler = std::thread(SamplerThread);
+    return true;
+}
+
+void PowerSupplyClose(){
+    uint64_t One = 1;
+
+    if(!Opened.exchange(false)){
+        return;
+    }
+    Running.store(false, std::memory_order_release);
+    if(write(WakeFD, &One, sizeof(One)) < 0){
+        /* Counter saturated, the thread is awake anyway */
+    }
+    Sampler.join();
+    close(DeviceFD);
+    close(WakeFD);
+    DeviceFD = -1;
+    WakeFD = -1;
+}
+
+void PowerSupplySetSink(SensorSink Handler){
+    Sink.store(Handler, std::memory_order_release);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copies the samples from Cursor on
+ *
+ *  Arguments   : Cursor of the reader, sample buffer, its size
+ *
+ *  Return Value: Samples copied
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t PowerSupplyReadSamples(uint64_t *Cursor, SensorSample *Samples, uint32_t Count){
+    uint64_t Last = Head.load(std::memory_order_acquire);
+    uint64_t Index = *Cursor;
+    uint64_t Sequence;
+    uint32_t Word, Copied = 0;
+
+    if(Last - Index > SENSOR_RING_SIZE){
+        Index = Last - SENSOR_RING_SIZE;
+    }
+    for(; Index < Last && Copied < Count; Index++){
+        SensorSlot &Slot = Ring[Index & (SENSOR_RING_SIZE - 1)];
+
+        Sequence = Slot.Sequence.load(std::memory_order_acquire);
+        if(Sequence != 2 * Index + 2){
+            continue;                           //Overwritten since Head was read
+        }
+        Samples[Copied].TimeStamp = Slot.TimeStamp.load(std::memory_order_relaxed);
+        Word = Slot.Word.load(std::memory_order_relaxed);
+        Samples[Copied].Value = Slot.Value.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(Slot.Sequence.load(std::memory_order_relaxed) != Sequence){
+            continue;
+        }
+        Samples[Copied].Sensor = (uint8_t)(Word >> 16);
+        Samples[Copied].Raw = (uint16_t)Word;
+        Copied++;
+    }
+    *Cursor = Index;
+    return Copied;
+}
+
+bool PowerSupplyGetStats(uint32_t Sensor, SensorStats *Stats){
+    uint32_t Samples;
+
+    if(Sensor >= SENSOR_COUNT){
+        return false;
+    }
+    const SensorState &Item = State[Sensor];
+
+    Samples = Item.Samples.load(std::memory_order_acquire);
+    Stats->Samples = Samples;
+    Stats->Errors = Item.Errors.load(std::memory_order_relaxed);
+    Stats->Overruns = Item.Overruns.load(std::memory_order_relaxed);
+    Stats->Last = Item.Last.load(std::memory_order_relaxed);
+    Stats->Min = Item.Min.load(std::memory_order_relaxed);
+    Stats->Max = Item.Max.load(std::memory_order_relaxed);
+    Stats->Mean = (Samples != 0) ? (int32_t)(Item.Sum.load(std::memory_order_relaxed) / Samples) : 0;
+    Stats->Level = Item.Level.load(std::memory_order_relaxed);
+    return true;
+}
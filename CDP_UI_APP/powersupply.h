@@ -0,0 +1,151 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : powersupply.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef POWERSUPPLY_H
+#define POWERSUPPLY_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     POWER_SUPPLY_SLAVE_ADD  0x44
+#define     POWER_SUPPLY_DEV_PATH   "/dev/i2c-101"
+#define     POWER_SUPPLY_DEV_ENV    "CDP_POWER_SUPPLY_DEV"      //Overrides POWER_SUPPLY_DEV_PATH
+#define     BUS_VOLTAGE_REG_ADD     0x05
+#define     CURRENT_REG_ADD         0x07
+#define     POWER_REG_ADD           0x08
+
+#define     SENSOR_RING_SIZE        1024        //Samples kept, power of 2
+#define     SENSOR_FAIL_COUNT       3           //Failed transfers in a row before SENSOR_LEVEL_FAILED
+
+/********************* ENUMS  *****************************/
+enum SENSOR_ID {SENSOR_BUS_VOLTAGE = 0,
+                SENSOR_COUNT};
+
+enum SENSOR_LEVEL {SENSOR_LEVEL_NORMAL = 0,
+                   SENSOR_LEVEL_LOW,
+                   SENSOR_LEVEL_HIGH,
+                   SENSOR_LEVEL_FAILED};          //No answer from the sensor
+
+/********************* Structures  *****************************/
+struct i2c_rdwr_ioctl_data;
+
+/*-----------------------------------------------------------------------------
+ *  Description : One sample. Value is in micro units of the sensor (uV for
+ *                the bus voltage), Raw the register as read.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint64_t    TimeStamp;          //Monotonic time of the transfer in ns
+    uint8_t     Sensor;
+    uint16_t    Raw;
+    int32_t     Value;
+}SensorSample;
+
+//Since the service was opened, fields are read one by one
+typedef struct{
+    uint32_t    Samples;
+    uint32_t    Errors;             //Failed transfers
+    uint32_t    Overruns;           //Periods skipped because a transfer ran late
+    int32_t     Last;
+    int32_t     Min;
+    int32_t     Max;
+    int32_t     Mean;
+    uint8_t     Level;
+}SensorStats;
+
+typedef struct{
+    uint64_t    TimeStamp;
+    uint8_t     Sensor;
+    uint8_t     Level;
+    uint8_t     PrevLevel;
+    int32_t     Value;              //Sample that crossed, 0 for SENSOR_LEVEL_FAILED
+}SensorEvent;
+
+//Called on the sampling thread, must not block
+typedef void (*SensorSink)(const SensorEvent &Event);
+
+//ioctl(FD, I2C_RDWR, Transfer) or a stand-in, returns the messages done or -1
+typedef int (*I2CTransfer)(int FD, struct i2c_rdwr_ioctl_data *Transfer);
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sampling service of the power supply monitor and the other
+ *                I2C sensors of the display.
+ *
+ *                One thread reads every sensor of the sensor table at its
+ *                own fixed rate. A sample is a single I2C_RDWR transfer, the
+ *                register write and the read with a repeated start, so the
+ *                thread never sleeps between the two halves. Failed
+ *                transfers are counted and, after SENSOR_FAIL_COUNT in a
+ *                row, reported as SENSOR_LEVEL_FAILED; the service keeps
+ *                trying.
+ *
+ *                Samples go to a ring of SENSOR_RING_SIZE that any thread
+ *                reads without a lock. A sample that crosses a threshold of
+ *                its sensor, or a sensor that fails or recovers, is passed
+ *                to the sink as a SensorEvent, so readers need not poll.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool PowerSupplyOpen(const char *Device);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Starts the service on a device that is already open. The
+ *                transfers go through Transfer, nullptr for the I2C_RDWR
+ *                ioctl. The service closes the device in PowerSupplyClose.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool PowerSupplyOpenDevice(int FD, I2CTransfer Transfer);
+
+void PowerSupplyClose();
+
+void PowerSupplySetSink(SensorSink Sink);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copies up to Count samples from Cursor on and moves Cursor
+ *                past them. A reader that fell more than SENSOR_RING_SIZE
+ *                behind resumes at the oldest sample kept. Any thread.
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t PowerSupplyReadSamples(uint64_t *Cursor, SensorSample *Samples, uint32_t Count);
+
+bool PowerSupplyGetStats(uint32_t Sensor, SensorStats *Stats);
+
+#endif // POWERSUPPLY_H
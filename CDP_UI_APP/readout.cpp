@@ -0,0 +1,713 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : readout.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "readout.h"
+#include "lrudata.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/eventfd.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     READOUT_NS_PER_MS           1000000ULL
+#define     READOUT_NODE_COUNT          256
+#define     READOUT_NONE                0xFF
+
+static_assert((READOUT_QUEUE_SIZE & (READOUT_QUEUE_SIZE - 1)) == 0, "Queue size must be a power of 2");
+static_assert((READOUT_RESULT_SIZE & (READOUT_RESULT_SIZE - 1)) == 0, "Result size must be a power of 2");
+static_assert(READOUT_MAX_IN_FLIGHT <= READOUT_POOL_SIZE, "Every session needs a pool buffer");
+static_assert(READOUT_POOL_SIZE < READOUT_NONE, "Pool index must fit a byte");
+
+/********************* ENUMS  *****************************/
+enum READOUT_STATE {READOUT_STATE_IDLE = 0,
+                    READOUT_STATE_WAIT_FIRST,           //Request sent
+                    READOUT_STATE_WAIT_CONSECUTIVE};    //First Frame in, Flow Control sent
+
+/********************* Structures  *****************************/
+typedef struct{
+    uint8_t     NodeID;
+    uint8_t     Item;
+}ReadoutQueueItem;
+
+//One node being read out. Engine thread only.
+typedef struct{
+    uint8_t     State;
+    uint8_t     NodeID;
+    uint8_t     Item;
+    uint8_t     Retries;
+    uint8_t     Sequence;       //Expected in the next Consecutive Frame
+    uint8_t     BlockLeft;      //Consecutive Frames before the next Flow Control
+    uint8_t     Buffer;         //Pool index
+    uint16_t    Length;
+    uint16_t    Received;
+    uint64_t    Start;
+    uint64_t    Deadline;
+}ReadoutSession;
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static uint8_t                  Pool[READOUT_POOL_SIZE][READOUT_BUFFER_SIZE];
+
+//Shared with the requesting and reading threads, under Lock
+static std::mutex               Lock;
+static std::condition_variable  ResultReady;
+static uint8_t                  PoolFree[READOUT_POOL_SIZE];
+static uint32_t                 PoolFreeCount = 0;
+static ReadoutQueueItem         Queue[READOUT_QUEUE_SIZE];
+static uint32_t                 QueueHead = 0;
+static uint32_t                 QueueTail = 0;
+static READOUT_RESULT           Results[READOUT_RESULT_SIZE];
+static uint32_t                 ResultHead = 0;
+static uint32_t                 ResultTail = 0;
+static bool                     NodeBusy[READOUT_NODE_COUNT];
+static uint32_t                 InFlight = 0;
+
+//Engine thread only
+static ReadoutSession           Sessions[READOUT_MAX_IN_FLIGHT];
+static uint8_t                  NodeSession[READOUT_NODE_COUNT];
+static struct canfd_frame       RxFrames[READOUT_RX_BATCH_SIZE];
+static struct iovec             RxIov[READOUT_RX_BATCH_SIZE];
+static struct mmsghdr           RxMsgs[READOUT_RX_BATCH_SIZE];
+static struct canfd_frame       TxFrames[READOUT_TX_BATCH_SIZE];
+static struct iovec             TxIov[READOUT_TX_BATCH_SIZE];
+static struct mmsghdr           TxMsgs[READOUT_TX_BATCH_SIZE];
+static uint32_t                 TxCount = 0;
+
+static std::atomic<uint64_t>    StatCompleted(0);
+static std::atomic<uint64_t>    StatFailed(0);
+static std::atomic<uint64_t>    StatRetries(0);
+static std::atomic<uint64_t>    StatFramesReceived(0);
+static std::atomic<uint64_t>    StatFramesUnexpected(0);
+static std::atomic<uint64_t>    StatFramesSent(0);
+
+static std::atomic<bool>        Opened(false);
+static std::atomic<bool>        Running(false);
+static std::thread              Engine;
+static int                      CanFD = -1;
+static int                      WakeFD = -1;
+
+/************************ LOCAL OPERATION DEFINITIONS ***********************/
+
+static uint64_t MonotonicNs(){
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+}
+
+static void WakeEngine(){
+    uint64_t One = 1;
+
+    if(write(WakeFD, &One, sizeof(One)) < 0){
+        /* Counter saturated, the engine is awake anyway */
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Queues one classic frame to a node, sent by FlushTx with the
+ *                rest of the loop iteration in one sendmmsg
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void FlushTx();
+
+static void QueueTx(uint8_t NodeID, const uint8_t *Data, uint8_t Length){
+    struct canfd_frame *Frame;
+    ARBITRATION_FIELD ID;
+
+    if(TxCount == READOUT_TX_BATCH_SIZE){
+        FlushTx();
+    }
+    ID.Data = 0;
+    ID.Bits.FuntionIdentifier = FID_READOUT_CMD;
+    ID.Bits.NodeIdentifier = NodeID;
+    Frame = &TxFrames[TxCount++];
+    memset(Frame, 0, sizeof(*Frame));
+    Frame->can_id = (ID.Data & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    Frame->len = Length;
+    memcpy(Frame->data, Data, Length);
+}
+
+static void FlushTx(){
+    uint32_t Sent = 0;
+    int Count;
+
+    while(Sent < TxCount){
+        Count = sendmmsg(CanFD, &TxMsgs[Sent], TxCount - Sent, 0);
+        if(Count <= 0){
+            if(Count < 0 && errno == EINTR){
+                continue;
+            }
+            //A full controller queue, the timeouts recover the lost frames
+            break;
+        }
+        Sent += Count;
+    }
+    StatFramesSent.fetch_add(Sent, std::memory_order_relaxed);
+    TxCount = 0;
+}
+
+static void SendRequest(ReadoutSession &Session, uint64_t Now){
+    const uint8_t Request[2] = {READOUT_PCI_SINGLE | 1, Session.Item};
+
+    QueueTx(Session.NodeID, Request, sizeof(Request));
+    Session.State = READOUT_STATE_WAIT_FIRST;
+    Session.Received = 0;
+    Session.Deadline = Now + READOUT_RESPONSE_TIMEOUT_MS * READOUT_NS_PER_MS;
+}
+
+static void SendFlowControl(const ReadoutSession &Session, uint8_t FlowStatus){
+    const uint8_t Flow[3] = {(uint8_t)(READOUT_PCI_FLOW | FlowStatus), READOUT_BLOCK_SIZE, READOUT_STMIN};
+
+    QueueTx(Session.NodeID, Flow, sizeof(Flow));
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Ends one session and posts its result. The buffer goes to
+ *                the reader on success and back to the pool otherwise.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void Complete(ReadoutSession &Session, uint8_t Status, uint64_t Now){
+    READOUT_RESULT *Result;
+
+    {
+        std::lock_guard<std::mutex> Guard(Lock);
+        Result = &Results[ResultHead++ & (READOUT_RESULT_SIZE - 1)];
+        Result->NodeID = Session.NodeID;
+        Result->Item = Session.Item;
+        Result->Status = Status;
+        Result->Retries = Session.Retries;
+        Result->Length = (Status == READOUT_OK) ? Session.Length : 0;
+        Result->Data = (Status == READOUT_OK) ? Pool[Session.Buffer] : nullptr;
+        Result->DurationNs = Now - Session.Start;
+        if((Status != READOUT_OK) && (Session.Buffer != READOUT_NONE)){
+            PoolFree[PoolFreeCount++] = Session.Buffer;
+        }
+        NodeBusy[Session.NodeID] = false;
+        InFlight--;
+    }
+    ResultReady.notify_all();
+
+    (Status == READOUT_OK ? StatCompleted : StatFailed).fetch_add(1, std::memory_order_relaxed);
+    NodeSession[Session.NodeID] = READOUT_NONE;
+    Session.State = READOUT_STATE_IDLE;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Repeats the request of a session that lost its response, or
+ *                fails it with Status once its retries are used up
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void Retry(ReadoutSession &Session, uint8_t Status, uint64_t Now){
+    if(Session.Retries >= READOUT_RETRIES){
+        Complete(Session, Status, Now);
+        return;
+    }
+    Session.Retries++;
+    StatRetries.fetch_add(1, std::memory_order_relaxed);
+    SendRequest(Session, Now);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Copies received data into the session buffer and finishes
+ *                the session once the whole item is in
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void Append(ReadoutSession &Session, const uint8_t *Data, uint32_t Length, uint64_t Now){
+    uint32_t Left = Session.Length - Session.Received;
+
+    if(Length > Left){
+        Length = Left;
+    }
+    memcpy(&Pool[Session.Buffer][Session.Received], Data, Length);
+    Session.Received += Length;
+    if(Session.Received == Session.Length){
+        Complete(Session, READOUT_OK, Now);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Handles one FID_READOUT_RESPONSE frame
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void HandleFrame(const struct canfd_frame &Frame, uint64_t Now){
+    ARBITRATION_FIELD ID;
+    uint8_t Index, Length, Offset;
+    uint16_t Total;
+
+    ID.Data = Frame.can_id & CAN_EFF_MASK;
+    Index = NodeSession[ID.Bits.NodeIdentifier];
+    if((Frame.can_id & (CAN_ERR_FLAG | CAN_RTR_FLAG)) ||
+       (ID.Bits.FuntionIdentifier != FID_READOUT_RESPONSE) ||
+       (Index == READOUT_NONE) || (Frame.len == 0)){
+        StatFramesUnexpected.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    ReadoutSession &Session = Sessions[Index];
+    Length = (Frame.len > CANFD_MAX_DLEN) ? CANFD_MAX_DLEN : Frame.len;
+
+    switch(Frame.data[0] & 0xF0){
+    case READOUT_PCI_SINGLE:
+        if(Session.State != READOUT_STATE_WAIT_FIRST){
+            break;
+        }
+        //A CAN-FD Single Frame moves its length into byte 1
+        Offset = ((Frame.data[0] & 0x0F) == 0 && Length > CAN_MAX_DLEN) ? 2 : 1;
+        Total = (Offset == 2) ? Frame.data[1] : (Frame.data[0] & 0x0F);
+        Session.Length = (Total <= Length - Offset) ? Total : (uint16_t)(Length - Offset);
+        Session.Received = 0;
+        if(Session.Length == 0){
+            Complete(Session, READOUT_OK, Now);
+        }
+        else{
+            Append(Session, &Frame.data[Offset], Session.Length, Now);
+        }
+        return;
+
+    case READOUT_PCI_FIRST:
+        if((Session.State != READOUT_STATE_WAIT_FIRST) || (Length < 2)){
+            break;
+        }
+        Total = (uint16_t)(((Frame.data[0] & 0x0F) << 8) | Frame.data[1]);
+        if(Total > READOUT_BUFFER_SIZE){
+            SendFlowControl(Session, READOUT_FLOW_OVERFLOW);
+            Complete(Session, READOUT_OVERFLOW, Now);
+            return;
+        }
+        Session.Length = Total;
+        Session.Received = 0;
+        Session.Sequence = 1;
+        Session.BlockLeft = READOUT_BLOCK_SIZE;
+        Session.State = READOUT_STATE_WAIT_CONSECUTIVE;
+        Session.Deadline = Now + READOUT_FRAME_TIMEOUT_MS * READOUT_NS_PER_MS;
+        SendFlowControl(Session, READOUT_FLOW_CTS);
+        Append(Session, &Frame.data[2], Length - 2, Now);
+        return;
+
+    case READOUT_PCI_CONSECUTIVE:
+        if(Session.State != READOUT_STATE_WAIT_CONSECUTIVE){
+            break;
+        }
+        if((Frame.data[0] & 0x0F) != Session.Sequence){
+            Retry(Session, READOUT_SEQUENCE, Now);
+            return;
+        }
+        Session.Sequence = (Session.Sequence + 1) & 0x0F;
+        Session.Deadline = Now + READOUT_FRAME_TIMEOUT_MS * READOUT_NS_PER_MS;
+        Append(Session, &Frame.data[1], Length - 1, Now);
+        //Complete() leaves the session idle once the item is in
+        if((Session.State == READOUT_STATE_WAIT_CONSECUTIVE) && (--Session.BlockLeft == 0)){
+            Session.BlockLeft = READOUT_BLOCK_SIZE;
+            SendFlowControl(Session, READOUT_FLOW_CTS);
+        }
+        return;
+
+    default:
+        break;
+    }
+    StatFramesUnexpected.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Drains the socket in recvmmsg batches
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void ReceiveFrames(uint64_t Now){
+    int Count, Pos;
+
+    do{
+        for(Pos = 0; Pos < READOUT_RX_BATCH_SIZE; Pos++){
+            RxMsgs[Pos].msg_hdr.msg_flags = 0;
+        }
+        Count = recvmmsg(CanFD, RxMsgs, READOUT_RX_BATCH_SIZE, MSG_DONTWAIT, NULL);
+        for(Pos = 0; Pos < Count; Pos++){
+            if((RxMsgs[Pos].msg_len == CAN_MTU) || (RxMsgs[Pos].msg_len == CANFD_MTU)){
+                HandleFrame(RxFrames[Pos], Now);
+            }
+        }
+        if(Count > 0){
+            StatFramesReceived.fetch_add(Count, std::memory_order_relaxed);
+        }
+    }while(Count == READOUT_RX_BATCH_SIZE);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Retries every session past its deadline
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void ExpireSessions(uint64_t Now){
+    uint32_t Pos;
+
+    for(Pos = 0; Pos < READOUT_MAX_IN_FLIGHT; Pos++){
+        if((Sessions[Pos].State != READOUT_STATE_IDLE) && (Sessions[Pos].Deadline <= Now)){
+            Retry(Sessions[Pos], READOUT_TIMEOUT, Now);
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Starts queued requests while a session, a pool buffer and a
+ *                result entry are free
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void StartSessions(uint64_t Now){
+    ReadoutQueueItem Item;
+    uint8_t Buffer;
+    uint32_t Pos;
+
+    for(Pos = 0; Pos < READOUT_MAX_IN_FLIGHT; Pos++){
+        if(Sessions[Pos].State != READOUT_STATE_IDLE){
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> Guard(Lock);
+            if((QueueTail == QueueHead) || (PoolFreeCount == 0) ||
+               ((ResultHead - ResultTail) + InFlight >= READOUT_RESULT_SIZE)){
+                return;
+            }
+            Item = Queue[QueueTail++ & (READOUT_QUEUE_SIZE - 1)];
+            Buffer = PoolFree[--PoolFreeCount];
+            InFlight++;
+        }
+
+        ReadoutSession &Session = Sessions[Pos];
+        Session.NodeID = Item.NodeID;
+        Session.Item = Item.Item;
+        Session.Retries = 0;
+        Session.Buffer = Buffer;
+        Session.Length = 0;
+        Session.Start = Now;
+        NodeSession[Item.NodeID] = (uint8_t)Pos;
+        SendRequest(Session, Now);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Milliseconds until the earliest session deadline, -1 when
+ *                no session is running
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int NextTimeout(uint64_t Now){
+    uint64_t Earliest = UINT64_MAX;
+    uint32_t Pos;
+
+    for(Pos = 0; Pos < READOUT_MAX_IN_FLIGHT; Pos++){
+        if((Sessions[Pos].State != READOUT_STATE_IDLE) && (Sessions[Pos].Deadline < Earliest)){
+            Earliest = Sessions[Pos].Deadline;
+        }
+    }
+    if(Earliest == UINT64_MAX){
+        return -1;
+    }
+    return (Earliest <= Now) ? 0 : (int)((Earliest - Now + READOUT_NS_PER_MS - 1) / READOUT_NS_PER_MS);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Engine thread. Sleeps on the socket and the wake event up to
+ *                the next session deadline; each pass receives, expires,
+ *                starts new sessions and sends its frames in one batch.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void EngineThread(){
+    struct pollfd Fds[2] = {{CanFD, POLLIN, 0}, {WakeFD, POLLIN, 0}};
+    ReadoutQueueItem Item;
+    ReadoutSession Aborted;
+    uint64_t Now, Value;
+    uint32_t Pos;
+
+    while(Running.load(std::memory_order_acquire)){
+        if(poll(Fds, 2, NextTimeout(MonotonicNs())) > 0 && (Fds[1].revents & POLLIN)){
+            if(read(WakeFD, &Value, sizeof(Value)) < 0){
+                /* Interrupted, the queue is checked anyway */
+            }
+        }
+        Now = MonotonicNs();
+        ReceiveFrames(Now);
+        ExpireSessions(Now);
+        StartSessions(Now);
+        FlushTx();
+    }
+
+    Now = MonotonicNs();
+    for(Pos = 0; Pos < READOUT_MAX_IN_FLIGHT; Pos++){
+        if(Sessions[Pos].State != READOUT_STATE_IDLE){
+            Complete(Sessions[Pos], READOUT_ABORTED, Now);
+        }
+    }
+    //Queued requests never got a buffer, they are posted without one
+    while(1){
+        {
+            std::lock_guard<std::mutex> Guard(Lock);
+            if((QueueTail == QueueHead) || (ResultHead - ResultTail >= READOUT_RESULT_SIZE)){
+                break;
+            }
+            Item = Queue[QueueTail++ & (READOUT_QUEUE_SIZE - 1)];
+            InFlight++;
+        }
+        Aborted.Buffer = READOUT_NONE;
+        Aborted.NodeID = Item.NodeID;
+        Aborted.Item = Item.Item;
+        Aborted.Retries = 0;
+        Aborted.Start = Now;
+        Complete(Aborted, READOUT_ABORTED, Now);
+    }
+}
+
+/************************ EXPORTED OPERATION DEFINITIONS *********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens the readout socket on a CAN interface
+ *
+ *  Arguments   : Interface name
+ *
+ *  Return Value: false when the socket could not be opened
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ReadoutOpen(const char *Interface){
+    struct sockaddr_can Addr;
+    struct can_filter Filter;
+    struct ifreq ifr;
+    ARBITRATION_FIELD FilterID, FilterMask;
+    int Sock, Enable = 1;
+
+    if((Sock = socket(PF_CAN, SOCK_RAW, CAN_RAW)) < 0){
+        return false;
+    }
+
+    FilterMask.Data = 0;
+    FilterMask.Bits.FuntionIdentifier = 0x3F;
+    FilterID.Data = 0;
+    FilterID.Bits.FuntionIdentifier = FID_READOUT_RESPONSE;
+    Filter.can_id   = (FilterID.Data & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    Filter.can_mask = (FilterMask.Data & CAN_EFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, Interface, IFNAMSIZ - 1);
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.can_family = AF_CAN;
+    if((setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FILTER, &Filter, sizeof(Filter)) < 0) ||
+       (setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &Enable, sizeof(Enable)) < 0) ||
+       (ioctl(Sock, SIOCGIFINDEX, &ifr) < 0)){
+        close(Sock);
+        return false;
+    }
+    Addr.can_ifindex = ifr.ifr_ifindex;
+    if(bind(Sock, (struct sockaddr *)&Addr, sizeof(Addr)) < 0){
+        close(Sock);
+        return false;
+    }
+    if(!ReadoutOpenSocket(Sock)){
+        close(Sock);
+        return false;
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Resets the engine state and starts the engine thread
+ *
+ *  Arguments   : Socket
+ *
+ *  Return Value: false when already open
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ReadoutOpenSocket(int Sock){
+    uint32_t Pos;
+
+    if(Opened.load(std::memory_order_acquire)){
+        return false;
+    }
+    WakeFD = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if(WakeFD < 0){
+        return false;
+    }
+    CanFD = Sock;
+
+    //The frame buffers are fixed, so the message headers are set up once
+    memset(RxMsgs, 0, sizeof(RxMsgs));
+    for(Pos = 0; Pos < READOUT_RX_BATCH_SIZE; Pos++){
+        RxIov[Pos].iov_base = &RxFrames[Pos];
+        RxIov[Pos].iov_len  = sizeof(struct canfd_frame);
+        RxMsgs[Pos].msg_hdr.msg_iov    = &RxIov[Pos];
+        RxMsgs[Pos].msg_hdr.msg_iovlen = 1;
+    }
+    memset(TxMsgs, 0, sizeof(TxMsgs));
+    for(Pos = 0; Pos < READOUT_TX_BATCH_SIZE; Pos++){
+        TxIov[Pos].iov_base = &TxFrames[Pos];
+        TxIov[Pos].iov_len  = CAN_MTU;
+        TxMsgs[Pos].msg_hdr.msg_iov    = &TxIov[Pos];
+        TxMsgs[Pos].msg_hdr.msg_iovlen = 1;
+    }
+    TxCount = 0;
+
+    memset(Sessions, 0, sizeof(Sessions));
+    memset(NodeSession, READOUT_NONE, sizeof(NodeSession));
+    {
+        std::lock_guard<std::mutex> Guard(Lock);
+        for(Pos = 0; Pos < READOUT_POOL_SIZE; Pos++){
+            PoolFree[Pos] = (uint8_t)Pos;
+        }
+        PoolFreeCount = READOUT_POOL_SIZE;
+        QueueHead = QueueTail = 0;
+        ResultHead = ResultTail = 0;
+        InFlight = 0;
+        memset(NodeBusy, 0, sizeof(NodeBusy));
+    }
+
+    Running.store(true, std::memory_order_release);
+    Opened.store(true, std::memory_order_release);
+    Engine = std::thread(EngineThread);
+    return true;
+}
+
+void ReadoutClose(){
+    if(!Opened.exchange(false)){
+        return;
+    }
+    Running.store(false, std::memory_order_release);
+    WakeEngine();
+    Engine.join();
+    close(CanFD);
+    close(WakeFD);
+    CanFD = -1;
+    WakeFD = -1;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Queues the readout of one item from one node
+ *
+ *  Arguments   : Node ID, READOUT_ITEM
+ *
+ *  Return Value: false when not queued
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ReadoutRequest(uint8_t NodeID, uint8_t Item){
+    if(!Opened.load(std::memory_order_acquire)){
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> Guard(Lock);
+        if(NodeBusy[NodeID] || (QueueHead - QueueTail >= READOUT_QUEUE_SIZE)){
+            return false;
+        }
+        Queue[QueueHead++ & (READOUT_QUEUE_SIZE - 1)] = {NodeID, Item};
+        NodeBusy[NodeID] = true;
+    }
+    WakeEngine();
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Takes the oldest finished readout
+ *
+ *  Arguments   : Result (out), time to wait in ms
+ *
+ *  Return Value: false when none finished in time
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ReadoutTakeResult(READOUT_RESULT *Result, int TimeoutMs){
+    {
+        std::unique_lock<std::mutex> Guard(Lock);
+        if(!ResultReady.wait_for(Guard, std::chrono::milliseconds(TimeoutMs),
+                                 [](){ return ResultHead != ResultTail; })){
+            return false;
+        }
+        *Result = Results[ResultTail++ & (READOUT_RESULT_SIZE - 1)];
+    }
+    //A result entry came free, the engine may hold back a request for it
+    if(Opened.load(std::memory_order_acquire)){
+        WakeEngine();
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Hands a result buffer back to the pool
+ *
+ *  Arguments   : READOUT_RESULT.Data
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ReadoutRelease(const uint8_t *Data){
+    if(Data == nullptr){
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> Guard(Lock);
+        PoolFree[PoolFreeCount++] = (uint8_t)((Data - Pool[0]) / READOUT_BUFFER_SIZE);
+    }
+    if(Opened.load(std::memory_order_acquire)){
+        WakeEngine();
+    }
+}
+
+void ReadoutGetStats(READOUT_STATS *Stats){
+    Stats->Completed = StatCompleted.load(std::memory_order_relaxed);
+    Stats->Failed = StatFailed.load(std::memory_order_relaxed);
+    Stats->Retries = StatRetries.load(std::memory_order_relaxed);
+    Stats->FramesReceived = StatFramesReceived.load(std::memory_order_relaxed);
+    Stats->FramesUnexpected = StatFramesUnexpected.load(std::memory_order_relaxed);
+    Stats->FramesSent = StatFramesSent.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> Guard(Lock);
+    Stats->InFlight = InFlight;
+    Stats->Queued = QueueHead - QueueTail;
+}
@@ -0,0 +1,178 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : readout.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef READOUT_H
+#define READOUT_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     READOUT_BUFFER_SIZE         4095        //12 bit First Frame length
+#define     READOUT_POOL_SIZE           48          //Reassembly buffers, in flight or held by the reader
+#define     READOUT_MAX_IN_FLIGHT       32          //Nodes read out at the same time
+#define     READOUT_QUEUE_SIZE          256         //Requests waiting for a session, power of 2
+#define     READOUT_RESULT_SIZE         256         //Results not yet taken, power of 2
+#define     READOUT_BLOCK_SIZE          8           //Consecutive Frames per Flow Control
+#define     READOUT_STMIN               0           //Separation time asked from the nodes, ms
+#define     READOUT_RESPONSE_TIMEOUT_MS 250         //Request to First Frame
+#define     READOUT_FRAME_TIMEOUT_MS    150         //Between two Consecutive Frames (N_Cr)
+#define     READOUT_RETRIES             2
+#define     READOUT_RX_BATCH_SIZE       64
+#define     READOUT_TX_BATCH_SIZE       (READOUT_MAX_IN_FLIGHT * 2)
+
+//Protocol Control Information, high nibble of data byte 0
+#define     READOUT_PCI_SINGLE          0x00
+#define     READOUT_PCI_FIRST           0x10
+#define     READOUT_PCI_CONSECUTIVE     0x20
+#define     READOUT_PCI_FLOW            0x30
+
+/********************* ENUMS  *****************************/
+enum READOUT_ITEM {READOUT_ITEM_NVM = 1,
+                   READOUT_ITEM_SW_FIN,
+                   READOUT_ITEM_FAULT_HISTORY};
+
+enum READOUT_STATUS {READOUT_OK = 0,
+                     READOUT_TIMEOUT,       //No answer after READOUT_RETRIES
+                     READOUT_OVERFLOW,      //Longer than READOUT_BUFFER_SIZE
+                     READOUT_SEQUENCE,      //Consecutive Frames lost on every retry
+                     READOUT_ABORTED};      //Engine closed with the request pending
+
+enum READOUT_FLOW_STATUS {READOUT_FLOW_CTS = 0,
+                          READOUT_FLOW_WAIT,
+                          READOUT_FLOW_OVERFLOW};
+
+/********************* Structures  *****************************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Segmented readout of one item from one PDU or panel, in
+ *                the manner of ISO 15765-2 (ISO-TP) on FID_READOUT_CMD and
+ *                FID_READOUT_RESPONSE. The NodeID of the arbitration field is
+ *                the node read out in both directions.
+ *
+ *                CDP -> node (FID_READOUT_CMD, classic frames)
+ *                    Request         : 0x01, Item
+ *                    Flow Control    : 0x30 | READOUT_FLOW_STATUS, Block
+ *                                      size, STmin
+ *
+ *                node -> CDP (FID_READOUT_RESPONSE, classic or CAN-FD)
+ *                    Single Frame    : 0x0L, L data bytes (L <= 7), or on
+ *                                      CAN-FD 0x00, length, data
+ *                    First Frame     : 0x1H, L, data, with the 12 bit total
+ *                                      length HL
+ *                    Consecutive     : 0x2N, data, N counting 1..15, 0..
+ *
+ *                The CDP sends Flow Control after the First Frame and after
+ *                every READOUT_BLOCK_SIZE Consecutive Frames. A node has one
+ *                readout in progress at a time, the engine keeps up to
+ *                READOUT_MAX_IN_FLIGHT nodes going at once.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint8_t         NodeID;
+    uint8_t         Item;
+    uint8_t         Status;         //READOUT_STATUS
+    uint8_t         Retries;        //Requests repeated after a timeout or lost frame
+    uint16_t        Length;
+    const uint8_t  *Data;           //Pooled, hand back with ReadoutRelease
+    uint64_t        DurationNs;     //First request to last frame
+}READOUT_RESULT;
+
+typedef struct{
+    uint64_t    Completed;
+    uint64_t    Failed;
+    uint64_t    Retries;
+    uint64_t    FramesReceived;
+    uint64_t    FramesUnexpected;   //No session waiting for them
+    uint64_t    FramesSent;
+    uint32_t    InFlight;
+    uint32_t    Queued;
+}READOUT_STATS;
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens a raw CAN socket on the interface for the readout
+ *                Function IDs and starts the engine thread
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ReadoutOpen(const char *Interface);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Starts the engine on a socket that is already set up and
+ *                carries CAN_MTU / CANFD_MTU sized canfd_frame messages. The
+ *                engine closes it in ReadoutClose.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ReadoutOpenSocket(int Sock);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Stops the engine. Requests still pending complete with
+ *                READOUT_ABORTED.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ReadoutClose();
+
+/*-----------------------------------------------------------------------------
+ *  Description : Queues the readout of one item from one node. Returns false
+ *                when the queue is full or the node already has a readout
+ *                queued or in progress. Any thread.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ReadoutRequest(uint8_t NodeID, uint8_t Item);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Takes the oldest finished readout, waiting up to TimeoutMs
+ *                for one (0 does not wait). Any thread.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ReadoutTakeResult(READOUT_RESULT *Result, int TimeoutMs);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Hands the buffer of a taken result back to the pool
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ReadoutRelease(const uint8_t *Data);
+
+void ReadoutGetStats(READOUT_STATS *Stats);
+
+#endif // READOUT_H
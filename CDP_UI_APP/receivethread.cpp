@@ -0,0 +1,9 @@
+#include <QList>
+#include "common.h"
+
+
+QList<CAN_DATA>		canData;
+
+void receiveThread(){
+
+}
@@ -0,0 +1,212 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : sectionlayout.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "sectionlayout.h"
+#include "lrudata.h"
+#include <stdlib.h>
+#include <string.h>
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static const SectionZone MainDeckZones[] = {
+    { 500,  50, 320, 165, "SecButton1.png", "SecButton1G.png"},
+    { 500, 240, 320, 165, "SecButton2.png", "SecButton2G.png"},
+    { 830,  50, 280, 170, "SecButton3.png", "SecButton3G.png"},
+    { 830, 240, 280, 170, "SecButton4.png", "SecButton4G.png"},
+    {1120,  50, 320, 165, "SecButton5.png", "SecButton5G.png"},
+    {1120, 240, 320, 165, "SecButton6.png", "SecButton6G.png"}};
+
+//Zone, type, node, X, Y, width, height, label. Left PDUs are _PDU[0..58],
+//right PDUs _PDU[59..115] (see PDUNodes in candispatch.cpp).
+static const SectionItem MainDeckItems[] = {
+    {1, SECTION_PDU, 57,     1130,  80,  41, 141, "TL09" },
+    {1, SECTION_PDU, 56,     1230,  80,  41, 141, "TL08" },
+    {1, SECTION_PDU, 58,      990,  90,  41, 141, "TL10" },
+    {1, SECTION_PDU, 49,      480, 250,  41, 141, "L50"  },
+    {1, SECTION_PDU, 48,      550, 250,  41, 141, "L49"  },
+    {1, SECTION_PDU, 47,      610, 250,  41, 141, "L48"  },
+    {1, SECTION_PDU, 46,      680, 250,  41, 141, "L47"  },
+    {1, SECTION_PDU, 45,      740, 250,  41, 141, "L46"  },
+    {1, SECTION_PDU, 44,      810, 250,  41, 141, "L45"  },
+    {1, SECTION_PDU, 43,      870, 250,  41, 141, "L44"  },
+    {1, SECTION_PDU, 42,      930, 250,  41, 141, "L43"  },
+    {1, SECTION_PDU, 41,      990, 250,  41, 141, "L42"  },
+    {1, SECTION_PDU, 40,     1060, 250,  41, 141, "L41"  },
+    {1, SECTION_PDU, 39,     1130, 250,  41, 141, "L40"  },
+    {1, SECTION_PDU, 38,     1190, 250,  41, 141, "L39"  },
+    {1, SECTION_PDU, 37,     1260, 250,  41, 141, "L38"  },
+    {1, SECTION_PDU, 36,     1320, 250,  41, 141, "L37"  },
+    {1, SECTION_PDU, 35,     1390, 250,  41, 141, "L36"  },
+    {1, SECTION_PDU, 34,     1450, 250,  41, 141, "L35"  },
+    {1, SECTION_PDU, 33,     1510, 250,  41, 141, "L34"  },
+    {1, SECTION_PDU, 55,      990, 410,  41, 141, "TL07" },
+    {1, SECTION_PDU, 54,     1130, 410,  41, 141, "TL05" },
+    {1, SECTION_PDU, 53,     1240, 410,  41, 141, "TL04" },
+    {1, SECTION_PDU, 52,     1330, 410,  41, 141, "TL03" },
+    {1, SECTION_PDU, 51,     1420, 410,  41, 141, "TL02" },
+    {1, SECTION_PDU, 50,     1510, 410,  41, 141, "TL01" },
+    {1, SECTION_OCP, 0,       950,  30,  81,  51, "OCP"  },
+    {1, SECTION_MCP, 0,       840,  90,  81, 111, "MCP"  },
+
+    {2, SECTION_PDU, 115,     960,  70,  41, 141, "TR07" },
+    {2, SECTION_PDU, 114,    1030,  70,  41, 141, "TR06" },
+    {2, SECTION_PDU, 113,    1090,  70,  41, 141, "TR05" },
+    {2, SECTION_PDU, 112,    1200,  70,  41, 141, "TR04" },
+    {2, SECTION_PDU, 111,    1290,  70,  41, 141, "TR03" },
+    {2, SECTION_PDU, 110,    1380,  70,  41, 141, "TR02" },
+    {2, SECTION_PDU, 109,    1470,  70,  41, 141, "TR01" },
+    {2, SECTION_PDU, 108,     440, 230,  41, 141, "R50"  },
+    {2, SECTION_PDU, 107,     500, 230,  41, 141, "R49"  },
+    {2, SECTION_PDU, 106,     570, 230,  41, 141, "R48"  },
+    {2, SECTION_PDU, 105,     630, 230,  41, 141, "R47"  },
+    {2, SECTION_PDU, 104,     700, 230,  41, 141, "R46"  },
+    {2, SECTION_PDU, 103,     760, 230,  41, 141, "R45"  },
+    {2, SECTION_PDU, 102,     830, 230,  41, 141, "R44"  },
+    {2, SECTION_PDU, 101,     890, 230,  41, 141, "R43"  },
+    {2, SECTION_PDU, 100,     950, 230,  41, 141, "R42"  },
+    {2, SECTION_PDU, 99,     1010, 230,  41, 141, "R41"  },
+    {2, SECTION_PDU, 98,     1080, 230,  41, 141, "R40"  },
+    {2, SECTION_PDU, 97,     1150, 230,  41, 141, "R39"  },
+    {2, SECTION_PDU, 96,     1220, 230,  41, 141, "R38"  },
+    {2, SECTION_PDU, 95,     1280, 230,  41, 141, "R37"  },
+    {2, SECTION_PDU, 94,     1350, 230,  41, 141, "R36"  },
+    {2, SECTION_PDU, 93,     1410, 230,  41, 141, "R35"  },
+    {2, SECTION_PDU, 92,     1470, 230,  41, 141, "R34"  },
+    {2, SECTION_ICP, 0,       770, 430,  81, 111, "ICP"  },
+
+    {3, SECTION_PDU, 32,      560, 190,  41, 141, "L33"  },
+    {3, SECTION_PDU, 31,      620, 190,  41, 141, "L32"  },
+    {3, SECTION_PDU, 30,      690, 190,  41, 141, "L31"  },
+    {3, SECTION_PDU, 29,      750, 190,  41, 141, "L30"  },
+    {3, SECTION_PDU, 28,      820, 190,  41, 141, "L29"  },
+    {3, SECTION_PDU, 27,      880, 190,  41, 141, "L28"  },
+    {3, SECTION_PDU, 26,      940, 190,  41, 141, "L27"  },
+    {3, SECTION_PDU, 25,     1000, 190,  41, 141, "L26"  },
+    {3, SECTION_PDU, 24,     1070, 190,  41, 141, "L25"  },
+    {3, SECTION_PDU, 23,     1140, 190,  41, 141, "L24"  },
+    {3, SECTION_PDU, 22,     1200, 190,  41, 141, "L23"  },
+    {3, SECTION_PDU, 21,     1270, 190,  41, 141, "L22"  },
+    {3, SECTION_PDU, 20,     1330, 190,  41, 141, "L21"  },
+    {3, SECTION_PDU, 19,     1400, 190,  41, 141, "L20"  },
+    {3, SECTION_PDU, 18,     1460, 190,  41, 141, "L19"  },
+    {3, SECTION_PDU, 17,     1520, 190,  41, 141, "L18"  },
+    {3, SECTION_LCP, LCP4LH,  620,  90, 101,  61, "4LH"  },
+    {3, SECTION_LCP, LCP3LH, 1140,  90, 101,  61, "3LH"  },
+
+    {4, SECTION_PDU, 76,      450, 140,  41, 141, "R33"  },
+    {4, SECTION_PDU, 77,      510, 140,  41, 141, "R32"  },
+    {4, SECTION_PDU, 78,      580, 140,  41, 141, "R31"  },
+    {4, SECTION_PDU, 79,      640, 140,  41, 141, "R30"  },
+    {4, SECTION_PDU, 80,      710, 140,  41, 141, "R29"  },
+    {4, SECTION_PDU, 81,      770, 140,  41, 141, "R28"  },
+    {4, SECTION_PDU, 82,      830, 140,  41, 141, "R27"  },
+    {4, SECTION_PDU, 83,      890, 140,  41, 141, "R26"  },
+    {4, SECTION_PDU, 84,      960, 140,  41, 141, "R25"  },
+    {4, SECTION_PDU, 85,     1030, 140,  41, 141, "R24"  },
+    {4, SECTION_PDU, 86,     1090, 140,  41, 141, "R23"  },
+    {4, SECTION_PDU, 87,     1160, 140,  41, 141, "R22"  },
+    {4, SECTION_PDU, 88,     1220, 140,  41, 141, "R21"  },
+    {4, SECTION_PDU, 89,     1290, 140,  41, 141, "R20"  },
+    {4, SECTION_PDU, 90,     1350, 140,  41, 141, "R19"  },
+    {4, SECTION_PDU, 91,     1410, 140,  41, 141, "R18"  },
+    {4, SECTION_LCP, LCP4RH,  520, 330, 101,  61, "4RH"  },
+    {4, SECTION_LCP, LCP3RH, 1040, 330, 101,  61, "3RH"  },
+
+    {5, SECTION_PDU, 16,      350, 220,  41, 141, "L17"  },
+    {5, SECTION_PDU, 15,      410, 220,  41, 141, "L16"  },
+    {5, SECTION_PDU, 14,      470, 220,  41, 141, "L15"  },
+    {5, SECTION_PDU, 13,      540, 220,  41, 141, "L14"  },
+    {5, SECTION_PDU, 12,      600, 220,  41, 141, "L13"  },
+    {5, SECTION_PDU, 11,      670, 220,  41, 141, "L12"  },
+    {5, SECTION_PDU, 10,      730, 220,  41, 141, "L11"  },
+    {5, SECTION_PDU, 9,       790, 220,  41, 141, "L10"  },
+    {5, SECTION_PDU, 8,       850, 220,  41, 141, "L09"  },
+    {5, SECTION_PDU, 7,       920, 220,  41, 141, "L08"  },
+    {5, SECTION_PDU, 6,       990, 220,  41, 141, "L07"  },
+    {5, SECTION_PDU, 5,      1050, 220,  41, 141, "L06"  },
+    {5, SECTION_PDU, 4,      1120, 220,  41, 141, "L05"  },
+    {5, SECTION_PDU, 3,      1180, 220,  41, 141, "L04"  },
+    {5, SECTION_PDU, 2,      1250, 220,  41, 141, "L03"  },
+    {5, SECTION_PDU, 1,      1310, 220,  41, 141, "L02"  },
+    {5, SECTION_PDU, 0,      1370, 220,  41, 141, "L01"  },
+    {5, SECTION_LCP, LCP2LH,  470, 120, 101,  61, "2LH"  },
+    {5, SECTION_LCP, LCP1LH,  990, 120, 101,  61, "1LH"  },
+
+    {6, SECTION_PDU, 75,      370, 130,  41, 141, "R17"  },
+    {6, SECTION_PDU, 74,      430, 130,  41, 141, "R16"  },
+    {6, SECTION_PDU, 73,      490, 130,  41, 141, "R15"  },
+    {6, SECTION_PDU, 72,      560, 130,  41, 141, "R14"  },
+    {6, SECTION_PDU, 71,      620, 130,  41, 141, "R13"  },
+    {6, SECTION_PDU, 70,      690, 130,  41, 141, "R12"  },
+    {6, SECTION_PDU, 69,      750, 130,  41, 141, "R11"  },
+    {6, SECTION_PDU, 68,      810, 130,  41, 141, "R10"  },
+    {6, SECTION_PDU, 67,      870, 130,  41, 141, "R09"  },
+    {6, SECTION_PDU, 66,      940, 130,  41, 141, "R08"  },
+    {6, SECTION_PDU, 65,     1010, 130,  41, 141, "R07"  },
+    {6, SECTION_PDU, 64,     1070, 130,  41, 141, "R06"  },
+    {6, SECTION_PDU, 63,     1140, 130,  41, 141, "R05"  },
+    {6, SECTION_PDU, 62,     1200, 130,  41, 141, "R04"  },
+    {6, SECTION_PDU, 61,     1270, 130,  41, 141, "R03"  },
+    {6, SECTION_PDU, 60,     1330, 130,  41, 141, "R02"  },
+    {6, SECTION_PDU, 59,     1390, 130,  41, 141, "R01"  },
+    {6, SECTION_LCP, LCP2RH,  500, 320, 101,  61, "2RH"  },
+    {6, SECTION_LCP, LCP1RH, 1020, 320, 101,  61, "1RH"  }};
+
+static const SectionLayout SectionLayouts[] = {
+    {"main", MainDeckZones, sizeof(MainDeckZones) / sizeof(MainDeckZones[0]),
+             MainDeckItems, sizeof(MainDeckItems) / sizeof(MainDeckItems[0])}};
+
+/*-----------------------------------------------------------------------------
+ *  Description : Returns the layout named by CDP_DECK_LAYOUT, or the first
+ *                one when it is not set or not known
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: Layout
+ *
+ *-----------------------------------------------------------------------------
+ */
+const SectionLayout *GetSectionLayout()
+{
+    const char *Name = getenv(SECTION_LAYOUT_ENV);
+    size_t Pos;
+
+    for(Pos = 0; Name != nullptr && Pos < sizeof(SectionLayouts) / sizeof(SectionLayouts[0]); Pos++){
+        if(strcmp(SectionLayouts[Pos].Name, Name) == 0){
+            return &SectionLayouts[Pos];
+        }
+    }
+    return &SectionLayouts[0];
+}
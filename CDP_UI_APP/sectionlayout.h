@@ -0,0 +1,100 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : sectionlayout.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef SECTIONLAYOUT_H
+#define SECTIONLAYOUT_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     SECTION_LAYOUT_ENV      "CDP_DECK_LAYOUT"   //Layout name, the first one by default
+
+/********************* ENUMS  *****************************/
+enum SECTION_ITEM_TYPE {SECTION_PDU = 0,        //Node is the PDU index
+                        SECTION_MCP,
+                        SECTION_ICP,
+                        SECTION_OCP,
+                        SECTION_LCP};           //Node is the LCP_NUM
+
+/********************* Structures  *****************************/
+/*-----------------------------------------------------------------------------
+ *  Description : Continuous monitoring layout of a deck. Each zone has a
+ *                selection button on the overview; the items of a zone are
+ *                the LRU buttons shown in the section area when it is
+ *                selected, placed relative to that area. A new deck variant
+ *                is a new table in SectionLayouts (sectionlayout.cpp).
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    uint16_t    X;
+    uint16_t    Y;
+    uint16_t    Width;
+    uint16_t    Height;
+    const char  *Image;                 //Under BaseFolder
+    const char  *SelectedImage;
+}SectionZone;
+
+typedef struct{
+    uint8_t     Zone;                   //1 based, as labelled on the overview
+    uint8_t     Type;                   //SECTION_ITEM_TYPE
+    uint8_t     Node;
+    uint16_t    X;
+    uint16_t    Y;
+    uint8_t     Width;
+    uint8_t     Height;
+    const char  *Label;                 //Button text
+}SectionItem;
+
+typedef struct{
+    const char          *Name;
+    const SectionZone   *Zones;
+    uint8_t             ZoneCount;
+    const SectionItem   *Items;
+    uint16_t            ItemCount;
+}SectionLayout;
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Returns the layout named by CDP_DECK_LAYOUT, or the first
+ *                one when it is not set or not known
+ *
+ *-----------------------------------------------------------------------------
+ */
+const SectionLayout *GetSectionLayout();
+
+#endif // SECTIONLAYOUT_H
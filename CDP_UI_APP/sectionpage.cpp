@@ -0,0 +1,113 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : sectionpage.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "sectionpage.h"
+
+/*-----------------------------------------------------------------------------
+ *  Description : This is the constructor for the Section Page application
+ *
+ *  Arguments   : Section layout, Parent Class
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+SectionPage::SectionPage(const SectionLayout *Layout, QWidget *parent) :
+    QWidget(parent),
+    Layout(Layout),
+    Detail(parent)
+{
+    ItemButtons = new QButtonGroup(this);
+#if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
+    connect(ItemButtons, SIGNAL(idClicked(int)), this, SLOT(HandleItemButton(int)));
+#else
+    connect(ItemButtons, SIGNAL(buttonClicked(int)), this, SLOT(HandleItemButton(int)));
+#endif
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Lays out the buttons of a zone, the button id is the index
+ *                of its item in the layout
+ *
+ *  Arguments   : Zone
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void SectionPage::ShowZone(int Zone)
+{
+    QPushButton *Button;
+    int Item;
+    int Used = 0;
+
+    for(Item = 0; Item < Layout->ItemCount; Item++){
+        const SectionItem &Entry = Layout->Items[Item];
+
+        if(Entry.Zone != Zone){
+            continue;
+        }
+        if(Used == Buttons.size()){
+            Button = new QPushButton(this);
+            Buttons.append(Button);
+            ItemButtons->addButton(Button);
+        }
+        Button = Buttons[Used++];
+        Button->setGeometry(Entry.X, Entry.Y, Entry.Width, Entry.Height);
+        Button->setText(Entry.Label);
+        ItemButtons->setId(Button, Item);
+        Button->show();
+    }
+    for(; Used < Buttons.size(); Used++){
+        Buttons[Used]->hide();
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Navigation implementation to the status page of an item
+ *
+ *  Arguments   : Item index in the layout
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void SectionPage::HandleItemButton(int Item)
+{
+    if(Item >= 0 && Item < Layout->ItemCount){
+        Detail.Show(Layout->Items[Item]);
+    }
+}
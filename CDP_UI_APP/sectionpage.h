@@ -0,0 +1,74 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : sectionpage.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef SECTIONPAGE_H
+#define SECTIONPAGE_H
+
+/****************************** HEADER FILES *********************************/
+#include <QWidget>
+#include <QPushButton>
+#include <QButtonGroup>
+#include <QVector>
+#include "sectionlayout.h"
+#include "lrudetailview.h"
+
+/*-----------------------------------------------------------------------------
+ *  Description : LRU buttons of the selected zone of a section layout. The
+ *                buttons are reused from zone to zone, so there are only as
+ *                many as the largest zone has items, and every zone opens
+ *                the same LRU detail view.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class SectionPage : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit SectionPage(const SectionLayout *Layout, QWidget *parent = 0);
+
+    void ShowZone(int Zone);
+
+private slots:
+    void HandleItemButton(int Item);
+
+private:
+    const SectionLayout     *Layout;
+    QButtonGroup            *ItemButtons;
+    QVector<QPushButton *>  Buttons;
+    LRUDetailView           Detail;
+};
+
+#endif // SECTIONPAGE_H
@@ -0,0 +1,253 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : signalcodec.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef SIGNALCODEC_H
+#define SIGNALCODEC_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+#include <cstddef>
+
+/*-----------------------------------------------------------------------------
+ *  Description : Compile time CAN signal codec. A signal is described once by
+ *                its start bit, width, byte order and value type, and the
+ *                shift/mask extract and pack code is generated from that
+ *                description. The messages of the ICD are described with it
+ *                in icdsignals.h.
+ *
+ *                The 64 bit payload always holds data byte 0 in its least
+ *                significant byte (see DecodePayload), independent of the host
+ *                byte order, so the same description works on the display and
+ *                on a desktop build.
+ *
+ *                SIGNAL_INTEL    : StartBit is the LSB of the signal, counted
+ *                                  from bit 0 of data byte 0 upwards.
+ *                SIGNAL_MOTOROLA : StartBit is the MSB of the signal, counted
+ *                                  from bit 7 of data byte 0 downwards, i.e.
+ *                                  the signal is big endian on the wire.
+ *
+ *-----------------------------------------------------------------------------
+ */
+enum SIGNAL_ORDER {SIGNAL_INTEL, SIGNAL_MOTOROLA};
+
+/*-----------------------------------------------------------------------------
+ *  Description : Assembles the CAN data bytes into the 64 bit payload. Byte 0
+ *                is the least significant byte.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static inline uint64_t DecodePayload(const uint8_t *Data, uint8_t DLC){
+    uint64_t Payload = 0;
+    uint8_t  Pos;
+    uint8_t  Len = (DLC > 8) ? 8 : DLC;
+
+    for(Pos = Len; Pos > 0; Pos--){
+        Payload = (Payload << 8) | Data[Pos - 1];
+    }
+    return Payload;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Splits the 64 bit payload back into the CAN data bytes
+ *
+ *-----------------------------------------------------------------------------
+ */
+static inline void EncodePayload(uint64_t Payload, uint8_t *Data){
+    uint8_t Pos;
+
+    for(Pos = 0; Pos < 8; Pos++){
+        Data[Pos] = (uint8_t)(Payload >> (8 * Pos));
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Read only view of the data bytes of one received frame. It
+ *                points into the frame and copies nothing.
+ *
+ *                A CAN-FD frame carries up to 8 payload words of 8 bytes.
+ *                Word(n) assembles word n the same way DecodePayload does for
+ *                a classic frame, so every message description applies to
+ *                any word of a frame unchanged.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class PayloadView
+{
+public:
+    PayloadView(const uint8_t *Data, uint8_t Length) : Data(Data), Length(Length) {}
+
+    const uint8_t *GetData() const  { return Data; }
+    uint8_t GetLength() const       { return Length; }
+    uint8_t GetWordCount() const    { return (uint8_t)((Length + 7) / 8); }
+
+    uint64_t Word(uint8_t Index) const {
+        uint32_t Offset = (uint32_t)Index * 8;
+
+        return (Offset < Length) ? DecodePayload(Data + Offset, (uint8_t)(Length - Offset)) : 0;
+    }
+
+private:
+    const uint8_t  *Data;
+    uint8_t         Length;
+};
+
+static constexpr uint64_t ByteSwap64(uint64_t Value){
+    return ((Value & 0x00000000000000FFULL) << 56) | ((Value & 0x000000000000FF00ULL) << 40) |
+           ((Value & 0x0000000000FF0000ULL) << 24) | ((Value & 0x00000000FF000000ULL) << 8)  |
+           ((Value & 0x000000FF00000000ULL) >> 8)  | ((Value & 0x0000FF0000000000ULL) >> 24) |
+           ((Value & 0x00FF000000000000ULL) >> 40) | ((Value & 0xFF00000000000000ULL) >> 56);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : One signal of a message
+ *
+ *                Get/Set work on the raw value, Value returns it converted to
+ *                Type (e.g. one of the state enums). Extract writes the raw
+ *                value of a whole array of payloads; the loop has no branches
+ *                so the compiler vectorises it.
+ *
+ *-----------------------------------------------------------------------------
+ */
+template <uint8_t StartBit, uint8_t Width, typename Type = uint64_t,
+          SIGNAL_ORDER Order = SIGNAL_INTEL>
+struct Signal
+{
+    static_assert(Width > 0 && Width <= 64, "Signal width out of range");
+
+    typedef Type ValueType;
+
+    //Bit position of the LSB within the payload word of the given order
+    static constexpr uint32_t Shift = (Order == SIGNAL_INTEL) ?
+                StartBit : (uint32_t)(63 - (StartBit ^ 7) - (Width - 1));
+
+    static_assert((Order == SIGNAL_INTEL) ? (StartBit + Width <= 64) :
+                  ((StartBit ^ 7) + Width <= 64), "Signal does not fit the payload");
+
+    static constexpr uint64_t Mask = (Width == 64) ? ~0ULL : ((1ULL << Width) - 1);
+
+    //Bits covered in the payload as assembled by DecodePayload
+    static constexpr uint64_t PayloadMask = (Order == SIGNAL_INTEL) ?
+                (Mask << Shift) : ByteSwap64(Mask << Shift);
+
+    static constexpr uint64_t Get(uint64_t Payload){
+        return ((Order == SIGNAL_INTEL ? Payload : ByteSwap64(Payload)) >> Shift) & Mask;
+    }
+
+    static constexpr Type Value(uint64_t Payload){
+        return static_cast<Type>(Get(Payload));
+    }
+
+    static constexpr uint64_t Set(uint64_t Payload, uint64_t Raw){
+        return (Order == SIGNAL_INTEL) ?
+                    ((Payload & ~PayloadMask) | ((Raw & Mask) << Shift)) :
+                    ((Payload & ~PayloadMask) | ByteSwap64((Raw & Mask) << Shift));
+    }
+
+    template <typename Out>
+    static void Extract(const uint64_t *Payload, Out *Raw, size_t Count){
+        for(size_t Pos = 0; Pos < Count; Pos++){
+            Raw[Pos] = static_cast<Out>(Get(Payload[Pos]));
+        }
+    }
+};
+
+/*-----------------------------------------------------------------------------
+ *  Description : Signal with a linear conversion to engineering units,
+ *                Physical = Raw * Num / Den + Bias
+ *
+ *-----------------------------------------------------------------------------
+ */
+template <typename Raw, int32_t Num, int32_t Den = 1, int32_t Bias = 0>
+struct ScaledSignal : Raw
+{
+    static_assert(Den != 0, "Signal scale denominator is zero");
+
+    static constexpr double Physical(uint64_t Payload){
+        return ((double)Raw::Get(Payload) * Num) / Den + Bias;
+    }
+
+    static constexpr uint64_t SetPhysical(uint64_t Payload, double Value){
+        return Raw::Set(Payload, (uint64_t)(((Value - Bias) * Den) / Num + 0.5));
+    }
+};
+
+/*-----------------------------------------------------------------------------
+ *  Description : Checks a message description at compile time, no two
+ *                signals may share a payload bit
+ *
+ *-----------------------------------------------------------------------------
+ */
+template <typename... Signals>
+struct SignalLayout
+{
+    static constexpr bool Disjoint(){
+        const uint64_t Masks[] = {0, Signals::PayloadMask...};
+        uint64_t Used = 0;
+
+        for(size_t Pos = 0; Pos < sizeof(Masks) / sizeof(Masks[0]); Pos++){
+            if((Used & Masks[Pos]) != 0){
+                return false;
+            }
+            Used |= Masks[Pos];
+        }
+        return true;
+    }
+
+    static constexpr uint64_t UsedMask(){
+        const uint64_t Masks[] = {0, Signals::PayloadMask...};
+        uint64_t Used = 0;
+
+        for(size_t Pos = 0; Pos < sizeof(Masks) / sizeof(Masks[0]); Pos++){
+            Used |= Masks[Pos];
+        }
+        return Used;
+    }
+
+    //Position of the signal holding a payload bit in the list, from 1, 0 when none does
+    static constexpr uint8_t SignalNumber(uint8_t Bit){
+        const uint64_t Masks[] = {0, Signals::PayloadMask...};
+
+        for(size_t Pos = 1; Pos < sizeof(Masks) / sizeof(Masks[0]); Pos++){
+            if(((Masks[Pos] >> Bit) & 1) != 0){
+                return (uint8_t)Pos;
+            }
+        }
+        return 0;
+    }
+
+    static constexpr size_t Count = sizeof...(Signals);
+};
+
+#endif // SIGNALCODEC_H
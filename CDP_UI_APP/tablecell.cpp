@@ -0,0 +1,86 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : tablecell.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "tablecell.h"
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sets the text of one status table cell
+ *
+ *  Arguments   : Table, Row, Column, Text
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void SetCell(QTableWidget *Table, int Row, int Column, const QString &Text)
+{
+    QTableWidgetItem *Item = Table->item(Row, Column);
+
+    if(Item == nullptr){
+        Table->setItem(Row, Column, new QTableWidgetItem(Text));
+    }
+    else if(Item->text() != Text){
+        Item->setText(Text);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sets a numeric status table cell. The value shown is kept in
+ *                Qt::UserRole to compare against without formatting.
+ *
+ *  Arguments   : Table, Row, Column, Value
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void SetCell(QTableWidget *Table, int Row, int Column, qulonglong Value)
+{
+    QTableWidgetItem *Item = Table->item(Row, Column);
+    QVariant Shown;
+
+    if(Item == nullptr){
+        Item = new QTableWidgetItem();
+        Table->setItem(Row, Column, Item);
+    }
+
+    Shown = Item->data(Qt::UserRole);
+    if(Shown.isValid() && Shown.toULongLong() == Value){
+        return;
+    }
+    Item->setData(Qt::UserRole, Value);
+    Item->setText(QString::number(Value));
+}
@@ -0,0 +1,62 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : tablecell.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef TABLECELL_H
+#define TABLECELL_H
+
+/****************************** HEADER FILES *********************************/
+#include <QTableWidget>
+#include <QString>
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sets the text of one status table cell. The item is created
+ *                on the first call only, later calls change its text in place
+ *                and only when it differs, so the table model emits
+ *                dataChanged for that one cell. Pass QStringLiteral texts to
+ *                keep the update free of heap allocations.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void SetCell(QTableWidget *Table, int Row, int Column, const QString &Text);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sets a numeric status table cell. The text is only formatted
+ *                when the value differs from the one shown.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void SetCell(QTableWidget *Table, int Row, int Column, qulonglong Value);
+
+#endif // TABLECELL_H
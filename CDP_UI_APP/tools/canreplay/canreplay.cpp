@@ -0,0 +1,493 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : canreplay.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/*
+ *  CAN capture, replay and parser benchmark tool.
+ *
+ *  canreplay record <interface> <file> [seconds]
+ *      Captures every frame seen on the interface into a binary log
+ *      (canlog.h format) with its kernel receive time.
+ *
+ *  canreplay replay <file> <interface> [speed]
+ *      Sends the log back onto the interface (e.g. vcan0) with the original
+ *      frame spacing divided by speed. Speed 0 sends as fast as possible.
+ *      Start CDP_UI_APP with CDP_CAN_IF=vcan0 to drive the real UI.
+ *
+ *  canreplay bench <file> [loops] [trace_file] [telemetry_file]
+ *      Feeds the log through canBuffer into the application parser, with no
+ *      socket and no UI, and reports frames/sec, push to batch parsed latency
+ *      percentiles and heap allocations per frame. The per stage trace
+ *      histograms and FID counts of the run go to trace_file if given, the
+ *      PDU telemetry store to telemetry_file (pdutelemetry.h format).
+ */
+
+/****************************** HEADER FILES *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <new>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <net/if.h>
+#include <linux/can/raw.h>
+#include "canlog.h"
+#include "canringbuffer.h"
+#include "candispatch.h"
+#include "parser.h"
+#include "trace.h"
+#include "pdutelemetry.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     REPLAY_NS_PER_SEC           1000000000ULL
+#define     REPLAY_IO_BUFFER            (1024 * 1024)
+#define     BENCH_RING_HIGH_WATER       (CAN_RING_SIZE - PARSER_BATCH_SIZE)
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static volatile sig_atomic_t StopCapture = 0;
+
+//Heap allocations made by the current thread, see operator new below
+static thread_local uint64_t ThreadAllocs = 0;
+
+void *operator new(size_t Size){
+    void *Ptr = malloc(Size ? Size : 1);
+    if(Ptr == NULL){
+        throw std::bad_alloc();
+    }
+    ThreadAllocs++;
+    return Ptr;
+}
+
+void operator delete(void *Ptr) noexcept{
+    free(Ptr);
+}
+
+void operator delete(void *Ptr, size_t) noexcept{
+    free(Ptr);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Clock helpers
+ *
+ *-----------------------------------------------------------------------------
+ */
+static uint64_t ClockNs(clockid_t Clock){
+    struct timespec Now;
+    clock_gettime(Clock, &Now);
+    return ((uint64_t)Now.tv_sec * REPLAY_NS_PER_SEC) + (uint64_t)Now.tv_nsec;
+}
+
+static void SleepUntil(uint64_t Deadline){
+    struct timespec Ts;
+    Ts.tv_sec = Deadline / REPLAY_NS_PER_SEC;
+    Ts.tv_nsec = Deadline % REPLAY_NS_PER_SEC;
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &Ts, NULL) == EINTR){
+    }
+}
+
+static void HandleStop(int){
+    StopCapture = 1;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens a raw CAN socket bound to the named interface, with no
+ *                receive filter. CAN-FD frames are enabled when the interface
+ *                supports them.
+ *
+ *  Arguments   : Interface name
+ *
+ *  Return Value: Socket, -1 on error
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int OpenRawSocket(const char *Interface){
+    struct sockaddr_can Addr;
+    struct ifreq ifr;
+    int Enable = 1;
+    int Sock = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+
+    if(Sock < 0){
+        perror("socket");
+        return -1;
+    }
+    setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &Enable, sizeof(Enable));
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, Interface, IFNAMSIZ - 1);
+    if(ioctl(Sock, SIOCGIFINDEX, &ifr) < 0){
+        perror("SIOCGIFINDEX");
+        close(Sock);
+        return -1;
+    }
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.can_family = AF_CAN;
+    Addr.can_ifindex = ifr.ifr_ifindex;
+    if(bind(Sock, (struct sockaddr *)&Addr, sizeof(Addr)) < 0){
+        perror("bind");
+        close(Sock);
+        return -1;
+    }
+    return Sock;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Maps a capture log read-only and checks its header
+ *
+ *  Arguments   : File name, returned record pointer and count
+ *
+ *  Return Value: Mapped header, NULL on error
+ *
+ *-----------------------------------------------------------------------------
+ */
+static const CAN_LOG_HEADER *MapLog(const char *FileName, const CAN_LOG_RECORD **Records,
+                                    size_t *Count, size_t *MapSize){
+    struct stat St;
+    const CAN_LOG_HEADER *Header;
+    void *Map;
+    int Fd = open(FileName, O_RDONLY | O_CLOEXEC);
+
+    if(Fd < 0){
+        perror(FileName);
+        return NULL;
+    }
+    if((fstat(Fd, &St) < 0) || ((size_t)St.st_size < sizeof(CAN_LOG_HEADER))){
+        fprintf(stderr, "%s: not a CAN log\n", FileName);
+        close(Fd);
+        return NULL;
+    }
+    Map = mmap(NULL, St.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, Fd, 0);
+    close(Fd);
+    if(Map == MAP_FAILED){
+        perror("mmap");
+        return NULL;
+    }
+    Header = (const CAN_LOG_HEADER *)Map;
+    if((Header->Magic != CAN_LOG_MAGIC) || (Header->Version != CAN_LOG_VERSION) ||
+       (Header->RecordSize != sizeof(CAN_LOG_RECORD))){
+        fprintf(stderr, "%s: unsupported CAN log\n", FileName);
+        munmap(Map, St.st_size);
+        return NULL;
+    }
+    *Records = (const CAN_LOG_RECORD *)(Header + 1);
+    *Count = (St.st_size - sizeof(CAN_LOG_HEADER)) / sizeof(CAN_LOG_RECORD);
+    *MapSize = St.st_size;
+    return Header;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : record mode. Writes every received frame with its kernel
+ *                timestamp until the time limit or SIGINT.
+ *
+ *  Arguments   : Interface, file name, seconds (0 = until SIGINT)
+ *
+ *  Return Value: Exit code
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int Record(const char *Interface, const char *FileName, unsigned Seconds){
+    CAN_LOG_HEADER Header;
+    CAN_LOG_RECORD Rec;
+    struct canfd_frame Frame;
+    struct iovec Iov;
+    struct msghdr Msg;
+    struct cmsghdr *Cmsg;
+    char Control[CMSG_SPACE(sizeof(struct timespec))];
+    uint64_t RxTime, Frames = 0;
+    ssize_t Size;
+    int Enable = 1;
+    int Sock = OpenRawSocket(Interface);
+    FILE *Out;
+
+    if(Sock < 0){
+        return 1;
+    }
+    setsockopt(Sock, SOL_SOCKET, SO_TIMESTAMPNS, &Enable, sizeof(Enable));
+    Out = fopen(FileName, "wb");
+    if(Out == NULL){
+        perror(FileName);
+        close(Sock);
+        return 1;
+    }
+    setvbuf(Out, NULL, _IOFBF, REPLAY_IO_BUFFER);
+
+    memset(&Header, 0, sizeof(Header));
+    Header.Magic = CAN_LOG_MAGIC;
+    Header.Version = CAN_LOG_VERSION;
+    Header.RecordSize = sizeof(CAN_LOG_RECORD);
+    fwrite(&Header, sizeof(Header), 1, Out);
+
+    signal(SIGINT, HandleStop);
+    signal(SIGALRM, HandleStop);
+    alarm(Seconds);
+
+    while(!StopCapture){
+        Iov.iov_base = &Frame;
+        Iov.iov_len = sizeof(Frame);
+        memset(&Msg, 0, sizeof(Msg));
+        Msg.msg_iov = &Iov;
+        Msg.msg_iovlen = 1;
+        Msg.msg_control = Control;
+        Msg.msg_controllen = sizeof(Control);
+        Size = recvmsg(Sock, &Msg, 0);
+        if((Size != CAN_MTU) && (Size != CANFD_MTU)){
+            continue;
+        }
+
+        RxTime = ClockNs(CLOCK_REALTIME);
+        for(Cmsg = CMSG_FIRSTHDR(&Msg); Cmsg != NULL; Cmsg = CMSG_NXTHDR(&Msg, Cmsg)){
+            if((Cmsg->cmsg_level == SOL_SOCKET) && (Cmsg->cmsg_type == SO_TIMESTAMPNS)){
+                const struct timespec *Ts = (const struct timespec *)CMSG_DATA(Cmsg);
+                RxTime = ((uint64_t)Ts->tv_sec * REPLAY_NS_PER_SEC) + Ts->tv_nsec;
+            }
+        }
+        if(Frames == 0){
+            Header.StartTime = RxTime;
+        }
+
+        memset(&Rec, 0, sizeof(Rec));
+        Rec.TimeStamp = RxTime - Header.StartTime;
+        Rec.CanID = Frame.can_id;
+        Rec.DLC = Frame.len;
+        Rec.Flags = (Size == CANFD_MTU) ? (uint8_t)(Frame.flags | CAN_LOG_FD) : 0;
+        memcpy(Rec.Data, Frame.data, (Size == CANFD_MTU) ? CANFD_MAX_DLEN : CAN_MAX_DLEN);
+        fwrite(&Rec, sizeof(Rec), 1, Out);
+        Frames++;
+    }
+
+    //Start time is only known after the first frame
+    fseek(Out, 0, SEEK_SET);
+    fwrite(&Header, sizeof(Header), 1, Out);
+    fclose(Out);
+    close(Sock);
+    printf("%llu frames recorded\n", (unsigned long long)Frames);
+    return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : replay mode. Sends the log onto the interface keeping the
+ *                recorded frame spacing, scaled by Speed.
+ *
+ *  Arguments   : File name, interface, speed (0 = unpaced)
+ *
+ *  Return Value: Exit code
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int Replay(const char *FileName, const char *Interface, double Speed){
+    const CAN_LOG_RECORD *Records;
+    const CAN_LOG_HEADER *Header;
+    struct canfd_frame Frame;
+    size_t Count, MapSize, Pos, Size;
+    uint64_t Start, Sent = 0;
+    int Sock;
+
+    Header = MapLog(FileName, &Records, &Count, &MapSize);
+    if(Header == NULL){
+        return 1;
+    }
+    Sock = OpenRawSocket(Interface);
+    if(Sock < 0){
+        munmap((void *)Header, MapSize);
+        return 1;
+    }
+
+    Start = ClockNs(CLOCK_MONOTONIC);
+    for(Pos = 0; Pos < Count; Pos++){
+        if(Speed > 0){
+            SleepUntil(Start + (uint64_t)(Records[Pos].TimeStamp / Speed));
+        }
+        memset(&Frame, 0, sizeof(Frame));
+        Frame.can_id = Records[Pos].CanID;
+        Frame.len = (Records[Pos].DLC > CANFD_MAX_DLEN) ? CANFD_MAX_DLEN : Records[Pos].DLC;
+        Frame.flags = Records[Pos].Flags & ~CAN_LOG_FD;
+        memcpy(Frame.data, Records[Pos].Data, Frame.len);
+        //The classic layout is the head of canfd_frame, only the size differs
+        Size = (Records[Pos].Flags & CAN_LOG_FD) ? CANFD_MTU : CAN_MTU;
+        //vcan has no queue limit worth waiting on, a real bus returns ENOBUFS
+        while(write(Sock, &Frame, Size) < 0){
+            if(errno != ENOBUFS){
+                perror("write");
+                close(Sock);
+                munmap((void *)Header, MapSize);
+                return 1;
+            }
+            usleep(100);
+        }
+        Sent++;
+    }
+
+    printf("%llu frames sent in %.3f s\n", (unsigned long long)Sent,
+           (double)(ClockNs(CLOCK_MONOTONIC) - Start) / REPLAY_NS_PER_SEC);
+    close(Sock);
+    munmap((void *)Header, MapSize);
+    return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : bench mode. A producer thread plays the CAN thread role and
+ *                pushes the log into canBuffer as fast as the parser keeps up,
+ *                stamping each frame with the push time. The calling thread
+ *                runs the same drain loop as ParserWorker::run and records the
+ *                push to batch parsed latency of every frame.
+ *
+ *  Arguments   : File name, loops over the log, trace dump file or NULL,
+ *                telemetry export file or NULL
+ *
+ *  Return Value: Exit code
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int Bench(const char *FileName, unsigned Loops, const char *TraceFile, const char *TelemetryFile){
+    const CAN_LOG_RECORD *Records;
+    const CAN_LOG_HEADER *Header;
+    size_t Count, MapSize;
+    std::atomic<bool> Done(false);
+    std::vector<uint32_t> Latency;
+    CAN_DATA Batch[PARSER_BATCH_SIZE];
+    uint64_t Total, Parsed = 0, Start, Elapsed, Allocs, Now, Batches = 0;
+    uint32_t Got, Pos;
+
+    Header = MapLog(FileName, &Records, &Count, &MapSize);
+    if((Header == NULL) || (Count == 0)){
+        return 1;
+    }
+    Total = (uint64_t)Count * Loops;
+    Latency.reserve(Total);
+
+    std::thread Producer([&](){
+        CAN_DATA Message;
+        uint64_t Pushed = 0;
+        size_t Idx;
+
+        while(Pushed < Total){
+            //Backpressure instead of the drop-oldest policy so every frame is timed
+            while(canBuffer.Size() >= BENCH_RING_HIGH_WATER){
+                std::this_thread::yield();
+            }
+            Idx = Pushed % Count;
+            FrameToCANData(Records[Idx].CanID, Records[Idx].DLC, Records[Idx].Data,
+                           ClockNs(CLOCK_MONOTONIC), &Message);
+            canBuffer.Push(Message);
+            Pushed++;
+            if((Pushed % PARSER_BATCH_SIZE) == 0){
+                canBuffer.Notify();
+            }
+        }
+        canBuffer.Notify();
+        Done.store(true, std::memory_order_release);
+    });
+
+    ThreadAllocs = 0;
+    Start = ClockNs(CLOCK_MONOTONIC);
+    while(Parsed < Total){
+        Got = canBuffer.PopBatch(Batch, PARSER_BATCH_SIZE);
+        if(Got == 0){
+            if(Done.load(std::memory_order_acquire) && canBuffer.IsEmpty()){
+                break;
+            }
+            canBuffer.Wait();
+            continue;
+        }
+        for(Pos = 0; Pos < Got; Pos++){
+            ParseMessage(Batch[Pos]);
+        }
+        PublishLRUChanges();
+        TakeLRUChanges();
+
+        Now = ClockNs(CLOCK_MONOTONIC);
+        for(Pos = 0; Pos < Got; Pos++){
+            Latency.push_back((uint32_t)std::min<uint64_t>(Now - Batch[Pos].TimeStamp, UINT32_MAX));
+        }
+        Parsed += Got;
+        Batches++;
+    }
+    Elapsed = ClockNs(CLOCK_MONOTONIC) - Start;
+    Allocs = ThreadAllocs;
+    Producer.join();
+
+    std::sort(Latency.begin(), Latency.end());
+    printf("frames        : %llu in %llu batches\n", (unsigned long long)Parsed,
+           (unsigned long long)Batches);
+    printf("throughput    : %.0f frames/s\n", (double)Parsed * REPLAY_NS_PER_SEC / (Elapsed ? Elapsed : 1));
+    if(!Latency.empty()){
+        printf("latency p50   : %u ns\n", Latency[Latency.size() / 2]);
+        printf("latency p99   : %u ns\n", Latency[(Latency.size() * 99) / 100]);
+        printf("latency max   : %u ns\n", Latency.back());
+    }
+    printf("allocs/frame  : %.4f\n", Parsed ? (double)Allocs / Parsed : 0.0);
+    printf("ring overflows: %llu\n", (unsigned long long)canBuffer.GetOverflowCount());
+    //Per stage histograms and FID counts of the trace points hit by the run
+    if((TraceFile != NULL) && !TraceDump(TraceFile)){
+        fprintf(stderr, "canreplay: cannot write %s\n", TraceFile);
+    }
+    if((TelemetryFile != NULL) && !TelemetryExport(TelemetryFile, 0, UINT64_MAX)){
+        fprintf(stderr, "canreplay: cannot write %s\n", TelemetryFile);
+    }
+
+    munmap((void *)Header, MapSize);
+    return 0;
+}
+
+static void Usage(){
+    fprintf(stderr,
+            "usage: canreplay record <interface> <file> [seconds]\n"
+            "       canreplay replay <file> <interface> [speed]\n"
+            "       canreplay bench <file> [loops] [trace_file] [telemetry_file]\n");
+}
+
+int main(int argc, char *argv[])
+{
+    if((argc >= 4) && (strcmp(argv[1], "record") == 0)){
+        return Record(argv[2], argv[3], (argc > 4) ? (unsigned)atoi(argv[4]) : 0);
+    }
+    if((argc >= 4) && (strcmp(argv[1], "replay") == 0)){
+        return Replay(argv[2], argv[3], (argc > 4) ? atof(argv[4]) : 1.0);
+    }
+    if((argc >= 3) && (strcmp(argv[1], "bench") == 0)){
+        return Bench(argv[2], (argc > 3) ? (unsigned)std::max(1, atoi(argv[3])) : 1,
+                     (argc > 4) ? argv[4] : NULL, (argc > 5) ? argv[5] : NULL);
+    }
+    Usage();
+    return 2;
+}
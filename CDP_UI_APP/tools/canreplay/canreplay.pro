@@ -0,0 +1,39 @@
+QT       = core
+
+CONFIG += console c++14
+CONFIG -= app_bundle
+
+TARGET = canreplay
+
+# Links the application parser and LRU data without any of the pages
+INCLUDEPATH += ../..
+DEFINES += CDP_TRACE
+
+SOURCES += \
+    canreplay.cpp \
+    ../../parser.cpp \
+    ../../candispatch.cpp \
+    ../../lrustore.cpp \
+    ../../nodehealth.cpp \
+    ../../faultevents.cpp \
+    ../../pdutelemetry.cpp \
+    ../../nvmstorage.cpp \
+    ../../lrudata.cpp \
+    ../../trace.cpp
+
+HEADERS += \
+    ../../parser.h \
+    ../../candispatch.h \
+    ../../lrustore.h \
+    ../../nodehealth.h \
+    ../../faultevents.h \
+    ../../pdutelemetry.h \
+    ../../nvmstorgae.h \
+    ../../nvmcontent.h \
+    ../../canringbuffer.h \
+    ../../canlog.h \
+    ../../signalcodec.h \
+    ../../lrudata.h \
+    ../../trace.h
+
+LIBS += -lpthread
@@ -0,0 +1,137 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : imagebake.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/*
+ *  Build host tool baking the page backgrounds into the application, run by
+ *  the imagebake step of CDP_UI_APP.pro.
+ *
+ *  imagebake <png> <output> [width height]
+ *      Scales the PNG to width x height (the panel, 1920 x 1080, by default)
+ *      and writes it in the panelimage.h format: the header followed by the
+ *      raw scanlines, RGB32 when every pixel is opaque, premultiplied ARGB32
+ *      otherwise.
+ */
+
+/****************************** HEADER FILES *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <QImage>
+#include <QFile>
+#include "panelimage.h"
+
+/*-----------------------------------------------------------------------------
+ *  Description : True when no pixel of the image is transparent
+ *
+ *  Arguments   : Image in ARGB32
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+ */
+static bool IsOpaque(const QImage &Image)
+{
+    int Row, Column;
+
+    for(Row = 0; Row < Image.height(); Row++){
+        const QRgb *Line = (const QRgb *)Image.constScanLine(Row);
+
+        for(Column = 0; Column < Image.width(); Column++){
+            if(qAlpha(Line[Column]) != 255){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void Usage(){
+    fprintf(stderr, "usage: imagebake <png> <output> [width height]\n");
+}
+
+int main(int argc, char *argv[])
+{
+    PANEL_IMAGE_HEADER Header;
+    QImage Image;
+    QFile Output;
+    int Width = PANEL_WIDTH;
+    int Height = PANEL_HEIGHT;
+    int Row;
+
+    if(argc != 3 && argc != 5){
+        Usage();
+        return 2;
+    }
+    if(argc == 5){
+        Width = atoi(argv[3]);
+        Height = atoi(argv[4]);
+    }
+    if(Width <= 0 || Height <= 0 || Width > 0xFFFF || Height > 0xFFFF){
+        Usage();
+        return 2;
+    }
+    if(!Image.load(QString::fromLocal8Bit(argv[1]))){
+        fprintf(stderr, "imagebake: %s not loaded\n", argv[1]);
+        return 1;
+    }
+    if(Image.size() != QSize(Width, Height)){
+        Image = Image.scaled(Width, Height, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    }
+    Image = Image.convertToFormat(QImage::Format_ARGB32);
+    //Opaque backgrounds are drawn without blending
+    Image = Image.convertToFormat(IsOpaque(Image) ? QImage::Format_RGB32 : QImage::Format_ARGB32_Premultiplied);
+
+    Header.Magic = PANEL_IMAGE_MAGIC;
+    Header.Width = (uint16_t)Width;
+    Header.Height = (uint16_t)Height;
+    Header.Format = (uint32_t)Image.format();
+    Header.BytesPerLine = (uint32_t)Width * 4;
+
+    Output.setFileName(QString::fromLocal8Bit(argv[2]));
+    if(!Output.open(QIODevice::WriteOnly | QIODevice::Truncate)){
+        fprintf(stderr, "imagebake: %s not created\n", argv[2]);
+        return 1;
+    }
+    Output.write((const char *)&Header, sizeof(Header));
+    for(Row = 0; Row < Height; Row++){
+        Output.write((const char *)Image.constScanLine(Row), Header.BytesPerLine);
+    }
+    Output.close();
+    if(Output.error() != QFileDevice::NoError){
+        fprintf(stderr, "imagebake: %s not written\n", argv[2]);
+        Output.remove();
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,15 @@
+QT       = core gui
+
+CONFIG += console c++14
+CONFIG -= app_bundle
+
+TARGET = imagebake
+
+# Runs on the build host, build it with the host Qt before CDP_UI_APP
+INCLUDEPATH += ../..
+
+SOURCES += \
+    imagebake.cpp
+
+HEADERS += \
+    ../../panelimage.h
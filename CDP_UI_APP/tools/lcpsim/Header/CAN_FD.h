@@ -0,0 +1,61 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : CAN_FD.h
+ *
+ *  CSCI Name       : Control Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Host build of the CAN FD driver, backed by SocketCAN
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef CAN_FD_H
+#define CAN_FD_H
+
+/****************************** HEADER FILES *********************************/
+#include "stdtypes.h"
+
+/********************* ENUMS  *****************************/
+typedef enum
+{
+    CANFD_MSG_RX_DATA_FRAME = 0,
+    CANFD_MSG_RX_REMOTE_FRAME
+}CANFD_MSG_RX_ATTRIBUTE;
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+bool CANFD1_MessageTransmit(uint32_t id, uint8_t length, uint8_t *data,
+                            uint8_t fifoQueueNum, uint32_t mode, uint32_t msgAttr);
+bool CANFD1_Receive(uint32_t *id, uint8_t *length, void *data, uint32_t *timestamp,
+                    uint8_t fifoNum, CANFD_MSG_RX_ATTRIBUTE *msgAttr);
+
+#endif /* CAN_FD_H */
@@ -0,0 +1,70 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : DebounceLogic.h
+ *
+ *  CSCI Name       : Control Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Host build of the input debounce
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef DEBOUNCELOGIC_H
+#define DEBOUNCELOGIC_H
+
+/****************************** HEADER FILES *********************************/
+#include "stdtypes.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define DEBOUNCE_COUNT      3U      /* Equal samples before an input changes */
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+extern bool Debounce_RA12;
+extern bool Debounce_RB13;
+extern bool Debounce_RB14;
+extern bool Debounce_RB15;
+extern bool Debounce_RD03;
+extern bool Debounce_RD04;
+extern bool Debounce_RG00;
+
+extern bool previousDebounce_RA12;
+extern bool previousDebounce_RB13;
+extern bool previousDebounce_RB14;
+extern bool previousDebounce_RB15;
+extern bool previousDebounce_RD03;
+extern bool previousDebounce_RD04;
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+void DebounceInputs(void);
+
+#endif /* DEBOUNCELOGIC_H */
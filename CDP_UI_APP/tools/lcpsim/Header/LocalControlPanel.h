@@ -0,0 +1,159 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : LocalControlPanel.h
+ *
+ *  CSCI Name       : Control Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Host build of the Local Control Panel declarations
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef LOCALCONTROLPANEL_H
+#define LOCALCONTROLPANEL_H
+
+/****************************** HEADER FILES *********************************/
+#include "stdtypes.h"
+#include "PanelConfiguration.h"
+
+/********************* Structures  *****************************/
+/* 29 bit arbitration field, same bit positions as ARBITRATION_FORMAT */
+typedef struct
+{
+    uint32_t RCI                : 2;
+    uint32_t NodeID             : 8;
+    uint32_t FunctionID         : 6;
+    uint32_t PVT                : 1;
+    uint32_t LCL                : 1;
+    uint32_t FSB                : 1;
+    uint32_t SourceFID          : 7;
+    uint32_t LCC                : 3;
+    uint32_t UNUSED1            : 3;
+}ArbitrationBits;
+
+typedef union
+{
+    ArbitrationBits ArbitrationField;
+    uint32_t        ArbitrationTotal;
+}ArbitrationID_LCP;
+
+/* Panel Command payload, bit positions as ICD_LCP_Panel_CMD */
+typedef struct
+{
+    uint32_t Engineering_Data_1     : 1;
+    uint32_t Engineering_Data_2     : 1;
+    uint32_t Zone_Stop              : 1;
+    uint32_t Unlock_Next            : 1;
+    uint32_t Dual_Lane              : 1;
+    uint32_t TGLS_Drive_AFT         : 1;
+    uint32_t TGLS_Drive_FWD         : 1;
+    uint32_t PDU_Stop               : 1;
+
+    uint32_t Engineering_Data_3     : 1;
+    uint32_t Engineering_Data_4     : 1;
+    uint32_t Unlock_Next_Fault      : 1;
+    uint32_t Dual_Lane_Fault        : 1;
+    uint32_t NVM_Integrity_Fault    : 1;
+    uint32_t NVM_Checksum_Fault     : 1;
+    uint32_t Zone_Stop_Fault        : 1;
+    uint32_t OPSW_CRC_Fault         : 1;
+
+    uint32_t Mux_Current_Voltage    : 2;
+    uint32_t Panel_Status           : 3;
+    uint32_t TGLS_Drive_Fault       : 2;
+    uint32_t Lamp_Test_Fault        : 1;
+
+    uint32_t Engineering_Data_5     : 8;
+
+    uint32_t Measured_Current_Voltage : 16;
+    uint32_t Switch_Fault_Status    : 1;
+    uint32_t PDU_Stop_Fault         : 1;
+    uint32_t Engineering_Data_6     : 14;
+}PayloadBitsTx_LCP;
+
+/* Panel Status payload, bit positions as ICD_LCP_Panel_Status */
+typedef struct
+{
+    uint32_t Engineering_Data_1     : 3;
+    uint32_t Zone_Stop_LED          : 1;
+    uint32_t PDU_Stop_LED           : 1;
+    uint32_t Unlock_Next_LED        : 1;
+    uint32_t Dual_Lane_LED          : 1;
+    uint32_t Panel_Enabled_LED      : 1;
+    uint32_t Engineering_Data_2     : 8;
+    uint32_t Engineering_Data_3     : 16;
+    uint32_t Engineering_Data_4     : 32;
+}PayloadBitsRx_LCP;
+
+typedef struct
+{
+    ArbitrationID_LCP ArbitrationID;
+    uint8_t           DLC;
+    union
+    {
+        PayloadBitsTx_LCP PayloadFormat;
+        uint8_t           PayloadTotal[8];
+    }Payload;
+}LCP_CAN_DATA_TX;
+
+typedef struct
+{
+    ArbitrationID_LCP ArbitrationID;
+    uint8_t           DLC;
+    union
+    {
+        PayloadBitsRx_LCP PayloadFormat;
+        uint8_t           PayloadTotal[8];
+    }Payload;
+}LCP_CAN_DATA_RX;
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+extern LCP_CAN_DATA_TX LCP_CAN_Tx;
+extern LCP_CAN_DATA_RX LCP_CAN_Rx;
+extern PayloadBitsRx_LCP LCP_CAN_Rx_PrevMsgPayload;
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+void InputAndOutputSignalInitForLCP(void);
+void InitializationsForLCP(PanelType PanelID);
+void LampTestProcessForLCP(void);
+bool ValidateDataloadRequestForLCP(void);
+void UpdateControlPanelArbitrationIDForLCP(PanelType PanelID);
+bool ValidateLCPArbitrationID(PanelType PanelID);
+void NonLatchInputProcessForLCP(void);
+void LatchedInputProcessForLCP(void);
+void InputProcessForLCP(PanelType PanelID);
+void LedControlForLCP(PanelType PanelID);
+void LEDControlDefaultsForLCP(PanelType PanelID);
+void FaultMonitoringForLCP(void);
+
+#endif /* LOCALCONTROLPANEL_H */
@@ -0,0 +1,81 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : PanelConfiguration.h
+ *
+ *  CSCI Name       : Control Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Host build of the panel configuration
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef PANELCONFIGURATION_H
+#define PANELCONFIGURATION_H
+
+/****************************** HEADER FILES *********************************/
+#include "stdtypes.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+/* Arbitration field constants. The display only matches Function and Node ID,
+ * the remaining fields are sent as 0 until the panel configuration of the
+ * target build is available here. */
+#define AIDRCI              0U
+#define AIDUNUSED           0U
+#define AIDPVT              0U
+#define AIDLCL              0U
+#define AIDFSB              0U
+#define AIDSOURCEFID        0U
+#define AIDLCC              0U
+
+#define AIDPANELCMD         4U      /* FID_PANEL_CMD */
+#define AIDPANELSTS         24U     /* FID_PANEL_STATUS */
+#define AIDPANELERR         25U
+
+/********************* ENUMS  *****************************/
+/* Panel Node Identifiers, as NID_* in lrudata.h */
+typedef enum
+{
+    eMCP    = 60,
+    eOCP    = 61,
+    eLCP1LH = 62,
+    eLCP2LH = 63,
+    eLCP3LH = 64,
+    eLCP4LH = 65,
+    eICP    = 188,
+    eLCP1RH = 189,
+    eLCP2RH = 190,
+    eLCP3RH = 191,
+    eLCP4RH = 192
+}PanelType;
+
+#endif /* PANELCONFIGURATION_H */
@@ -0,0 +1,118 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : PIC32MK0512MCM100.h
+ *
+ *  CSCI Name       : Control Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Host model of the PIC32MK GPIO registers
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef PIC32MK0512MCM100_H
+#define PIC32MK0512MCM100_H
+
+/****************************** HEADER FILES *********************************/
+#include <stdint.h>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+/*
+ *  Host model of the GPIO special function registers used by the panel
+ *  firmware. Every register is a plain per process variable with the same
+ *  <Register>bits.<Bit> access as the device header. The simulator drives
+ *  PORTx and samples LATx (see hal.c).
+ */
+#define HAL_REGISTER_BITS(Prefix) \
+    uint32_t Prefix##0 : 1; \
+    uint32_t Prefix##1 : 1; \
+    uint32_t Prefix##2 : 1; \
+    uint32_t Prefix##3 : 1; \
+    uint32_t Prefix##4 : 1; \
+    uint32_t Prefix##5 : 1; \
+    uint32_t Prefix##6 : 1; \
+    uint32_t Prefix##7 : 1; \
+    uint32_t Prefix##8 : 1; \
+    uint32_t Prefix##9 : 1; \
+    uint32_t Prefix##10 : 1; \
+    uint32_t Prefix##11 : 1; \
+    uint32_t Prefix##12 : 1; \
+    uint32_t Prefix##13 : 1; \
+    uint32_t Prefix##14 : 1; \
+    uint32_t Prefix##15 : 1; \
+    uint32_t          : 16;
+
+#define HAL_REGISTER(Reg, Prefix) \
+    typedef struct { HAL_REGISTER_BITS(Prefix) } __##Reg##bits_t; \
+    extern volatile __##Reg##bits_t Reg##bits
+
+HAL_REGISTER(TRISA, TRISA);
+HAL_REGISTER(LATA, LATA);
+HAL_REGISTER(PORTA, RA);
+HAL_REGISTER(ANSELA, ANSA);
+HAL_REGISTER(TRISB, TRISB);
+HAL_REGISTER(LATB, LATB);
+HAL_REGISTER(PORTB, RB);
+HAL_REGISTER(ANSELB, ANSB);
+HAL_REGISTER(TRISC, TRISC);
+HAL_REGISTER(LATC, LATC);
+HAL_REGISTER(PORTC, RC);
+HAL_REGISTER(ANSELC, ANSC);
+HAL_REGISTER(TRISD, TRISD);
+HAL_REGISTER(LATD, LATD);
+HAL_REGISTER(PORTD, RD);
+HAL_REGISTER(ANSELD, ANSD);
+HAL_REGISTER(TRISE, TRISE);
+HAL_REGISTER(LATE, LATE);
+HAL_REGISTER(PORTE, RE);
+HAL_REGISTER(ANSELE, ANSE);
+HAL_REGISTER(TRISF, TRISF);
+HAL_REGISTER(LATF, LATF);
+HAL_REGISTER(PORTF, RF);
+HAL_REGISTER(ANSELF, ANSF);
+HAL_REGISTER(TRISG, TRISG);
+HAL_REGISTER(LATG, LATG);
+HAL_REGISTER(PORTG, RG);
+HAL_REGISTER(ANSELG, ANSG);
+
+/* CAN FD acceptance filter and FIFO registers checked and written by
+   DataloadFilterInitForLCP. The host filters are the socket filters of
+   HAL_Open, CFD1FIFOCON3 reads as the MCC receive FIFO setup. */
+extern volatile uint32_t CFD1FIFOCON3;
+extern volatile uint32_t CFD1FLTCON2;
+extern volatile uint32_t CFD1FLTOBJ8;
+extern volatile uint32_t CFD1MASK8;
+
+/* Core timer, counts at SYSCLK / 2 (60 MHz) from the host monotonic clock */
+uint32_t _CP0_GET_COUNT(void);
+
+#endif /* PIC32MK0512MCM100_H */
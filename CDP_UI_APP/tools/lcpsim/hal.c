@@ -0,0 +1,499 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : hal.c
+ *
+ *  CSCI Name       : Control Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Host hardware abstraction for the LCP firmware. One simulated
+ *                panel per process: registers, debounce state and the CAN socket
+ *                are process globals like on the target.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include "hal.h"
+#include "Header/system/PIC32MK0512MCM100.h"
+#include "Header/LocalControlPanel.h"
+#include "Header/LocalControlPanelTasks.h"
+#include "Header/DebounceLogic.h"
+#include "Header/CAN_FD.h"
+#include "Header/Timers.h"
+#include "Header/Flash.h"
+#include "Header/delay.h"
+#include "Header/WatchDog.h"
+#include "Header/FaultMonitor.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define HAL_REGISTER_DEFINE(Reg)    volatile __##Reg##bits_t Reg##bits
+
+#define HAL_DATALOAD_ID             0x15520480U
+#define HAL_DATALOAD_FIFO           3U              /* DLD_FIFO of the firmware */
+
+/* Simulated program flash, 0x9D000000 to 0x9D07FFFF */
+#define HAL_FLASH_BASE              0x9D000000U
+#define HAL_FLASH_SIZE              0x00080000U
+#define HAL_FLASH_PAGE_SIZE         0x00001000U
+#define HAL_FLASH_STAGE_BASE        0x9D040000U     /* DLD_STAGE_BASE of the firmware */
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+HAL_REGISTER_DEFINE(TRISA);
+HAL_REGISTER_DEFINE(LATA);
+HAL_REGISTER_DEFINE(PORTA);
+HAL_REGISTER_DEFINE(ANSELA);
+HAL_REGISTER_DEFINE(TRISB);
+HAL_REGISTER_DEFINE(LATB);
+HAL_REGISTER_DEFINE(PORTB);
+HAL_REGISTER_DEFINE(ANSELB);
+HAL_REGISTER_DEFINE(TRISC);
+HAL_REGISTER_DEFINE(LATC);
+HAL_REGISTER_DEFINE(PORTC);
+HAL_REGISTER_DEFINE(ANSELC);
+HAL_REGISTER_DEFINE(TRISD);
+HAL_REGISTER_DEFINE(LATD);
+HAL_REGISTER_DEFINE(PORTD);
+HAL_REGISTER_DEFINE(ANSELD);
+HAL_REGISTER_DEFINE(TRISE);
+HAL_REGISTER_DEFINE(LATE);
+HAL_REGISTER_DEFINE(PORTE);
+HAL_REGISTER_DEFINE(ANSELE);
+HAL_REGISTER_DEFINE(TRISF);
+HAL_REGISTER_DEFINE(LATF);
+HAL_REGISTER_DEFINE(PORTF);
+HAL_REGISTER_DEFINE(ANSELF);
+HAL_REGISTER_DEFINE(TRISG);
+HAL_REGISTER_DEFINE(LATG);
+HAL_REGISTER_DEFINE(PORTG);
+HAL_REGISTER_DEFINE(ANSELG);
+
+/* FIFO 3 as MCC sets it up: receive, 32 messages, 64 byte payload */
+volatile uint32_t CFD1FIFOCON3 = 0xFF000000U;
+volatile uint32_t CFD1FLTCON2, CFD1FLTOBJ8, CFD1MASK8;
+
+bool Debounce_RA12, Debounce_RB13, Debounce_RB14, Debounce_RB15;
+bool Debounce_RD03, Debounce_RD04, Debounce_RG00;
+
+bool previousDebounce_RA12, previousDebounce_RB13, previousDebounce_RB14;
+bool previousDebounce_RB15, previousDebounce_RD03, previousDebounce_RD04;
+
+static int      CanSock = -1;
+static int      DataloadSock = -1;
+static uint32_t Flash[HAL_FLASH_SIZE / 4];
+static void   (*ResetHook)(void) = NULL;
+static uint8_t  DebounceCount[HAL_IN_COUNT];
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens the CAN sockets of this panel. The filter of the
+ *                first passes the Panel Status / Panel Error messages
+ *                addressed to NodeID and the dataload request, like the
+ *                acceptance filters of receive FIFO 2 on the target. The
+ *                second stands for FIFO 3 and takes the CAN FD dataload
+ *                frames for NodeID.
+ *
+ *  Arguments   : Interface name, Node ID
+ *
+ *  Return Value: 0 on success, -1 on error
+ *
+ *-----------------------------------------------------------------------------
+ */
+int HAL_Open(const char *Interface, uint32_t NodeID)
+{
+    struct sockaddr_can Addr;
+    struct can_filter Filter[3];
+    struct can_filter DataloadFilter;
+    struct ifreq ifr;
+    ArbitrationID_LCP FilterID, FilterMask;
+    const uint32_t FunctionIDs[2] = {AIDPANELSTS, AIDPANELERR};
+    uint32_t Pos;
+    int Enable = 1;
+
+    CanSock = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    DataloadSock = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if((CanSock < 0) || (DataloadSock < 0))
+    {
+        perror("socket");
+        HAL_Close();
+        return -1;
+    }
+
+    FilterMask.ArbitrationTotal = 0;
+    FilterMask.ArbitrationField.NodeID = 0xFF;
+    FilterMask.ArbitrationField.FunctionID = 0x3F;
+    for(Pos = 0; Pos < 2; Pos++)
+    {
+        FilterID.ArbitrationTotal = 0;
+        FilterID.ArbitrationField.NodeID = NodeID;
+        FilterID.ArbitrationField.FunctionID = FunctionIDs[Pos];
+        Filter[Pos].can_id   = (FilterID.ArbitrationTotal & CAN_EFF_MASK) | CAN_EFF_FLAG;
+        Filter[Pos].can_mask = (FilterMask.ArbitrationTotal & CAN_EFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    }
+    Filter[2].can_id   = HAL_DATALOAD_ID | CAN_EFF_FLAG;
+    Filter[2].can_mask = CAN_EFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    setsockopt(CanSock, SOL_CAN_RAW, CAN_RAW_FILTER, Filter, sizeof(Filter));
+    setsockopt(CanSock, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &Enable, sizeof(Enable));
+
+    FilterID.ArbitrationTotal = 0;
+    FilterID.ArbitrationField.NodeID = NodeID;
+    FilterID.ArbitrationField.FunctionID = AIDDATALOAD;
+    DataloadFilter.can_id   = (FilterID.ArbitrationTotal & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    DataloadFilter.can_mask = (FilterMask.ArbitrationTotal & CAN_EFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    setsockopt(DataloadSock, SOL_CAN_RAW, CAN_RAW_FILTER, &DataloadFilter, sizeof(DataloadFilter));
+    setsockopt(DataloadSock, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &Enable, sizeof(Enable));
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, Interface, IFNAMSIZ - 1);
+    memset(&Addr, 0, sizeof(Addr));
+    if(ioctl(CanSock, SIOCGIFINDEX, &ifr) < 0)
+    {
+        perror("SIOCGIFINDEX");
+        HAL_Close();
+        return -1;
+    }
+    Addr.can_family = AF_CAN;
+    Addr.can_ifindex = ifr.ifr_ifindex;
+    if((bind(CanSock, (struct sockaddr *)&Addr, sizeof(Addr)) < 0) ||
+       (bind(DataloadSock, (struct sockaddr *)&Addr, sizeof(Addr)) < 0))
+    {
+        perror("bind");
+        HAL_Close();
+        return -1;
+    }
+    memset(Flash, 0xFF, sizeof(Flash));
+    return 0;
+}
+
+void HAL_Close(void)
+{
+    if(CanSock >= 0)
+    {
+        close(CanSock);
+        CanSock = -1;
+    }
+    if(DataloadSock >= 0)
+    {
+        close(DataloadSock);
+        DataloadSock = -1;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Called in place of the watchdog reset, before the simulated
+ *                panel ends
+ *
+ *  Arguments   : Hook, NULL for none
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void HAL_SetResetHook(void (*Hook)(void))
+{
+    ResetHook = Hook;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Writes the bootloader capability word the firmware reads
+ *                at start up. HAL_Open leaves it erased, as the current
+ *                bootloaders do.
+ *
+ *  Arguments   : Capabilities, DLD_BOOT_STAGED_CAPS for a bootloader that
+ *                installs staged images
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void HAL_SetBootCaps(uint32_t Caps)
+{
+    Flash[(DLD_BOOT_CAPS - HAL_FLASH_BASE) / 4] = Caps;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : CRC-32 of the image staged by the dataload, as the
+ *                bootloader would check it before installing
+ *
+ *  Arguments   : Image size in bytes
+ *
+ *  Return Value: uint32_t
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t HAL_StagedImageCRC(uint32_t Size)
+{
+    const uint32_t *Staged = &Flash[(HAL_FLASH_STAGE_BASE - HAL_FLASH_BASE) / 4];
+    uint32_t CRC = 0xFFFFFFFFU;
+    uint32_t Pos;
+    uint8_t Bit;
+
+    if(Size > (HAL_FLASH_BASE + HAL_FLASH_SIZE - HAL_FLASH_STAGE_BASE))
+    {
+        return 0;
+    }
+    for(Pos = 0; Pos < Size; Pos++)
+    {
+        CRC ^= (uint8_t)(Staged[Pos / 4] >> (8 * (Pos % 4)));
+        for(Bit = 0; Bit < 8; Bit++)
+        {
+            CRC = (CRC & 1U) ? ((CRC >> 1) ^ 0xEDB88320U) : (CRC >> 1);
+        }
+    }
+    return ~CRC;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Drives the PORT pin(s) of one panel input
+ *
+ *  Arguments   : Input, Pressed
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void HAL_SetInput(HAL_INPUT Input, bool Pressed)
+{
+    switch(Input)
+    {
+    case HAL_IN_DRIVE_FWD:      PORTBbits.RB15 = Pressed;   break;
+    case HAL_IN_DRIVE_AFT:      PORTBbits.RB13 = Pressed;   break;
+    case HAL_IN_DUAL_LANE:      PORTBbits.RB14 = Pressed;
+                                PORTDbits.RD4 = Pressed;    break;
+    case HAL_IN_UNLOCK_NEXT:    PORTDbits.RD3 = Pressed;    break;
+    case HAL_IN_PDU_STOP:       PORTAbits.RA12 = Pressed;   break;
+    case HAL_IN_LAMP_TEST:      PORTGbits.RG0 = Pressed;    break;
+    default:                                                break;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Reads the LAT pin of one panel LED
+ *
+ *  Arguments   : Output
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool HAL_GetOutput(HAL_OUTPUT Output)
+{
+    switch(Output)
+    {
+    case HAL_OUT_PANEL_ENABLED: return LATDbits.LATD15;
+    case HAL_OUT_DUAL_LANE:     return LATEbits.LATE12;
+    case HAL_OUT_UNLOCK_NEXT:   return LATEbits.LATE13;
+    case HAL_OUT_PDU_STOP:      return LATDbits.LATD14;
+    case HAL_OUT_LAMP_TEST:     return LATCbits.LATC9;
+    default:                    return FALSE;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Debounces one input, the output follows the pin after
+ *                DEBOUNCE_COUNT equal samples
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void DebounceInput(HAL_INPUT Input, bool Pin, bool *Debounced)
+{
+    if(Pin == *Debounced)
+    {
+        DebounceCount[Input] = 0;
+    }
+    else if(++DebounceCount[Input] >= DEBOUNCE_COUNT)
+    {
+        *Debounced = Pin;
+        DebounceCount[Input] = 0;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Samples the input pins, once per panel cycle
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void DebounceInputs(void)
+{
+    DebounceInput(HAL_IN_DRIVE_FWD, PORTBbits.RB15, &Debounce_RB15);
+    DebounceInput(HAL_IN_DRIVE_AFT, PORTBbits.RB13, &Debounce_RB13);
+    DebounceInput(HAL_IN_DUAL_LANE, PORTBbits.RB14, &Debounce_RB14);
+    Debounce_RD04 = Debounce_RB14;
+    DebounceInput(HAL_IN_UNLOCK_NEXT, PORTDbits.RD3, &Debounce_RD03);
+    DebounceInput(HAL_IN_PDU_STOP, PORTAbits.RA12, &Debounce_RA12);
+    DebounceInput(HAL_IN_LAMP_TEST, PORTGbits.RG0, &Debounce_RG00);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : CAN FD driver on SocketCAN, extended IDs. Up to 8 bytes go
+ *                out as classic frames, longer ones as CAN FD. The receive
+ *                FIFO selects the socket, the caller's buffer must hold the
+ *                longest frame its FIFO passes.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool CANFD1_MessageTransmit(uint32_t id, uint8_t length, uint8_t *data,
+                            uint8_t fifoQueueNum, uint32_t mode, uint32_t msgAttr)
+{
+    struct canfd_frame Frame;
+    size_t Size;
+
+    (void)fifoQueueNum;
+    (void)mode;
+    (void)msgAttr;
+    memset(&Frame, 0, sizeof(Frame));
+    Frame.can_id = (id & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    Frame.len = (length > CANFD_MAX_DLEN) ? CANFD_MAX_DLEN : length;
+    memcpy(Frame.data, data, Frame.len);
+    Size = (Frame.len > CAN_MAX_DLEN) ? CANFD_MTU : CAN_MTU;
+    return (write(CanSock, &Frame, Size) == (ssize_t)Size);
+}
+
+bool CANFD1_Receive(uint32_t *id, uint8_t *length, void *data, uint32_t *timestamp,
+                    uint8_t fifoNum, CANFD_MSG_RX_ATTRIBUTE *msgAttr)
+{
+    struct canfd_frame Frame;
+    ssize_t Size;
+
+    Size = recv((fifoNum == HAL_DATALOAD_FIFO) ? DataloadSock : CanSock, &Frame, sizeof(Frame), MSG_DONTWAIT);
+    if((Size != CAN_MTU) && (Size != CANFD_MTU))
+    {
+        return FALSE;
+    }
+    *id = Frame.can_id & CAN_EFF_MASK;
+    *length = Frame.len;
+    memcpy(data, Frame.data, Frame.len);
+    if(timestamp != NULL)
+    {
+        *timestamp = 0;
+    }
+    if(msgAttr != NULL)
+    {
+        *msgAttr = (Frame.can_id & CAN_RTR_FLAG) ? CANFD_MSG_RX_REMOTE_FRAME : CANFD_MSG_RX_DATA_FRAME;
+    }
+    return TRUE;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Core timer, wraps every 71.6 s like the device one
+ *
+ *-----------------------------------------------------------------------------
+ */
+uint32_t _CP0_GET_COUNT(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (uint32_t)((((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec) * 3U / 50U);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Timers, flash, delay, watchdog and fault monitor. The panel
+ *                cycle is paced by lcpsim.cpp, so the timers have nothing to
+ *                set up.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void TMR0_Initialize(void)
+{
+}
+
+void TMR1_Initialize(void)
+{
+}
+
+/* Like the NVM controller, a write can only clear bits of an erased word */
+bool DRV_FLASH0_WriteWord(uint32_t address, uint32_t data)
+{
+    if((address < HAL_FLASH_BASE) || (address - HAL_FLASH_BASE >= HAL_FLASH_SIZE) || (address & 3U))
+    {
+        return FALSE;
+    }
+    if(address < HAL_FLASH_STAGE_BASE)
+    {
+        printf("flash 0x%08X = 0x%08X\n", address, data);
+    }
+    Flash[(address - HAL_FLASH_BASE) / 4] &= data;
+    return TRUE;
+}
+
+uint32_t DRV_FLASH0_ReadWord(uint32_t address)
+{
+    if((address < HAL_FLASH_BASE) || (address - HAL_FLASH_BASE >= HAL_FLASH_SIZE) || (address & 3U))
+    {
+        return 0xFFFFFFFFU;
+    }
+    return Flash[(address - HAL_FLASH_BASE) / 4];
+}
+
+bool DRV_FLASH0_ErasePage(uint32_t address)
+{
+    if((address < HAL_FLASH_BASE) || (address - HAL_FLASH_BASE >= HAL_FLASH_SIZE))
+    {
+        return FALSE;
+    }
+    address &= ~(HAL_FLASH_PAGE_SIZE - 1U);
+    memset(&Flash[(address - HAL_FLASH_BASE) / 4], 0xFF, HAL_FLASH_PAGE_SIZE);
+    return TRUE;
+}
+
+void delay_us(uint32_t us)
+{
+    usleep(us);
+}
+
+void WATCHDOG_TimerStart(void)
+{
+    /* The target resets into the dataloader, the simulated panel ends here */
+    if(ResetHook != NULL)
+    {
+        ResetHook();
+    }
+    fflush(stdout);
+    _exit(HAL_EXIT_DATALOAD);
+}
+
+bool LampTestFault(void)
+{
+    return FALSE;
+}
@@ -0,0 +1,84 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : hal.h
+ *
+ *  CSCI Name       : Control Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef HAL_H
+#define HAL_H
+
+/****************************** HEADER FILES *********************************/
+#include "Header/stdtypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define HAL_EXIT_DATALOAD       3       /* Process exit code of a watchdog reset into dataload */
+
+/********************* ENUMS  *****************************/
+typedef enum
+{
+    HAL_IN_DRIVE_FWD = 0,       /* RB15 */
+    HAL_IN_DRIVE_AFT,           /* RB13 */
+    HAL_IN_DUAL_LANE,           /* RB14 and RD04 */
+    HAL_IN_UNLOCK_NEXT,         /* RD03 */
+    HAL_IN_PDU_STOP,            /* RA12 */
+    HAL_IN_LAMP_TEST,           /* RG0 */
+    HAL_IN_COUNT
+}HAL_INPUT;
+
+typedef enum
+{
+    HAL_OUT_PANEL_ENABLED = 0,  /* LATD15 */
+    HAL_OUT_DUAL_LANE,          /* LATE12 */
+    HAL_OUT_UNLOCK_NEXT,        /* LATE13 */
+    HAL_OUT_PDU_STOP,           /* LATD14 */
+    HAL_OUT_LAMP_TEST,          /* LATC9 */
+    HAL_OUT_COUNT
+}HAL_OUTPUT;
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+int  HAL_Open(const char *Interface, uint32_t NodeID);
+void HAL_Close(void);
+void HAL_SetInput(HAL_INPUT Input, bool Pressed);
+bool HAL_GetOutput(HAL_OUTPUT Output);
+void HAL_SetResetHook(void (*Hook)(void));
+void HAL_SetBootCaps(uint32_t Caps);
+uint32_t HAL_StagedImageCRC(uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_H */
@@ -0,0 +1,654 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : lcpsim.cpp
+ *
+ *  CSCI Name       : Control Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/*
+ *  Multi-panel LCP simulator. Runs the unmodified LocalControlPanel.c on the
+ *  host HAL (hal.c) over SocketCAN, one process per panel so every instance
+ *  has its own firmware globals.
+ *
+ *  lcpsim <interface> [seconds] [press_ms] [--no-crdc] [--dataload kbytes]
+ *         [--schedule] [--legacy-boot]
+ *
+ *      Starts the eight LCPs and MCP/OCP/ICP stand-ins at the panel cycle
+ *      rate. Every LCP presses Unlock Next each press_ms and measures the
+ *      time until its Unlock Next LED (LATE13) follows. Each cycle is one
+ *      TMR1 tick, the firmware's cyclic executive runs the tasks.
+ *
+ *      Unless --no-crdc is given, the parent process stands in for the CRDC
+ *      and answers every LCP Panel Command with a Panel Status that echoes
+ *      the Dual Lane / Unlock Next state, so the press to LED loop closes
+ *      without a rig. With --no-crdc the real CRDC has to answer.
+ *
+ *      With --dataload the parent runs the display dataload engine
+ *      (dataload.cpp) instead and loads a random image of the given size
+ *      into all eight LCPs at once. Each LCP checks its staged image when it
+ *      resets; the parent reports the time per panel and for the whole load.
+ *      The panels run under a bootloader that installs staged images unless
+ *      --legacy-boot is given; then they refuse the staged Dataload and the
+ *      load times out.
+ *
+ *      With --schedule every LCP prints the WCET, worst response and
+ *      deadline overruns of each LCP_SchedTable task, and the CRDC stand-in
+ *      the figures the panels reported in their Panel Commands.
+ *
+ *      Bring up a virtual bus with
+ *          ip link add dev vcan0 type vcan && ip link set up vcan0
+ *      and run the display on it with CDP_CAN_IF=vcan0.
+ */
+
+/****************************** HEADER FILES *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <net/if.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <vector>
+#include <algorithm>
+#include "icdsignals.h"
+#include "dataload.h"
+#include "hal.h"
+
+extern "C" {
+#include "Header/LocalControlPanel.h"
+#include "Header/LocalControlPanelTasks.h"
+#include "Header/DebounceLogic.h"
+#include "Header/CAN_FD.h"
+}
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     LCP_SIM_NS_PER_SEC          1000000000ULL
+#define     LCP_SIM_CYCLE_NS            10000000ULL     //Panel task period, 10 ms
+#define     LCP_SIM_CORE_TICKS_US       60.0            //_CP0_GET_COUNT rate, see hal.c
+#define     LCP_SIM_PRESS_CYCLES        5               //Button held longer than DEBOUNCE_COUNT
+#define     LCP_SIM_LED_TIMEOUT_NS      LCP_SIM_NS_PER_SEC
+#define     LCP_SIM_DATALOAD_SETTLE_NS  (LCP_SIM_NS_PER_SEC / 5)    //Panels up before the request
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static const PanelType LCPPanels[] = {eLCP1LH, eLCP2LH, eLCP3LH, eLCP4LH,
+                                      eLCP1RH, eLCP2RH, eLCP3RH, eLCP4RH};
+
+static const PanelType StandInPanels[] = {eMCP, eOCP, eICP};
+
+static volatile sig_atomic_t StopSim = 0;
+
+//In LCP_SchedTable order
+static const char *SchedTaskNames[] = {"fault", "command", "status", "lamp test", "dataload", "blink"};
+
+static_assert(sizeof(SchedTaskNames) / sizeof(SchedTaskNames[0]) == LCP_SCHED_TASK_COUNT,
+              "SchedTaskNames does not match LCP_SchedTable");
+
+//Dataload image, made before the panels are forked so they can check it
+static std::vector<uint8_t> DataloadImage;
+static uint32_t             DataloadImageCRC = 0;
+static PanelType            SimPanel;
+static bool                 LegacyBoot = false;
+
+static void HandleStop(int){
+    StopSim = 1;
+}
+
+static uint64_t NowNs(){
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * LCP_SIM_NS_PER_SEC) + (uint64_t)Now.tv_nsec;
+}
+
+static void SleepUntil(uint64_t Deadline){
+    struct timespec Ts;
+    Ts.tv_sec = Deadline / LCP_SIM_NS_PER_SEC;
+    Ts.tv_nsec = Deadline % LCP_SIM_NS_PER_SEC;
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &Ts, NULL) == EINTR && !StopSim){
+    }
+}
+
+static uint32_t PanelArbitration(uint32_t FunctionID, uint32_t NodeID){
+    ArbitrationID_LCP ID;
+
+    ID.ArbitrationTotal = 0;
+    ID.ArbitrationField.FunctionID = FunctionID;
+    ID.ArbitrationField.NodeID = NodeID;
+    return ID.ArbitrationTotal;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Checks that the firmware payload bitfields of this build put
+ *                every signal where the ICD description (icdsignals.h) does
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+ */
+template <typename Sig, typename Frame, typename Setter>
+static bool SameBits(Frame &Data, Setter Set, const char *Name){
+    memset(&Data.Payload, 0, sizeof(Data.Payload));
+    Set(Data.Payload.PayloadFormat, Sig::Mask);
+    if(DecodePayload(Data.Payload.PayloadTotal, 8) != Sig::Set(0, Sig::Mask)){
+        fprintf(stderr, "payload layout differs from the ICD at %s\n", Name);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckPayloadLayout(){
+    LCP_CAN_DATA_TX Tx;
+    LCP_CAN_DATA_RX Rx;
+    bool Valid = true;
+
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_PB_Unlock_Next>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Unlock_Next = V; }, "Unlock_Next");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_PB_Dual_Lane>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Dual_Lane = V; }, "Dual_Lane");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_TGLS_Drive_AFT>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.TGLS_Drive_AFT = V; }, "TGLS_Drive_AFT");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_TGLS_Drive_FWD>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.TGLS_Drive_FWD = V; }, "TGLS_Drive_FWD");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_PB_PDU_Stop>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.PDU_Stop = V; }, "PDU_Stop");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_PB_Unlock_Next_Fault>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Unlock_Next_Fault = V; }, "Unlock_Next_Fault");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_PB_Dual_Lane_Fault>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Dual_Lane_Fault = V; }, "Dual_Lane_Fault");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_PB_Lamp_Test_Fault>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Lamp_Test_Fault = V; }, "Lamp_Test_Fault");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_Panel_Status>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Panel_Status = V; }, "Panel_Status");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_Measured_Current_Voltage>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Measured_Current_Voltage = V; }, "Measured_Current_Voltage");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::LCP_PB_PDU_Stop_Fault>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.PDU_Stop_Fault = V; }, "PDU_Stop_Fault");
+    Valid &= SameBits<ICD_LCP_Sequence::Low>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Engineering_Data_1 = V; P.Engineering_Data_2 = V >> 1; }, "Sequence Low");
+    Valid &= SameBits<ICD_LCP_Sequence::High>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Engineering_Data_3 = V; P.Engineering_Data_4 = V >> 1; }, "Sequence High");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::Engineering_Data_5>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Engineering_Data_5 = V; }, "Engineering_Data_5");
+    Valid &= SameBits<ICD_LCP_Panel_CMD::Engineering_Data_6>(Tx, [](PayloadBitsTx_LCP &P, uint64_t V){ P.Engineering_Data_6 = V; }, "Engineering_Data_6");
+    if(DecodePayload(LCP_TxEventMask, 8) != ICD_LCP_Panel_CMD::Events::UsedMask()){
+        fprintf(stderr, "LCP_TxEventMask differs from ICD_LCP_Panel_CMD::Events\n");
+        Valid = false;
+    }
+    Valid &= SameBits<ICD_LCP_Panel_Status::LCP_LED_Panel_Enabled>(Rx, [](PayloadBitsRx_LCP &P, uint64_t V){ P.Panel_Enabled_LED = V; }, "Panel_Enabled_LED");
+    Valid &= SameBits<ICD_LCP_Panel_Status::LCP_PB_Dual_Lane_LED>(Rx, [](PayloadBitsRx_LCP &P, uint64_t V){ P.Dual_Lane_LED = V; }, "Dual_Lane_LED");
+    Valid &= SameBits<ICD_LCP_Panel_Status::LCP_PB_Unlock_Next_LED>(Rx, [](PayloadBitsRx_LCP &P, uint64_t V){ P.Unlock_Next_LED = V; }, "Unlock_Next_LED");
+    return Valid;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Reset hook of an LCP, checks the staged image like the
+ *                bootloader before it installs it
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void CheckStagedImage(){
+    uint32_t Staged;
+
+    if(DataloadImage.empty()){
+        return;
+    }
+    Staged = HAL_StagedImageCRC((uint32_t)DataloadImage.size());
+    printf("LCP %3u: staged image CRC 0x%08X, %s\n", (unsigned)SimPanel, Staged,
+           (Staged == DataloadImageCRC) ? "verified" : "MISMATCH");
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Prints the cyclic executive figures of this LCP
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void PrintSchedule(PanelType Panel){
+    uint32_t Task;
+
+    printf("LCP %3u: schedule %u frames, frame WCET %.1f us, %u frames dropped\n", (unsigned)Panel,
+           LCP_Scheduler.Frame, LCP_Scheduler.FrameWCET / LCP_SIM_CORE_TICKS_US,
+           LCP_Scheduler.FrameOverruns);
+    for(Task = 0; Task < LCP_SCHED_TASK_COUNT; Task++){
+        printf("         %-9s every %2u frames, WCET %7.1f us, response %7.1f us of %5u us, %u overruns\n",
+               SchedTaskNames[Task], LCP_SchedTable[Task].PeriodFrames,
+               LCP_Scheduler.TaskWCET[Task] / LCP_SIM_CORE_TICKS_US,
+               LCP_Scheduler.TaskResponse[Task] / LCP_SIM_CORE_TICKS_US,
+               LCP_SchedTable[Task].DeadlineUs, LCP_Scheduler.TaskOverruns[Task]);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : One LCP instance. Runs the firmware cycle, presses Unlock
+ *                Next every PressCycles and records the time until the
+ *                change is sent and until the LED follows.
+ *
+ *  Arguments   : Interface, Panel, run time, press period in cycles,
+ *                print the schedule figures
+ *
+ *  Return Value: Exit code
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int RunLCP(const char *Interface, PanelType Panel, uint64_t Seconds, uint32_t PressCycles,
+                  bool Schedule){
+    std::vector<uint64_t> Latency, BusLatency;
+    uint64_t Now, Start, End, PressTime = 0;
+    uint32_t Cycle, Ticks = 0, Missed = 0, Events = 0;
+    bool Pending = false, Expected = false, Sending = false;
+
+    if(HAL_Open(Interface, Panel) < 0){
+        return 1;
+    }
+    SimPanel = Panel;
+    HAL_SetResetHook(CheckStagedImage);
+    if(!LegacyBoot){
+        HAL_SetBootCaps(DLD_BOOT_STAGED_CAPS);
+    }
+    InitializationsForLCP(Panel);
+
+    Now = NowNs();
+    Start = Now;
+    End = Now + Seconds * LCP_SIM_NS_PER_SEC;
+    for(Cycle = 0; !StopSim && (Now < End); Cycle++){
+        //TMR1 period interrupts due by now, more than one when the host stalled
+        while(Ticks <= (Now - Start) / LCP_SIM_CYCLE_NS){
+            SchedulerTickForLCP();
+            Ticks++;
+        }
+
+        //Scripted operator, one Unlock Next press per period
+        if(PressCycles > 0){
+            if((Cycle % PressCycles) == 0 && !Pending){
+                Expected = !HAL_GetOutput(HAL_OUT_UNLOCK_NEXT);
+                HAL_SetInput(HAL_IN_UNLOCK_NEXT, TRUE);
+                PressTime = Now;
+                Pending = true;
+                Sending = true;
+                Events = LCP_TxPolicy.Events;
+            }
+            else if((Cycle % PressCycles) == LCP_SIM_PRESS_CYCLES){
+                HAL_SetInput(HAL_IN_UNLOCK_NEXT, FALSE);
+            }
+        }
+
+        DebounceInputs();
+        SchedulerDispatchForLCP(Panel);
+
+        Now = NowNs();
+        if(Sending && (LCP_TxPolicy.Events != Events)){
+            BusLatency.push_back(Now - PressTime);
+            Sending = false;
+        }
+        if(Pending && (HAL_GetOutput(HAL_OUT_UNLOCK_NEXT) == Expected)){
+            Latency.push_back(Now - PressTime);
+            Pending = false;
+        }
+        else if(Pending && (Now - PressTime > LCP_SIM_LED_TIMEOUT_NS)){
+            Missed++;
+            Pending = false;
+            Sending = false;
+        }
+
+        SleepUntil(Start + (uint64_t)Ticks * LCP_SIM_CYCLE_NS);
+        Now = NowNs();
+    }
+    HAL_Close();
+
+    std::sort(Latency.begin(), Latency.end());
+    if(Latency.empty()){
+        printf("LCP %3u: %u cycles, no LED response, %u presses missed\n", (unsigned)Panel, Cycle, Missed);
+    }
+    else{
+        printf("LCP %3u: %u cycles, press to LED p50 %.1f ms p99 %.1f ms max %.1f ms, %u missed\n",
+               (unsigned)Panel, Cycle, Latency[Latency.size() / 2] / 1e6,
+               Latency[(Latency.size() * 99) / 100] / 1e6, Latency.back() / 1e6, Missed);
+    }
+    std::sort(BusLatency.begin(), BusLatency.end());
+    printf("LCP %3u: %u Panel Commands sent (%.1f/s), %u on a change, %u not queued",
+           (unsigned)Panel, LCP_TxPolicy.Sent, LCP_TxPolicy.Sent * (double)LCP_SIM_NS_PER_SEC / (Now - Start),
+           LCP_TxPolicy.Events, LCP_TxPolicy.Failed);
+    if(!BusLatency.empty()){
+        printf(", press to bus p50 %.1f ms max %.1f ms", BusLatency[BusLatency.size() / 2] / 1e6,
+               BusLatency.back() / 1e6);
+    }
+    printf("\n");
+    if(Schedule){
+        PrintSchedule(Panel);
+    }
+    return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : MCP/OCP/ICP stand-in. There is no host build of their
+ *                firmware, so it sends a Panel Command in the operational
+ *                state each cycle and toggles Dual Operator every PressCycles.
+ *
+ *  Arguments   : Interface, Panel, run time, press period in cycles
+ *
+ *  Return Value: Exit code
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int RunStandIn(const char *Interface, PanelType Panel, uint64_t Seconds, uint32_t PressCycles){
+    uint8_t Data[8];
+    uint64_t Payload, Next, End;
+    uint32_t Cycle;
+    bool Pressed = false;
+
+    if(HAL_Open(Interface, Panel) < 0){
+        return 1;
+    }
+    Next = NowNs();
+    End = Next + Seconds * LCP_SIM_NS_PER_SEC;
+    for(Cycle = 0; !StopSim && (Next < End); Cycle++){
+        if(PressCycles > 0 && (Cycle % PressCycles) == 0){
+            Pressed = !Pressed;
+        }
+        if(Panel == eOCP){
+            OCP_Panel_CMD_Data Command;
+            Command.Data = 0;
+            Command.Signal.OCP_Panel_Status = CP_STATE::OP;
+            Command.Signal.OCP_PB_Dual_Operator = Pressed;
+            Payload = Command.Data;
+        }
+        else if(Panel == eICP){
+            ICP_Panel_CMD_Data Command;
+            Command.Data = 0;
+            Command.Signal.ICP_Panel_Status = CP_STATE::OP;
+            Command.Signal.ICP_PB_Dual_Operator = Pressed;
+            Payload = Command.Data;
+        }
+        else{
+            MCP_Panel_CMD_Data Command;
+            Command.Data = 0;
+            Command.Signal.MCP_Panel_Status = CP_STATE::OP;
+            Command.Signal.MCP_PB_Dual_Operator = Pressed;
+            Payload = Command.Data;
+        }
+        EncodePayload(Payload, Data);
+        CANFD1_MessageTransmit(PanelArbitration(AIDPANELCMD, Panel), 8, Data, 0, 0, 0);
+
+        Next += LCP_SIM_CYCLE_NS;
+        SleepUntil(Next);
+    }
+    HAL_Close();
+    return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : CRDC stand-in. Answers each LCP Panel Command with a Panel
+ *                Status that enables the panel and echoes Dual Lane and
+ *                Unlock Next into their LEDs. Counts the Panel Commands
+ *                and sequence gaps and keeps the latest schedule report
+ *                slots of every LCP.
+ *
+ *  Arguments   : Interface, run time, print the schedule reports
+ *
+ *  Return Value: Exit code
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int RunCRDC(const char *Interface, uint64_t Seconds, bool Schedule){
+    struct sockaddr_can Addr;
+    struct can_filter Filter;
+    struct can_frame Frame;
+    struct ifreq ifr;
+    struct timeval Timeout = {0, 100000};
+    ArbitrationID_LCP ID;
+    uint64_t Command, Status, End = NowNs() + Seconds * LCP_SIM_NS_PER_SEC;
+    uint32_t Replies = 0, Slot, Pos, Index;
+    const PanelType *Panel;
+    uint64_t Start = NowNs();
+    //Per LCP, sequence of the next Panel Command or ICD_LCP_Sequence::Modulo before the first
+    uint32_t Commands[sizeof(LCPPanels) / sizeof(LCPPanels[0])] = {};
+    uint32_t Gaps[sizeof(LCPPanels) / sizeof(LCPPanels[0])] = {};
+    uint8_t Sequence[sizeof(LCPPanels) / sizeof(LCPPanels[0])];
+    //Per LCP and report slot
+    uint32_t ReportWCET[sizeof(LCPPanels) / sizeof(LCPPanels[0])][ICD_LCP_Schedule_Report::FrameSlot + 1] = {};
+    uint32_t ReportOverruns[sizeof(LCPPanels) / sizeof(LCPPanels[0])][ICD_LCP_Schedule_Report::FrameSlot + 1] = {};
+    int Sock = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+
+    if(Sock < 0){
+        perror("socket");
+        return 1;
+    }
+    ID.ArbitrationTotal = 0;
+    ID.ArbitrationField.FunctionID = 0x3F;
+    Filter.can_mask = ID.ArbitrationTotal | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    Filter.can_id = PanelArbitration(AIDPANELCMD, 0) | CAN_EFF_FLAG;
+    setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FILTER, &Filter, sizeof(Filter));
+    setsockopt(Sock, SOL_SOCKET, SO_RCVTIMEO, &Timeout, sizeof(Timeout));
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, Interface, IFNAMSIZ - 1);
+    memset(&Addr, 0, sizeof(Addr));
+    if(ioctl(Sock, SIOCGIFINDEX, &ifr) < 0){
+        perror("SIOCGIFINDEX");
+        close(Sock);
+        return 1;
+    }
+    Addr.can_family = AF_CAN;
+    Addr.can_ifindex = ifr.ifr_ifindex;
+    if(bind(Sock, (struct sockaddr *)&Addr, sizeof(Addr)) < 0){
+        perror("bind");
+        close(Sock);
+        return 1;
+    }
+
+    memset(Sequence, ICD_LCP_Sequence::Modulo, sizeof(Sequence));
+    while(!StopSim && NowNs() < End){
+        if(read(Sock, &Frame, sizeof(Frame)) != (ssize_t)sizeof(Frame)){
+            continue;
+        }
+        ID.ArbitrationTotal = Frame.can_id & CAN_EFF_MASK;
+        Panel = std::find(std::begin(LCPPanels), std::end(LCPPanels), (PanelType)ID.ArbitrationField.NodeID);
+        if(Panel == std::end(LCPPanels)){
+            continue;
+        }
+        Index = (uint32_t)(Panel - LCPPanels);
+        Command = DecodePayload(Frame.data, Frame.can_dlc);
+        Slot = (uint32_t)ICD_LCP_Schedule_Report::Slot::Get(Command);
+        ReportWCET[Index][Slot] = (uint32_t)ICD_LCP_Schedule_Report::WCET_us::Get(Command);
+        ReportOverruns[Index][Slot] = (uint32_t)ICD_LCP_Schedule_Report::Overruns::Get(Command);
+        if((Sequence[Index] != ICD_LCP_Sequence::Modulo) &&
+           (ICD_LCP_Sequence::Value(Command) != Sequence[Index])){
+            Gaps[Index]++;
+        }
+        Sequence[Index] = (ICD_LCP_Sequence::Value(Command) + 1) % ICD_LCP_Sequence::Modulo;
+        Commands[Index]++;
+
+        Status = ICD_LCP_Panel_Status::LCP_LED_Panel_Enabled::Set(0, TRUE);
+        Status = ICD_LCP_Panel_Status::LCP_PB_Dual_Lane_LED::Set(Status,
+                    ICD_LCP_Panel_CMD::LCP_PB_Dual_Lane::Get(Command));
+        Status = ICD_LCP_Panel_Status::LCP_PB_Unlock_Next_LED::Set(Status,
+                    ICD_LCP_Panel_CMD::LCP_PB_Unlock_Next::Get(Command));
+
+        Frame.can_id = PanelArbitration(AIDPANELSTS, ID.ArbitrationField.NodeID) | CAN_EFF_FLAG;
+        Frame.can_dlc = 8;
+        EncodePayload(Status, Frame.data);
+        if(write(Sock, &Frame, sizeof(Frame)) == (ssize_t)sizeof(Frame)){
+            Replies++;
+        }
+    }
+    close(Sock);
+    printf("CRDC   : %u Panel Status replies\n", Replies);
+    for(Pos = 0; Pos < sizeof(LCPPanels) / sizeof(LCPPanels[0]); Pos++){
+        printf("CRDC   : LCP %3u %.1f Panel Commands/s, %u sequence gaps\n", (unsigned)LCPPanels[Pos],
+               Commands[Pos] * (double)LCP_SIM_NS_PER_SEC / (NowNs() - Start), Gaps[Pos]);
+    }
+    for(Pos = 0; Schedule && (Pos < sizeof(LCPPanels) / sizeof(LCPPanels[0])); Pos++){
+        printf("CRDC   : LCP %3u reports frame WCET %u us, %u dropped; task WCET us",
+               (unsigned)LCPPanels[Pos], ReportWCET[Pos][ICD_LCP_Schedule_Report::FrameSlot],
+               ReportOverruns[Pos][ICD_LCP_Schedule_Report::FrameSlot]);
+        for(Slot = 0; Slot < LCP_SCHED_TASK_COUNT; Slot++){
+            printf(" %s %u/%u", SchedTaskNames[Slot], ReportWCET[Pos][Slot], ReportOverruns[Pos][Slot]);
+        }
+        printf(" (WCET/overruns)\n");
+    }
+    return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Loads DataloadImage into the eight LCPs with the display
+ *                dataload engine and reports the time per panel
+ *
+ *  Arguments   : Interface, run time
+ *
+ *  Return Value: Exit code
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int RunDataload(const char *Interface, uint64_t Seconds){
+    static const char *Results[] = {"done", "timeout", "rejected", "flash error", "aborted"};
+    DATALOAD_NODE_STATUS Status[DATALOAD_MAX_NODES];
+    uint8_t Nodes[sizeof(LCPPanels) / sizeof(LCPPanels[0])];
+    uint64_t Start, Slowest = 0;
+    uint32_t Pos, Count, Loaded = 0;
+
+    for(Pos = 0; Pos < sizeof(Nodes); Pos++){
+        Nodes[Pos] = (uint8_t)LCPPanels[Pos];
+    }
+    SleepUntil(NowNs() + LCP_SIM_DATALOAD_SETTLE_NS);
+    if(!DataloadOpen(Interface)){
+        fprintf(stderr, "dataload engine not started on %s\n", Interface);
+        return 1;
+    }
+    Start = NowNs();
+    if(!DataloadStart(DataloadImage.data(), (uint32_t)DataloadImage.size(), Nodes, sizeof(Nodes))){
+        fprintf(stderr, "dataload not started\n");
+        DataloadClose();
+        return 1;
+    }
+    while(!StopSim && !DataloadWait(100) && (NowNs() - Start < Seconds * LCP_SIM_NS_PER_SEC)){
+    }
+    DataloadClose();
+
+    Count = DataloadGetStatus(Status, DATALOAD_MAX_NODES);
+    for(Pos = 0; Pos < Count; Pos++){
+        printf("LCP %3u: dataload %s, %u/%u blocks, %u rewinds, %.1f ms\n", Status[Pos].NodeID,
+               Results[Status[Pos].Result], Status[Pos].Acked, Status[Pos].BlockCount,
+               Status[Pos].Rewinds, Status[Pos].DurationNs / 1e6);
+        if(Status[Pos].Result == DATALOAD_OK){
+            Loaded++;
+            Slowest = std::max(Slowest, Status[Pos].DurationNs);
+        }
+    }
+    printf("dataload: %u bytes into %u of %u panels in %.1f ms, %.1f kB/s per panel\n",
+           (unsigned)DataloadImage.size(), Loaded, Count, Slowest / 1e6,
+           Slowest ? (DataloadImage.size() / 1024.0) / (Slowest / 1e9) : 0.0);
+    return (Loaded == Count) ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<pid_t> Children;
+    const char *Interface;
+    uint64_t Seconds = 10;
+    uint32_t PressCycles = 20;
+    uint32_t DataloadSize = 0;
+    bool CRDC = true, Schedule = false;
+    int Pos, Status, Result = 0;
+    pid_t Pid;
+
+    if(argc < 2){
+        fprintf(stderr, "usage: lcpsim <interface> [seconds] [press_ms] [--no-crdc] [--dataload kbytes] [--schedule] [--legacy-boot]\n");
+        return 2;
+    }
+    Interface = argv[1];
+    for(Pos = 2; Pos < argc; Pos++){
+        if(strcmp(argv[Pos], "--no-crdc") == 0){
+            CRDC = false;
+        }
+        else if(strcmp(argv[Pos], "--schedule") == 0){
+            Schedule = true;
+        }
+        else if(strcmp(argv[Pos], "--legacy-boot") == 0){
+            LegacyBoot = true;
+        }
+        else if(strcmp(argv[Pos], "--dataload") == 0 && Pos + 1 < argc){
+            DataloadSize = (uint32_t)strtoul(argv[++Pos], NULL, 10) * 1024;
+        }
+        else if(Pos == 2){
+            Seconds = strtoull(argv[Pos], NULL, 10);
+        }
+        else if(Pos == 3){
+            PressCycles = (uint32_t)(strtoul(argv[Pos], NULL, 10) * 1000000ULL / LCP_SIM_CYCLE_NS);
+        }
+    }
+    if(!CheckPayloadLayout()){
+        return 1;
+    }
+    if(DataloadSize > 0){
+        if(DataloadSize > DATALOAD_MAX_IMAGE_SIZE){
+            fprintf(stderr, "dataload image larger than %u bytes\n", DATALOAD_MAX_IMAGE_SIZE);
+            return 2;
+        }
+        srand((unsigned)NowNs());
+        DataloadImage.resize(DataloadSize);
+        for(uint8_t &Byte : DataloadImage){
+            Byte = (uint8_t)rand();
+        }
+        DataloadImageCRC = DataloadCRCForLCP(0xFFFFFFFFU, DataloadImage.data(), DataloadSize) ^ 0xFFFFFFFFU;
+        //The panels are not pressed, only loaded
+        PressCycles = 0;
+    }
+
+    signal(SIGINT, HandleStop);
+    signal(SIGTERM, HandleStop);
+    for(PanelType Panel : LCPPanels){
+        Pid = fork();
+        if(Pid == 0){
+            Status = RunLCP(Interface, Panel, Seconds, PressCycles, Schedule);
+            //_exit does not flush the stdio buffers of the child
+            fflush(stdout);
+            _exit(Status);
+        }
+        Children.push_back(Pid);
+    }
+    for(PanelType Panel : StandInPanels){
+        Pid = fork();
+        if(Pid == 0){
+            _exit(RunStandIn(Interface, Panel, Seconds, PressCycles));
+        }
+        Children.push_back(Pid);
+    }
+
+    if(DataloadSize > 0){
+        Result = RunDataload(Interface, Seconds);
+        StopSim = 1;
+    }
+    else if(CRDC){
+        RunCRDC(Interface, Seconds, Schedule);
+    }
+    for(pid_t Child : Children){
+        if(StopSim){
+            kill(Child, SIGTERM);
+        }
+        if(waitpid(Child, &Status, 0) > 0 && WIFEXITED(Status) &&
+           WEXITSTATUS(Status) == HAL_EXIT_DATALOAD){
+            printf("panel process %d reset into dataload\n", (int)Child);
+        }
+    }
+    return Result;
+}
@@ -0,0 +1,39 @@
+TEMPLATE = app
+TARGET = lcpsim
+
+CONFIG += console c++14
+CONFIG -= qt app_bundle
+
+# Host build of LocalControlPanel.c, see Source/App/lcpfirmware.c
+INCLUDEPATH += ../.. Source/App Header
+QMAKE_CFLAGS += -std=gnu11
+
+SOURCES += \
+    lcpsim.cpp \
+    hal.c \
+    Source/App/lcpfirmware.c \
+    ../../dataload.cpp
+
+HEADERS += \
+    hal.h \
+    Header/stdtypes.h \
+    Header/system/PIC32MK0512MCM100.h \
+    Header/PanelConfiguration.h \
+    Header/LocalControlPanel.h \
+    Header/LocalControlPanelTasks.h \
+    ../../../LocalControlPanelTasks.h \
+    Header/DebounceLogic.h \
+    Header/CAN_FD.h \
+    Header/Timers.h \
+    Header/Flash.h \
+    Header/delay.h \
+    Header/WatchDog.h \
+    Header/FaultMonitor.h \
+    ../../signalcodec.h \
+    ../../icdsignals.h \
+    ../../dataload.h \
+    ../../lrudata.h \
+    ../../nvmstorgae.h \
+    ../../nvmcontent.h
+
+LIBS += -lpthread
@@ -0,0 +1,252 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : psusim.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/*
+ *  Power supply sampling service simulator.
+ *
+ *  psusim [--seconds n] [--nack percent] [--device path]
+ *
+ *      Runs the application sampling service against a stand-in for the
+ *      i2c-dev bus: a power monitor at POWER_SUPPLY_SLAVE_ADD whose bus
+ *      voltage sweeps 20 V .. 34 V and back every 8 s, across both
+ *      thresholds. Every I2C_RDWR transfer is checked for the register
+ *      write / repeated start read layout. Reports the transfers per sample,
+ *      the sample rate and period jitter, the statistics, the threshold
+ *      events and any sample that differs from the value served.
+ *
+ *      --nack percent  the monitor does not acknowledge that share of the
+ *                      transfers, to exercise the failure counting
+ *      --device path   samples a real i2c-dev bus instead
+ */
+
+/****************************** HEADER FILES *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include "powersupply.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     SIM_NS_PER_SEC          1000000000ULL
+#define     SIM_SWEEP_NS            (8 * SIM_NS_PER_SEC)
+#define     SIM_LOW_UV              20000000
+#define     SIM_HIGH_UV             34000000
+#define     SIM_UV_PER_BIT          3125
+#define     SIM_READ_BATCH          64
+
+/********************* Structures  *****************************/
+typedef struct{
+    uint64_t    TimeStamp;
+    uint16_t    Raw;
+}SimServed;
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static volatile sig_atomic_t    Stop = 0;
+static uint32_t                 NackPercent = 0;
+static uint64_t                 StartNs;
+static std::atomic<uint32_t>    Transfers(0);
+static std::atomic<uint32_t>    BadLayouts(0);
+static std::vector<SimServed>   Served;             //Sampling thread only until close
+static std::mutex               EventLock;
+static std::vector<SensorEvent> Events;
+
+static const char *LevelNames[] = {"NORMAL", "LOW", "HIGH", "FAILED"};
+
+/************************ LOCAL OPERATION DEFINITIONS ***********************/
+
+static void HandleStop(int Signal){
+    (void)Signal;
+    Stop = 1;
+}
+
+static uint64_t MonotonicNs(){
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+}
+
+//Triangle between SIM_LOW_UV and SIM_HIGH_UV
+static uint16_t BusVoltageRaw(uint64_t Now){
+    uint64_t Phase = (Now - StartNs) % SIM_SWEEP_NS;
+    uint64_t Half = SIM_SWEEP_NS / 2;
+    uint64_t Span = SIM_HIGH_UV - SIM_LOW_UV;
+    uint64_t Offset = (Phase < Half) ? (Phase * Span / Half) : ((SIM_SWEEP_NS - Phase) * Span / Half);
+
+    return (uint16_t)((SIM_LOW_UV + Offset) / SIM_UV_PER_BIT);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Stand-in for ioctl(I2C_RDWR) on the bus of the monitor.
+ *                Fails like the i2c-dev driver does: EINVAL for a malformed
+ *                transfer, ENXIO for an address nobody answers, EREMOTEIO
+ *                for a NACK.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int SimTransfer(int FD, struct i2c_rdwr_ioctl_data *Data){
+    struct i2c_msg *Msgs = Data->msgs;
+    SimServed Item;
+
+    (void)FD;
+    Transfers.fetch_add(1, std::memory_order_relaxed);
+
+    if(Data->nmsgs != 2 || Msgs[0].flags != 0 || Msgs[0].len != 1 ||
+       Msgs[1].flags != I2C_M_RD || Msgs[1].len != 2 || Msgs[0].addr != Msgs[1].addr){
+        BadLayouts.fetch_add(1, std::memory_order_relaxed);
+        errno = EINVAL;
+        return -1;
+    }
+    if(Msgs[0].addr != POWER_SUPPLY_SLAVE_ADD){
+        errno = ENXIO;
+        return -1;
+    }
+    if(NackPercent != 0 && (uint32_t)(rand() % 100) < NackPercent){
+        errno = EREMOTEIO;
+        return -1;
+    }
+
+    Item.TimeStamp = MonotonicNs();
+    Item.Raw = (Msgs[0].buf[0] == BUS_VOLTAGE_REG_ADD) ? BusVoltageRaw(Item.TimeStamp) : 0;
+    Msgs[1].buf[0] = (uint8_t)(Item.Raw >> 8);
+    Msgs[1].buf[1] = (uint8_t)Item.Raw;
+    Served.push_back(Item);
+    return 2;
+}
+
+static void CollectEvent(const SensorEvent &Event){
+    std::lock_guard<std::mutex> Guard(EventLock);
+    Events.push_back(Event);
+}
+
+/************************ EXPORTED OPERATION DEFINITIONS ********************/
+
+int main(int argc, char *argv[])
+{
+    static SensorSample Samples[SENSOR_RING_SIZE];
+    const char *Device = NULL;
+    uint32_t Seconds = 10, Count = 0, Read, Mismatch = 0, Pos;
+    uint64_t Cursor = 0, Interval, MinInterval = ~0ULL, MaxInterval = 0;
+    SensorStats Stats;
+    int Arg, FD;
+
+    for(Arg = 1; Arg < argc; Arg++){
+        if(strcmp(argv[Arg], "--seconds") == 0 && Arg + 1 < argc){
+            Seconds = (uint32_t)strtoul(argv[++Arg], NULL, 10);
+        }
+        else if(strcmp(argv[Arg], "--nack") == 0 && Arg + 1 < argc){
+            NackPercent = (uint32_t)strtoul(argv[++Arg], NULL, 10);
+        }
+        else if(strcmp(argv[Arg], "--device") == 0 && Arg + 1 < argc){
+            Device = argv[++Arg];
+        }
+        else{
+            fprintf(stderr, "usage: psusim [--seconds n] [--nack percent] [--device path]\n");
+            return 2;
+        }
+    }
+
+    signal(SIGINT, HandleStop);
+    signal(SIGTERM, HandleStop);
+    Served.reserve(SENSOR_RING_SIZE);
+    PowerSupplySetSink(CollectEvent);
+    StartNs = MonotonicNs();
+
+    if(Device != NULL){
+        if(!PowerSupplyOpen(Device)){
+            fprintf(stderr, "psusim: cannot sample %s: %s\n", Device, strerror(errno));
+            return 1;
+        }
+    }
+    else{
+        FD = open("/dev/null", O_RDWR | O_CLOEXEC);
+        if(FD < 0 || !PowerSupplyOpenDevice(FD, SimTransfer)){
+            fprintf(stderr, "psusim: cannot start the service\n");
+            return 1;
+        }
+    }
+
+    for(Pos = 0; Pos < Seconds * 10 && !Stop; Pos++){
+        usleep(100000);
+    }
+    PowerSupplyClose();
+
+    //Every sample as the ring has it, against the value the monitor served
+    while((Read = PowerSupplyReadSamples(&Cursor, Samples + Count, SENSOR_RING_SIZE - Count)) != 0){
+        Count += Read;
+    }
+    for(Pos = 0; Pos < Count; Pos++){
+        if(Pos > 0){
+            Interval = Samples[Pos].TimeStamp - Samples[Pos - 1].TimeStamp;
+            MinInterval = (Interval < MinInterval) ? Interval : MinInterval;
+            MaxInterval = (Interval > MaxInterval) ? Interval : MaxInterval;
+        }
+        if(Device == NULL && (Pos >= Served.size() || Samples[Pos].Raw != Served[Pos].Raw ||
+                              Samples[Pos].Value != (int32_t)Served[Pos].Raw * SIM_UV_PER_BIT)){
+            Mismatch++;
+        }
+    }
+
+    PowerSupplyGetStats(SENSOR_BUS_VOLTAGE, &Stats);
+    printf("samples      %u in ring, %u counted, %u errors, %u overruns\n",
+           Count, Stats.Samples, Stats.Errors, Stats.Overruns);
+    if(Device == NULL){
+        printf("transfers    %u, %.2f per sample attempt, %u malformed\n", Transfers.load(),
+               (double)Transfers.load() / (double)(Stats.Samples + Stats.Errors), BadLayouts.load());
+    }
+    if(Count > 1){
+        printf("rate         %.2f Hz, period %.2f .. %.2f ms\n",
+               (double)(Count - 1) * SIM_NS_PER_SEC / (double)(Samples[Count - 1].TimeStamp - Samples[0].TimeStamp),
+               MinInterval / 1e6, MaxInterval / 1e6);
+    }
+    printf("bus voltage  last %.3f V, min %.3f V, max %.3f V, mean %.3f V, %s\n",
+           Stats.Last / 1e6, Stats.Min / 1e6, Stats.Max / 1e6, Stats.Mean / 1e6, LevelNames[Stats.Level]);
+    for(const SensorEvent &Event : Events){
+        printf("event        %8.3f s  %s -> %s at %.3f V\n", (double)(Event.TimeStamp - StartNs) / SIM_NS_PER_SEC,
+               LevelNames[Event.PrevLevel], LevelNames[Event.Level], Event.Value / 1e6);
+    }
+    if(Device == NULL){
+        printf("mismatches   %u\n", Mismatch);
+    }
+    return (Mismatch == 0 && BadLayouts.load() == 0) ? 0 : 1;
+}
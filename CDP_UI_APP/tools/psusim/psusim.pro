@@ -0,0 +1,17 @@
+TEMPLATE = app
+TARGET = psusim
+
+CONFIG += console c++14
+CONFIG -= qt app_bundle
+
+# Runs the application power supply sampling service against a simulated monitor
+INCLUDEPATH += ../..
+
+SOURCES += \
+    psusim.cpp \
+    ../../powersupply.cpp
+
+HEADERS += \
+    ../../powersupply.h
+
+LIBS += -lpthread
@@ -0,0 +1,540 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : readoutsim.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/*
+ *  Readout transport simulator and bulk readout benchmark.
+ *
+ *  readoutsim <interface> [item] [--fd] [--loss percent] [--no-nodes]
+ *
+ *      Forks a process that answers FID_READOUT_CMD for all 116 PDUs and 11
+ *      panels with a known pattern, then reads the given item (1 NVM,
+ *      2 SW FIN, 3 fault history) from every node through the application
+ *      readout engine. Reports the deck readout time, per-node latency,
+ *      retries and any content mismatch.
+ *
+ *      --fd            the nodes answer in 64 byte CAN-FD frames
+ *      --loss percent  the nodes drop that share of their frames, to exercise
+ *                      the timeouts and retries
+ *      --no-nodes      real nodes answer instead of the simulation
+ *
+ *      Bring up a virtual bus with
+ *          ip link add dev vcan0 type vcan mtu 72 && ip link set up vcan0
+ */
+
+/****************************** HEADER FILES *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <net/if.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <vector>
+#include <algorithm>
+#include "readout.h"
+#include "lrudata.h"
+#include "nvmstorgae.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     SIM_NS_PER_SEC              1000000000ULL
+#define     SIM_BATCH_SIZE              64
+#define     SIM_PAD                     0xCC
+#define     SIM_RESULT_TIMEOUT_MS       5000
+
+/********************* Structures  *****************************/
+
+//Transfer in progress at one simulated node
+typedef struct{
+    bool        Active;
+    bool        WaitFlow;
+    uint8_t     Item;
+    uint8_t     Sequence;
+    uint16_t    Length;
+    uint16_t    Sent;
+    uint32_t    Credits;            //Consecutive Frames until the next Flow Control
+}SimNode;
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static volatile sig_atomic_t StopSim = 0;
+
+static SimNode              Nodes[256];
+static struct canfd_frame   TxFrames[SIM_BATCH_SIZE];
+static struct iovec         TxIov[SIM_BATCH_SIZE];
+static struct mmsghdr       TxMsgs[SIM_BATCH_SIZE];
+static uint32_t             TxCount = 0;
+static bool                 SendFD = false;
+static uint32_t             LossPercent = 0;
+static unsigned             LossSeed = 1;
+static int                  NodeSock = -1;
+
+static void HandleStop(int){
+    StopSim = 1;
+}
+
+static uint64_t NowNs(){
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * SIM_NS_PER_SEC) + (uint64_t)Now.tv_nsec;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Node IDs of the simulated deck, every PDU and panel
+ *
+ *-----------------------------------------------------------------------------
+ */
+static std::vector<uint8_t> DeckNodes(){
+    static const uint8_t Panels[] = {NID_MCP, NID_OCP, NID_ICP,
+                                     NID_LCP1LH, NID_LCP2LH, NID_LCP3LH, NID_LCP4LH,
+                                     NID_LCP1RH, NID_LCP2RH, NID_LCP3RH, NID_LCP4RH};
+    std::vector<uint8_t> List;
+    uint32_t Pos;
+
+    for(Pos = 0; Pos < PDUL_MAX_COUNT; Pos++){
+        List.push_back((uint8_t)Pos);
+    }
+    for(Pos = 0; Pos < PDUR_MAX_COUNT; Pos++){
+        List.push_back((uint8_t)(PDUR_COUNT_START + Pos));
+    }
+    List.insert(List.end(), std::begin(Panels), std::end(Panels));
+    return List;
+}
+
+static uint16_t ItemLength(uint8_t Item){
+    switch(Item){
+    case READOUT_ITEM_NVM:              return sizeof(NVM_Layout);
+    case READOUT_ITEM_SW_FIN:           return sizeof(((Config_Record_Layout *)0)->SWFIN);
+    case READOUT_ITEM_FAULT_HISTORY:    return NVM_FAULT_RECORDS * sizeof(Fault_Record_Layout);
+    default:                            return 0;
+    }
+}
+
+static uint8_t Pattern(uint8_t NodeID, uint8_t Item, uint32_t Offset){
+    return (uint8_t)(NodeID * 31 + Item * 7 + Offset);
+}
+
+//Smallest CAN-FD data length holding Length bytes
+static uint8_t FDLength(uint8_t Length){
+    static const uint8_t Sizes[] = {8, 12, 16, 20, 24, 32, 48, 64};
+
+    for(uint8_t Size : Sizes){
+        if(Length <= Size){
+            return Size;
+        }
+    }
+    return CANFD_MAX_DLEN;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Opens a raw socket on the interface, with CAN-FD enabled and
+ *                only the given Function ID passing
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int OpenSocket(const char *Interface, uint8_t FunctionID){
+    struct sockaddr_can Addr;
+    struct can_filter Filter;
+    struct ifreq ifr;
+    ARBITRATION_FIELD FilterID, FilterMask;
+    int Enable = 1;
+    int Sock = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+
+    if(Sock < 0){
+        perror("socket");
+        return -1;
+    }
+    FilterMask.Data = 0;
+    FilterMask.Bits.FuntionIdentifier = 0x3F;
+    FilterID.Data = 0;
+    FilterID.Bits.FuntionIdentifier = FunctionID;
+    Filter.can_id   = (FilterID.Data & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    Filter.can_mask = (FilterMask.Data & CAN_EFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FILTER, &Filter, sizeof(Filter));
+    setsockopt(Sock, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &Enable, sizeof(Enable));
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, Interface, IFNAMSIZ - 1);
+    if(ioctl(Sock, SIOCGIFINDEX, &ifr) < 0){
+        perror("SIOCGIFINDEX");
+        close(Sock);
+        return -1;
+    }
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.can_family = AF_CAN;
+    Addr.can_ifindex = ifr.ifr_ifindex;
+    if(bind(Sock, (struct sockaddr *)&Addr, sizeof(Addr)) < 0){
+        perror("bind");
+        close(Sock);
+        return -1;
+    }
+    return Sock;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Node side transmit, batched like the engine
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void FlushNodeTx(){
+    uint32_t Sent = 0;
+    int Count;
+
+    while(Sent < TxCount){
+        Count = sendmmsg(NodeSock, &TxMsgs[Sent], TxCount - Sent, 0);
+        if(Count <= 0){
+            if(Count < 0 && errno == ENOBUFS){
+                usleep(100);
+                continue;
+            }
+            break;
+        }
+        Sent += Count;
+    }
+    TxCount = 0;
+}
+
+static struct canfd_frame *NodeFrame(uint8_t NodeID){
+    struct canfd_frame *Frame;
+    ARBITRATION_FIELD ID;
+
+    if(TxCount == SIM_BATCH_SIZE){
+        FlushNodeTx();
+    }
+    ID.Data = 0;
+    ID.Bits.FuntionIdentifier = FID_READOUT_RESPONSE;
+    ID.Bits.NodeIdentifier = NodeID;
+    Frame = &TxFrames[TxCount];
+    memset(Frame, SIM_PAD, sizeof(*Frame));
+    Frame->can_id = (ID.Data & CAN_EFF_MASK) | CAN_EFF_FLAG;
+    Frame->flags = SendFD ? CANFD_BRS : 0;
+    Frame->__res0 = 0;
+    Frame->__res1 = 0;
+    return Frame;
+}
+
+//Keeps the frame unless the loss simulation drops it
+static void NodeSend(struct canfd_frame *Frame, uint8_t Used){
+    if(LossPercent && (uint32_t)(rand_r(&LossSeed) % 100) < LossPercent){
+        return;
+    }
+    Frame->len = SendFD ? FDLength(Used) : CAN_MAX_DLEN;
+    Frame->flags = SendFD ? Frame->flags : 0;
+    TxIov[TxCount].iov_len = SendFD ? CANFD_MTU : CAN_MTU;
+    TxCount++;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Answers a readout request with a Single Frame, or a First
+ *                Frame followed by Consecutive Frames once the CDP sends
+ *                Flow Control
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void NodeRequest(uint8_t NodeID, uint8_t Item){
+    SimNode &Node = Nodes[NodeID];
+    struct canfd_frame *Frame = NodeFrame(NodeID);
+    uint8_t Capacity = SendFD ? CANFD_MAX_DLEN : CAN_MAX_DLEN;
+    uint32_t Pos, Head;
+
+    Node.Item = Item;
+    Node.Length = ItemLength(Item);
+    Node.Active = false;
+
+    //The CAN-FD Single Frame escape is only used past 8 bytes
+    if(Node.Length <= (uint32_t)(Capacity - 2) || Node.Length < CAN_MAX_DLEN){
+        Head = (Node.Length < CAN_MAX_DLEN) ? 1 : 2;
+        Frame->data[0] = READOUT_PCI_SINGLE | ((Head == 1) ? Node.Length : 0);
+        Frame->data[1] = (uint8_t)Node.Length;
+        for(Pos = 0; Pos < Node.Length; Pos++){
+            Frame->data[Head + Pos] = Pattern(NodeID, Item, Pos);
+        }
+        NodeSend(Frame, (uint8_t)(Head + Node.Length));
+        return;
+    }
+
+    Frame->data[0] = (uint8_t)(READOUT_PCI_FIRST | (Node.Length >> 8));
+    Frame->data[1] = (uint8_t)Node.Length;
+    for(Pos = 0; Pos < (uint32_t)(Capacity - 2); Pos++){
+        Frame->data[2 + Pos] = Pattern(NodeID, Item, Pos);
+    }
+    NodeSend(Frame, Capacity);
+    Node.Sent = Capacity - 2;
+    Node.Sequence = 1;
+    Node.Credits = 0;
+    Node.WaitFlow = true;
+    Node.Active = true;
+}
+
+static bool NodeConsecutive(uint8_t NodeID){
+    SimNode &Node = Nodes[NodeID];
+    struct canfd_frame *Frame;
+    uint8_t Capacity = (SendFD ? CANFD_MAX_DLEN : CAN_MAX_DLEN) - 1;
+    uint32_t Pos, Count;
+
+    if(!Node.Active || Node.WaitFlow){
+        return false;
+    }
+    Frame = NodeFrame(NodeID);
+    Count = std::min<uint32_t>(Capacity, Node.Length - Node.Sent);
+    Frame->data[0] = READOUT_PCI_CONSECUTIVE | Node.Sequence;
+    for(Pos = 0; Pos < Count; Pos++){
+        Frame->data[1 + Pos] = Pattern(NodeID, Node.Item, Node.Sent + Pos);
+    }
+    NodeSend(Frame, (uint8_t)(1 + Count));
+    Node.Sent += Count;
+    Node.Sequence = (Node.Sequence + 1) & 0x0F;
+    if(Node.Sent >= Node.Length){
+        Node.Active = false;
+    }
+    else if(Node.Credits && (--Node.Credits == 0)){
+        Node.WaitFlow = true;
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Simulated deck. Every node with Flow Control credit sends
+ *                one Consecutive Frame per pass, so the nodes interleave on
+ *                the bus as they would with their own bit timing.
+ *
+ *  Arguments   : Socket, run time
+ *
+ *  Return Value: Exit code
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int RunNodes(int Sock, uint64_t Seconds){
+    struct canfd_frame RxFrames[SIM_BATCH_SIZE];
+    struct iovec RxIov[SIM_BATCH_SIZE];
+    struct mmsghdr RxMsgs[SIM_BATCH_SIZE];
+    struct pollfd Fd = {Sock, POLLIN, 0};
+    std::vector<uint8_t> Deck = DeckNodes();
+    ARBITRATION_FIELD ID;
+    uint64_t End = NowNs() + Seconds * SIM_NS_PER_SEC;
+    bool Served[256] = {false};
+    bool Sending;
+    int Count, Pos;
+
+    NodeSock = Sock;
+    for(uint8_t NodeID : Deck){
+        Served[NodeID] = true;
+    }
+    memset(Nodes, 0, sizeof(Nodes));
+    memset(RxMsgs, 0, sizeof(RxMsgs));
+    memset(TxMsgs, 0, sizeof(TxMsgs));
+    for(Pos = 0; Pos < SIM_BATCH_SIZE; Pos++){
+        RxIov[Pos].iov_base = &RxFrames[Pos];
+        RxIov[Pos].iov_len = sizeof(struct canfd_frame);
+        RxMsgs[Pos].msg_hdr.msg_iov = &RxIov[Pos];
+        RxMsgs[Pos].msg_hdr.msg_iovlen = 1;
+        TxIov[Pos].iov_base = &TxFrames[Pos];
+        TxMsgs[Pos].msg_hdr.msg_iov = &TxIov[Pos];
+        TxMsgs[Pos].msg_hdr.msg_iovlen = 1;
+    }
+
+    while(!StopSim && NowNs() < End){
+        if(poll(&Fd, 1, 10) <= 0){
+            continue;
+        }
+        Count = recvmmsg(Sock, RxMsgs, SIM_BATCH_SIZE, MSG_DONTWAIT, NULL);
+        for(Pos = 0; Pos < Count; Pos++){
+            const struct canfd_frame &Frame = RxFrames[Pos];
+
+            ID.Data = Frame.can_id & CAN_EFF_MASK;
+            if((ID.Bits.FuntionIdentifier != FID_READOUT_CMD) ||
+               !Served[ID.Bits.NodeIdentifier] || (Frame.len < 2)){
+                continue;
+            }
+            SimNode &Node = Nodes[ID.Bits.NodeIdentifier];
+            switch(Frame.data[0] & 0xF0){
+            case READOUT_PCI_SINGLE:
+                NodeRequest(ID.Bits.NodeIdentifier, Frame.data[1]);
+                break;
+            case READOUT_PCI_FLOW:
+                if((Frame.data[0] & 0x0F) == READOUT_FLOW_CTS){
+                    Node.Credits = Frame.data[1];
+                    Node.WaitFlow = false;
+                }
+                else if((Frame.data[0] & 0x0F) == READOUT_FLOW_OVERFLOW){
+                    Node.Active = false;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        do{
+            Sending = false;
+            for(uint8_t NodeID : Deck){
+                Sending |= NodeConsecutive(NodeID);
+            }
+        }while(Sending);
+        FlushNodeTx();
+    }
+    return 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Reads Item from every node of the deck through the readout
+ *                engine and checks the received pattern
+ *
+ *  Arguments   : Item, expect the simulated pattern
+ *
+ *  Return Value: Exit code
+ *
+ *-----------------------------------------------------------------------------
+ */
+static int RunDeck(uint8_t Item, bool Simulated){
+    std::vector<uint8_t> Deck = DeckNodes();
+    std::vector<uint64_t> Latency;
+    READOUT_RESULT Result;
+    READOUT_STATS Stats;
+    uint32_t Done = 0, Failed = 0, Mismatch = 0, Pos;
+    uint64_t Start = NowNs(), Bytes = 0;
+
+    for(uint8_t NodeID : Deck){
+        if(!ReadoutRequest(NodeID, Item)){
+            fprintf(stderr, "node %u: request not queued\n", NodeID);
+            Failed++;
+        }
+    }
+    while(Done + Failed < Deck.size() && !StopSim){
+        if(!ReadoutTakeResult(&Result, SIM_RESULT_TIMEOUT_MS)){
+            fprintf(stderr, "no readout result in %d ms\n", SIM_RESULT_TIMEOUT_MS);
+            break;
+        }
+        if(Result.Status != READOUT_OK){
+            printf("node %3u: status %u after %u retries\n", Result.NodeID, Result.Status, Result.Retries);
+            Failed++;
+            continue;
+        }
+        if(Simulated){
+            for(Pos = 0; Pos < ItemLength(Item) && Pos < Result.Length; Pos++){
+                if(Result.Data[Pos] != Pattern(Result.NodeID, Item, Pos)){
+                    break;
+                }
+            }
+            if((Result.Length != ItemLength(Item)) || (Pos != Result.Length)){
+                printf("node %3u: %u bytes, content differs at %u\n", Result.NodeID, Result.Length, Pos);
+                Mismatch++;
+            }
+        }
+        Bytes += Result.Length;
+        Latency.push_back(Result.DurationNs);
+        ReadoutRelease(Result.Data);
+        Done++;
+    }
+
+    ReadoutGetStats(&Stats);
+    std::sort(Latency.begin(), Latency.end());
+    printf("%u of %u nodes read, %llu bytes in %.1f ms, %u failed, %u mismatched\n",
+           Done, (unsigned)Deck.size(), (unsigned long long)Bytes,
+           (NowNs() - Start) / 1e6, Failed, Mismatch);
+    if(!Latency.empty()){
+        printf("per node p50 %.1f ms p99 %.1f ms max %.1f ms\n",
+               Latency[Latency.size() / 2] / 1e6,
+               Latency[(Latency.size() * 99) / 100] / 1e6, Latency.back() / 1e6);
+    }
+    printf("frames rx %llu tx %llu unexpected %llu, retries %llu\n",
+           (unsigned long long)Stats.FramesReceived, (unsigned long long)Stats.FramesSent,
+           (unsigned long long)Stats.FramesUnexpected, (unsigned long long)Stats.Retries);
+    return (Failed || Mismatch || Done < Deck.size()) ? 1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *Interface;
+    uint8_t Item = READOUT_ITEM_NVM;
+    bool Simulated = true;
+    int Pos, Status, Result, Sock;
+    pid_t Child = -1;
+
+    if(argc < 2){
+        fprintf(stderr, "usage: readoutsim <interface> [item] [--fd] [--loss percent] [--no-nodes]\n");
+        return 2;
+    }
+    Interface = argv[1];
+    for(Pos = 2; Pos < argc; Pos++){
+        if(strcmp(argv[Pos], "--fd") == 0){
+            SendFD = true;
+        }
+        else if(strcmp(argv[Pos], "--no-nodes") == 0){
+            Simulated = false;
+        }
+        else if(strcmp(argv[Pos], "--loss") == 0 && Pos + 1 < argc){
+            LossPercent = (uint32_t)strtoul(argv[++Pos], NULL, 10);
+        }
+        else if(Pos == 2){
+            Item = (uint8_t)strtoul(argv[Pos], NULL, 10);
+        }
+    }
+
+    signal(SIGINT, HandleStop);
+    signal(SIGTERM, HandleStop);
+    if(Simulated){
+        //Open before the fork so no request goes out ahead of the filter
+        Sock = OpenSocket(Interface, FID_READOUT_CMD);
+        if(Sock < 0){
+            return 1;
+        }
+        Child = fork();
+        if(Child == 0){
+            _exit(RunNodes(Sock, 3600));
+        }
+        close(Sock);
+    }
+
+    if(!ReadoutOpen(Interface)){
+        fprintf(stderr, "%s: readout engine not started\n", Interface);
+        Result = 1;
+    }
+    else{
+        Result = RunDeck(Item, Simulated);
+        ReadoutClose();
+    }
+
+    if(Child > 0){
+        kill(Child, SIGTERM);
+        waitpid(Child, &Status, 0);
+    }
+    return Result;
+}
@@ -0,0 +1,20 @@
+TEMPLATE = app
+TARGET = readoutsim
+
+CONFIG += console c++14
+CONFIG -= qt app_bundle
+
+# Runs the application readout engine against simulated PDUs and panels
+INCLUDEPATH += ../..
+
+SOURCES += \
+    readoutsim.cpp \
+    ../../readout.cpp
+
+HEADERS += \
+    ../../readout.h \
+    ../../lrudata.h \
+    ../../nvmstorgae.h \
+    ../../nvmcontent.h
+
+LIBS += -lpthread
@@ -0,0 +1,428 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : trace.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "trace.h"
+#include <atomic>
+#include <thread>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/eventfd.h>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     TRACE_EVENT_MASK            (TRACE_EVENT_COUNT - 1)
+#define     TRACE_SUB_BUCKETS           (1U << TRACE_SUB_BUCKET_BITS)
+
+static_assert((TRACE_EVENT_COUNT & TRACE_EVENT_MASK) == 0, "Event ring size must be a power of 2");
+
+/********************* Structures  *****************************/
+//Log-linear (HDR) histogram of one stage, in ns
+typedef struct{
+    std::atomic<uint64_t>   Buckets[TRACE_BUCKET_COUNT];
+    std::atomic<uint64_t>   Count;
+    std::atomic<uint64_t>   Sum;
+    std::atomic<uint64_t>   Max;
+}TraceHistogram;
+
+//One ring entry. Sequence is odd while the entry is written, the reader
+//drops entries that changed under it.
+typedef struct{
+    std::atomic<uint64_t>   Sequence;
+    std::atomic<uint64_t>   Start;
+    std::atomic<uint64_t>   Duration;
+    std::atomic<uint32_t>   Value;
+    std::atomic<uint8_t>    Stage;
+}TraceEvent;
+
+typedef struct{
+    std::atomic<uint64_t>   Frames;
+    std::atomic<uint64_t>   Invalid;
+}TraceFIDCounter;
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+static const char *StageNames[TRACE_STAGE_COUNT] = {"socket_read", "frame_age", "decode",
+                                                    "publish", "snapshot", "widget_update",
+                                                    "page_build", "first_frame"};
+
+static const char *CounterNames[TRACE_COUNTER_COUNT] = {"rx_dropped", "refresh_deferred"};
+
+static TraceHistogram           Histograms[TRACE_STAGE_COUNT];
+static TraceEvent               Events[TRACE_EVENT_COUNT];
+static std::atomic<uint64_t>    EventHead(0);
+static TraceFIDCounter          FIDCounters[TRACE_FID_COUNT];
+static std::atomic<uint64_t>    Counters[TRACE_COUNTER_COUNT];
+static const uint64_t           StartTime = TraceNow();
+
+static std::atomic<bool>        Opened(false);
+static std::thread              Server;
+static int                      ListenFD = -1;
+static int                      WakeFD = -1;
+static char                     SocketPath[sizeof(((struct sockaddr_un *)0)->sun_path)];
+
+/************************ LOCAL OPERATION DEFINITIONS ***********************/
+
+/*-----------------------------------------------------------------------------
+ *  Description : Bucket of a value. Values below TRACE_SUB_BUCKETS have a
+ *                bucket each, above that every power of 2 is split into
+ *                TRACE_SUB_BUCKETS linear buckets.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static inline uint32_t BucketIndex(uint64_t Value){
+    uint32_t Exponent;
+
+    if(Value < TRACE_SUB_BUCKETS){
+        return (uint32_t)Value;
+    }
+    Exponent = 63 - __builtin_clzll(Value);
+    return ((Exponent - TRACE_SUB_BUCKET_BITS + 1) << TRACE_SUB_BUCKET_BITS) |
+           (uint32_t)((Value >> (Exponent - TRACE_SUB_BUCKET_BITS)) & (TRACE_SUB_BUCKETS - 1));
+}
+
+//Highest value that falls into a bucket
+static uint64_t BucketLimit(uint32_t Index){
+    uint32_t Exponent;
+
+    if(Index < TRACE_SUB_BUCKETS){
+        return Index;
+    }
+    Exponent = (Index >> TRACE_SUB_BUCKET_BITS) + TRACE_SUB_BUCKET_BITS - 1;
+    return ((((uint64_t)(Index & (TRACE_SUB_BUCKETS - 1)) | TRACE_SUB_BUCKETS) + 1)
+            << (Exponent - TRACE_SUB_BUCKET_BITS)) - 1;
+}
+
+static void AddToHistogram(TraceHistogram &Histogram, uint64_t Ns){
+    uint64_t Max = Histogram.Max.load(std::memory_order_relaxed);
+
+    Histogram.Buckets[BucketIndex(Ns)].fetch_add(1, std::memory_order_relaxed);
+    Histogram.Count.fetch_add(1, std::memory_order_relaxed);
+    Histogram.Sum.fetch_add(Ns, std::memory_order_relaxed);
+    while(Ns > Max && !Histogram.Max.compare_exchange_weak(Max, Ns, std::memory_order_relaxed)){
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Value below which Percent of the samples fall, taken from a
+ *                copy of the buckets so concurrent writers do not skew it
+ *
+ *-----------------------------------------------------------------------------
+ */
+static uint64_t Percentile(const uint64_t *Buckets, uint64_t Count, double Percent){
+    uint64_t Rank = (uint64_t)((Count * Percent) / 100.0 + 0.5);
+    uint64_t Seen = 0;
+    uint32_t Pos;
+
+    if(Rank == 0){
+        Rank = 1;
+    }
+    for(Pos = 0; Pos < TRACE_BUCKET_COUNT; Pos++){
+        Seen += Buckets[Pos];
+        if(Seen >= Rank){
+            return BucketLimit(Pos);
+        }
+    }
+    return BucketLimit(TRACE_BUCKET_COUNT - 1);
+}
+
+static void WriteDump(FILE *File){
+    uint64_t Buckets[TRACE_BUCKET_COUNT];
+    uint64_t Count, Sequence, Head, Pos, Start, Duration;
+    uint32_t Stage, Value, Bucket;
+
+    fprintf(File, "# CDP trace, %.3f s since start\n", (TraceNow() - StartTime) / 1e9);
+    fprintf(File, "%-16s %10s %10s %10s %10s %10s %10s %10s\n", "stage(us)", "count",
+            "mean", "p50", "p90", "p99", "p99.9", "max");
+    for(Stage = 0; Stage < TRACE_STAGE_COUNT; Stage++){
+        TraceHistogram &Histogram = Histograms[Stage];
+
+        Count = 0;
+        for(Bucket = 0; Bucket < TRACE_BUCKET_COUNT; Bucket++){
+            Buckets[Bucket] = Histogram.Buckets[Bucket].load(std::memory_order_relaxed);
+            Count += Buckets[Bucket];
+        }
+        if(Count == 0){
+            fprintf(File, "%-16s %10u\n", StageNames[Stage], 0U);
+            continue;
+        }
+        fprintf(File, "%-16s %10llu %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", StageNames[Stage],
+                (unsigned long long)Count, Histogram.Sum.load(std::memory_order_relaxed) / 1e3 / Count,
+                Percentile(Buckets, Count, 50.0) / 1e3, Percentile(Buckets, Count, 90.0) / 1e3,
+                Percentile(Buckets, Count, 99.0) / 1e3, Percentile(Buckets, Count, 99.9) / 1e3,
+                Histogram.Max.load(std::memory_order_relaxed) / 1e3);
+    }
+
+    fprintf(File, "\n%-16s %10s\n", "counter", "count");
+    for(Pos = 0; Pos < TRACE_COUNTER_COUNT; Pos++){
+        fprintf(File, "%-16s %10llu\n", CounterNames[Pos],
+                (unsigned long long)Counters[Pos].load(std::memory_order_relaxed));
+    }
+
+    fprintf(File, "\n%-16s %10s %10s\n", "fid", "frames", "invalid");
+    for(Pos = 0; Pos < TRACE_FID_COUNT; Pos++){
+        if(FIDCounters[Pos].Frames.load(std::memory_order_relaxed) != 0){
+            fprintf(File, "%-16u %10llu %10llu\n", (unsigned)Pos,
+                    (unsigned long long)FIDCounters[Pos].Frames.load(std::memory_order_relaxed),
+                    (unsigned long long)FIDCounters[Pos].Invalid.load(std::memory_order_relaxed));
+        }
+    }
+
+    fprintf(File, "\n%-16s %14s %10s %10s\n", "event", "start(us)", "dur(us)", "value");
+    Head = EventHead.load(std::memory_order_acquire);
+    for(Pos = (Head > TRACE_EVENT_COUNT) ? Head - TRACE_EVENT_COUNT : 0; Pos < Head; Pos++){
+        TraceEvent &Event = Events[Pos & TRACE_EVENT_MASK];
+
+        Sequence = Event.Sequence.load(std::memory_order_acquire);
+        Start = Event.Start.load(std::memory_order_relaxed);
+        Duration = Event.Duration.load(std::memory_order_relaxed);
+        Value = Event.Value.load(std::memory_order_relaxed);
+        Stage = Event.Stage.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if((Sequence != 2 * Pos + 2) || (Event.Sequence.load(std::memory_order_relaxed) != Sequence) ||
+           (Stage >= TRACE_STAGE_COUNT)){
+            continue;
+        }
+        fprintf(File, "%-16s %14.1f %10.1f %10u\n", StageNames[Stage],
+                (Start - StartTime) / 1e3, Duration / 1e3, Value);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sends one formatted dump to a client. MSG_NOSIGNAL keeps a
+ *                client that closed early from raising SIGPIPE, the send
+ *                timeout of the socket drops a client that stopped reading.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void SendDump(int Client, const char *Buffer, size_t Length){
+    ssize_t Sent;
+
+    while(Length > 0){
+        Sent = send(Client, Buffer, Length, MSG_NOSIGNAL);
+        if(Sent < 0 && errno == EINTR){
+            continue;
+        }
+        if(Sent <= 0){
+            return;
+        }
+        Buffer += Sent;
+        Length -= (size_t)Sent;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Dump server thread, answers every connection with one dump.
+ *                The dump is formatted in memory, the client socket is never
+ *                written through stdio.
+ *
+ *-----------------------------------------------------------------------------
+ */
+static void ServerThread(){
+    struct pollfd Fds[2] = {{ListenFD, POLLIN, 0}, {WakeFD, POLLIN, 0}};
+    struct timeval Timeout = {TRACE_SEND_TIMEOUT_MS / 1000, (TRACE_SEND_TIMEOUT_MS % 1000) * 1000};
+    FILE *File;
+    char *Buffer;
+    size_t Length;
+    int Client;
+
+    while(Opened.load(std::memory_order_acquire)){
+        if(poll(Fds, 2, -1) <= 0 || (Fds[1].revents & POLLIN)){
+            continue;
+        }
+        Client = accept4(ListenFD, nullptr, nullptr, SOCK_CLOEXEC);
+        if(Client < 0){
+            continue;
+        }
+        setsockopt(Client, SOL_SOCKET, SO_SNDTIMEO, &Timeout, sizeof(Timeout));
+
+        Buffer = nullptr;
+        Length = 0;
+        File = open_memstream(&Buffer, &Length);
+        if(File != nullptr){
+            WriteDump(File);
+            if(fclose(File) == 0){
+                SendDump(Client, Buffer, Length);
+            }
+        }
+        free(Buffer);
+        close(Client);
+    }
+}
+
+/************************ EXPORTED OPERATION DEFINITIONS *********************/
+
+void TraceRecord(uint8_t Stage, uint64_t Start, uint32_t Value){
+    uint64_t Duration = TraceNow() - Start;
+    uint64_t Pos = EventHead.fetch_add(1, std::memory_order_relaxed);
+    TraceEvent &Event = Events[Pos & TRACE_EVENT_MASK];
+
+    AddToHistogram(Histograms[Stage], Duration);
+
+    Event.Sequence.store(2 * Pos + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    Event.Start.store(Start, std::memory_order_relaxed);
+    Event.Duration.store(Duration, std::memory_order_relaxed);
+    Event.Value.store(Value, std::memory_order_relaxed);
+    Event.Stage.store(Stage, std::memory_order_relaxed);
+    Event.Sequence.store(2 * Pos + 2, std::memory_order_release);
+}
+
+void TraceLatency(uint8_t Stage, uint64_t Ns){
+    AddToHistogram(Histograms[Stage], Ns);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Age of a frame from its kernel receive stamp. Hardware
+ *                stamps on another clock give no sensible age and are left
+ *                out.
+ *
+ *  Arguments   : Kernel receive time, CLOCK_REALTIME ns
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void TraceFrameAge(uint64_t KernelStamp){
+    struct timespec Now;
+    uint64_t Age;
+
+    if(KernelStamp == 0){
+        return;
+    }
+    clock_gettime(CLOCK_REALTIME, &Now);
+    Age = ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec - KernelStamp;
+    if(Age < TRACE_MAX_FRAME_AGE_NS){
+        AddToHistogram(Histograms[TRACE_FRAME_AGE], Age);
+    }
+}
+
+void TraceFrame(uint8_t FunctionID){
+    FIDCounters[FunctionID & (TRACE_FID_COUNT - 1)].Frames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TraceInvalid(uint8_t FunctionID){
+    FIDCounters[FunctionID & (TRACE_FID_COUNT - 1)].Invalid.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TraceCount(uint8_t Counter, uint32_t Count){
+    Counters[Counter].fetch_add(Count, std::memory_order_relaxed);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Binds the dump socket and starts the dump server
+ *
+ *  Arguments   : Socket path, nullptr for the default
+ *
+ *  Return Value: false when the socket could not be opened
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool TraceOpen(const char *Path){
+    struct sockaddr_un Addr;
+
+    if(Opened.load(std::memory_order_acquire)){
+        return false;
+    }
+    if(Path == nullptr){
+        Path = getenv(TRACE_SOCKET_ENV) ? getenv(TRACE_SOCKET_ENV) : TRACE_SOCKET_PATH;
+    }
+    if(strlen(Path) >= sizeof(SocketPath)){
+        return false;
+    }
+    memset(&Addr, 0, sizeof(Addr));
+    Addr.sun_family = AF_UNIX;
+    strcpy(Addr.sun_path, Path);
+    strcpy(SocketPath, Path);
+
+    ListenFD = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    WakeFD = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    //A socket file left by a previous run would fail the bind
+    unlink(Path);
+    if((ListenFD < 0) || (WakeFD < 0) ||
+       (bind(ListenFD, (struct sockaddr *)&Addr, sizeof(Addr)) < 0) || (listen(ListenFD, 4) < 0)){
+        if(ListenFD >= 0){
+            close(ListenFD);
+        }
+        if(WakeFD >= 0){
+            close(WakeFD);
+        }
+        ListenFD = WakeFD = -1;
+        return false;
+    }
+    Opened.store(true, std::memory_order_release);
+    Server = std::thread(ServerThread);
+    return true;
+}
+
+void TraceClose(){
+    uint64_t One = 1;
+
+    if(!Opened.exchange(false)){
+        return;
+    }
+    if(write(WakeFD, &One, sizeof(One)) < 0){
+        /* Counter saturated, the server is awake anyway */
+    }
+    Server.join();
+    close(ListenFD);
+    close(WakeFD);
+    unlink(SocketPath);
+    ListenFD = WakeFD = -1;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Writes one dump to a file
+ *
+ *  Arguments   : File path
+ *
+ *  Return Value: false when the file could not be written
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool TraceDump(const char *Path){
+    FILE *File = fopen(Path, "w");
+
+    if(File == nullptr){
+        return false;
+    }
+    WriteDump(File);
+    return (fclose(File) == 0);
+}
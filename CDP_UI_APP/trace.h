@@ -0,0 +1,142 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : trace.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+#include <time.h>
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+#define     TRACE_SOCKET_PATH           "/tmp/cdp_trace.sock"
+#define     TRACE_SOCKET_ENV            "CDP_TRACE_SOCKET"
+#define     TRACE_SEND_TIMEOUT_MS       1000        //Client dropped when it stops reading
+#define     TRACE_EVENT_COUNT           4096        //Event ring, power of 2
+#define     TRACE_SUB_BUCKET_BITS       4           //16 buckets per power of 2, 6.25 % resolution
+#define     TRACE_BUCKET_COUNT          ((64 - TRACE_SUB_BUCKET_BITS + 1) << TRACE_SUB_BUCKET_BITS)
+#define     TRACE_FID_COUNT             64          //6 bit Function ID
+#define     TRACE_MAX_FRAME_AGE_NS      60000000000ULL  //Older kernel stamps are not on CLOCK_REALTIME
+
+/*-----------------------------------------------------------------------------
+ *  Description : Hot path trace points. With CDP_TRACE undefined (see
+ *                CDP_UI_APP.pro) they compile to nothing and their arguments
+ *                are not evaluated.
+ *
+ *                TRACE_BEGIN(Start)                  : takes the span start
+ *                TRACE_END(Stage, Start, Value)      : histogram and event
+ *                TRACE_LATENCY(Stage, Ns)            : histogram only
+ *                TRACE_AGE(KernelStamp)              : TRACE_FRAME_AGE of a frame
+ *                TRACE_FRAME(FunctionID)             : per FID frame counter
+ *                TRACE_INVALID(FunctionID)           : per FID undecoded frame
+ *                TRACE_COUNT(Counter, Count)
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifdef CDP_TRACE
+#define     TRACE_BEGIN(Start)                  const uint64_t Start = TraceNow()
+#define     TRACE_END(Stage, Start, Value)      TraceRecord((Stage), (Start), (uint32_t)(Value))
+#define     TRACE_LATENCY(Stage, Ns)            TraceLatency((Stage), (Ns))
+#define     TRACE_AGE(KernelStamp)              TraceFrameAge(KernelStamp)
+#define     TRACE_FRAME(FunctionID)             TraceFrame(FunctionID)
+#define     TRACE_INVALID(FunctionID)           TraceInvalid(FunctionID)
+#define     TRACE_COUNT(Counter, Count)         TraceCount((Counter), (uint32_t)(Count))
+#else
+#define     TRACE_BEGIN(Start)                  do{}while(0)
+#define     TRACE_END(Stage, Start, Value)      do{}while(0)
+#define     TRACE_LATENCY(Stage, Ns)            do{}while(0)
+#define     TRACE_AGE(KernelStamp)              do{}while(0)
+#define     TRACE_FRAME(FunctionID)             do{}while(0)
+#define     TRACE_INVALID(FunctionID)           do{}while(0)
+#define     TRACE_COUNT(Counter, Count)         do{}while(0)
+#endif
+
+/********************* ENUMS  *****************************/
+enum TRACE_STAGE {TRACE_SOCKET_READ = 0,        //One recvmmsg batch, Value frames
+                  TRACE_FRAME_AGE,              //Kernel receive to decode, per frame
+                  TRACE_DECODE,                 //One parser batch, Value frames
+                  TRACE_PUBLISH,                //LRU changes handed to the UI
+                  TRACE_SNAPSHOT,               //LRU store copied for a refresh
+                  TRACE_WIDGET_UPDATE,          //Every page's UpdateUI, Value groups
+                  TRACE_PAGE_BUILD,             //Page built on its first opening, Value Current_Page
+                  TRACE_FIRST_FRAME,            //Process start to the first main window frame
+                  TRACE_STAGE_COUNT};
+
+enum TRACE_COUNTER {TRACE_RX_DROPPED = 0,       //Socket queue overflow
+                    TRACE_REFRESH_DEFERRED,     //Store busy, refresh moved on a period
+                    TRACE_COUNTER_COUNT};
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+
+static inline uint64_t TraceNow(){
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64_t)Now.tv_sec * 1000000000ULL) + (uint64_t)Now.tv_nsec;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Lock free, callable from any thread. TraceRecord ends a span
+ *                started at Start (TraceNow), adds it to the histogram of
+ *                the stage and to the event ring.
+ *
+ *-----------------------------------------------------------------------------
+ */
+void TraceRecord(uint8_t Stage, uint64_t Start, uint32_t Value);
+void TraceLatency(uint8_t Stage, uint64_t Ns);
+void TraceFrameAge(uint64_t KernelStamp);
+void TraceFrame(uint8_t FunctionID);
+void TraceInvalid(uint8_t FunctionID);
+void TraceCount(uint8_t Counter, uint32_t Count);
+
+/*-----------------------------------------------------------------------------
+ *  Description : Starts the dump server on a local Unix socket, every client
+ *                that connects is sent one dump and disconnected, e.g.
+ *                    socat - UNIX-CONNECT:/tmp/cdp_trace.sock
+ *                Path nullptr takes CDP_TRACE_SOCKET or TRACE_SOCKET_PATH.
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool TraceOpen(const char *Path);
+void TraceClose();
+
+/*-----------------------------------------------------------------------------
+ *  Description : Writes the stage histograms, the counters and the event
+ *                ring as text to a file
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool TraceDump(const char *Path);
+
+#endif // TRACE_H
@@ -0,0 +1,254 @@
+#include "uldstatuspage.h"
+#include "ui_uldstatuspage.h"
+#include "panelimage.h"
+#include <QDebug>
+#include <QString>
+#include "common.h"
+#include "displayrefresh.h"
+#include "tablecell.h"
+#include "trace.h"
+
+
+static int PHt = 30;
+static int PWt = 15;
+
+int PXCord[116] = {1700,1668,1636,1604,1572,1540,1508,1476,
+                     1444,1412,1380,1348,1316,1284,1252,1220,
+                     1188,1156,1124,1092,1060,1028,996,964,932,
+                     900,868,836,804,772,740,708,676,644,612,
+                     580,548,516,484,452,420,388,356,324,292,260,
+                     228,196,164,132,650,600,550,500,450,400,500,430,400,
+                     1700,1668,1636,1604,1572,1540,1508,1476,
+                      1444,1412,1380,1348,1316,1284,1252,1220,
+                      1188,1156,1124,1092,1060,1028,996,964,932,
+                      900,868,836,804,772,740,708,676,644,612,
+                      580,548,516,484,452,420,388,356,324,292,260,
+                      228,196,164,132,650,600,550,500,450,425,400};
+
+int PYCord[116] = {190,190,190,190,190,190,190,190,190,190,190,
+                     190,190,190,190,190,190,190,190,190,190,190,190,
+                     190,190,190,190,190,190,190,190,190,190,190,190,
+                     190,190,190,190,190,190,190,190,190,190,190,190,190,
+                     190,190,230,230,230,230,230,230,150,150,150,330,330,
+                     330,330,330,330,330,330,330,330,330,
+                     330,330,330,330,330,330,330,330,330,330,330,330,330,
+                     330,330,330,330,330,330,330,330,330,330,330,330,330,
+                     330,330,330,330,330,330,330,330,330,330,330,330,330,
+                     280,280,280,280,280,280,280};
+
+ULDStatusPage::ULDStatusPage(QWidget *parent) :
+    QDialog(parent),
+    ui(new Ui::ULDStatusPage)
+{
+    ui->setupUi(this);
+    qDebug() << "ULD Status Page";
+    //set the main page background
+    SetPageBackground(this, "ULDStatusPage.png");
+
+    BackButton = new QPushButton("", this);
+    BackButton->setGeometry(QRect(QPoint(ULD_BK_BTN_X, ULD_BK_BTN_Y), QSize(ULD_BK_BTN_WT, ULD_BK_BTN_HT)));
+    QPixmap BackButtonBkg(BaseFolder + "BackButton.png");
+    QIcon BackButtonIcon(BackButtonBkg.scaled(ULD_BK_BTN_WT, ULD_BK_BTN_HT,Qt::KeepAspectRatio));
+    BackButton->setIcon(BackButtonIcon);
+    BackButton->setIconSize(BackButtonBkg.rect().size());
+    connect(BackButton, &QPushButton::released, this, &ULDStatusPage::HandleBackButton);
+
+    Deck = new DeckView(this);
+
+    int Pos;
+    for(Pos = 0; Pos < PDU_MAX_COUNT  ; Pos++){
+            Deck->SetItem(DECK_ITEM_PDU + Pos, QRect(PXCord[Pos],PYCord[Pos],PWt,PHt), true, false);
+            Deck->SetIcon(DECK_ITEM_PDU + Pos, GetIcon(ICON_PDU_GREY, PWt, PHt));
+    }
+    for(Pos = 0; Pos < ULD_LANE_COUNT; Pos++){
+        Painted.Occupied[Pos] = 0;
+        Painted.Overlap[Pos] = 0;
+    }
+
+    //Stops the ULDs that no longer move, runs only while the page is shown
+    ExpireTimer = new QTimer(this);
+    ExpireTimer->setInterval(ULD_EXPIRE_MS);
+    connect(ExpireTimer, SIGNAL(timeout()), this, SLOT(HandleExpire()));
+
+    connect(&displayRefresh, SIGNAL(LRUDataChanged(quint32)), this, SLOT(UpdateUI(quint32)));
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Feeds the ULD Status words to the tracker and updates the
+ *                table and the deck. The tracker runs while the page is
+ *                hidden too, so the speeds are known when it is shown.
+ *                Until the ULD Status is decoded the words are all 0, see
+ *                ULDTracker.
+ *
+ *  Arguments   : LRU groups changed since the previous refresh
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ULDStatusPage::UpdateUI(quint32 ChangedGroups)
+{
+    uint64_t NowMs = TraceNow() / 1000000;
+    bool Moved = false;
+    int UldNo;
+
+    if((ChangedGroups & LRU_CHANGED_ULD) == 0){
+        return;
+    }
+    for(UldNo = 0; UldNo < ULD_MAX_COUNT; UldNo++){
+        //Returns at once when the edges of the ULD did not move
+        Moved |= Tracker.Update(UldNo, _ULD[UldNo].Data, NowMs);
+    }
+    if(!isVisible()){
+        return;
+    }
+
+    for(UldNo = 0; UldNo < ULD_TABLE_COLUMNS; UldNo++){
+        if(!Versions.Changed(LRU_VERSION_ULD + UldNo)){
+            continue;
+        }
+
+        //Update ULD Status Table
+        SetCell(ui->ULDStatusTable, ROW1, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_type::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW2, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_SW_Latch::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW3, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_Size::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW4, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_LH_Leading_Edge_PDU::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW5, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_RH_Leading_Edge_PDU::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW6, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_LH_Trailing_Edge_PDU::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW7, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_RH_Trailing_Edge_PDU::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW9, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_LH_Next_PDU::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW10, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_RH_Next_PDU::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW11, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_LH_Lagging_Edge_PDU::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW12, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_RH_Lagging_Edge_PDU::Value(_ULD[UldNo].Data));
+        SetCell(ui->ULDStatusTable, ROW13, UldNo+1, (qulonglong)ICD_ULD_Status::ULD_Movement::Value(_ULD[UldNo].Data1));
+    }
+
+    RepaintDeck();
+    if(Tracker.Expire(NowMs) || Moved){
+        UpdateMotion();
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Takes the ULDs that stopped moving out of the speed row
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ULDStatusPage::HandleExpire()
+{
+    if(Tracker.Expire(TraceNow() / 1000000)){
+        UpdateMotion();
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Sets the icon of the PDUs whose occupancy differs from the
+ *                one painted: grey when free, green under one ULD, red under
+ *                more than one
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ULDStatusPage::RepaintDeck()
+{
+    static const int FirstPDU[ULD_LANE_COUNT] = {ULD_LANE_LH_FIRST_PDU, ULD_LANE_RH_FIRST_PDU};
+    const DeckOccupancy &Current = Tracker.GetOccupancy();
+    LaneMask Diff, Bit;
+    int Lane, Pos;
+
+    for(Lane = 0; Lane < ULD_LANE_COUNT; Lane++){
+        Diff = (Painted.Occupied[Lane] ^ Current.Occupied[Lane]) |
+               (Painted.Overlap[Lane] ^ Current.Overlap[Lane]);
+
+        while(Diff != 0){
+            Pos = __builtin_ctzll(Diff);
+            Bit = 1ULL << Pos;
+            Diff &= Diff - 1;
+
+            Deck->SetIcon(DECK_ITEM_PDU + FirstPDU[Lane] + Pos,
+                          GetIcon((Current.Overlap[Lane] & Bit) ? ICON_PDU_RED :
+                                  (Current.Occupied[Lane] & Bit) ? ICON_PDU_GREEN : ICON_PDU_GREY, PWt, PHt));
+        }
+        Painted.Occupied[Lane] = Current.Occupied[Lane];
+        Painted.Overlap[Lane] = Current.Overlap[Lane];
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Shows the speed of every ULD in PDUs per second, negative
+ *                towards lower PDU numbers, and flags the colliding ULDs
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ULDStatusPage::UpdateMotion()
+{
+    uint32_t Collisions = Tracker.GetCollisions();
+    int UldNo;
+
+    for(UldNo = 0; UldNo < ULD_TABLE_COLUMNS; UldNo++){
+        const ULDTrack &Track = Tracker.GetTrack(UldNo);
+
+        if(!Track.Present){
+            SetCell(ui->ULDStatusTable, ROW8, UldNo+1, QStringLiteral(""));
+        }
+        else if(Collisions & (1U << UldNo)){
+            SetCell(ui->ULDStatusTable, ROW8, UldNo+1, QString::number(Track.Velocity, 'f', 1) + QStringLiteral(" COL"));
+        }
+        else{
+            SetCell(ui->ULDStatusTable, ROW8, UldNo+1, QString::number(Track.Velocity, 'f', 1));
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Starts the stop detection while the page is shown
+ *
+ *  Arguments   : Show event
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ULDStatusPage::showEvent(QShowEvent *Event)
+{
+    QDialog::showEvent(Event);
+    UpdateMotion();
+    ExpireTimer->start();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Stops the stop detection while the page is hidden
+ *
+ *  Arguments   : Hide event
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ULDStatusPage::hideEvent(QHideEvent *Event)
+{
+    ExpireTimer->stop();
+    QDialog::hideEvent(Event);
+}
+
+void ULDStatusPage::HandleBackButton(){
+    PrevPage = DSS;
+    CurrPage = MAINT;
+    hide();
+}
+
+ULDStatusPage::~ULDStatusPage()
+{
+    delete ui;
+}
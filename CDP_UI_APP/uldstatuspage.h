@@ -0,0 +1,57 @@
+#ifndef ULDSTATUSPAGE_H
+#define ULDSTATUSPAGE_H
+
+#include <QDialog>
+#include <QPixmap>
+#include <QPushButton>
+#include <QTimer>
+#include "commondata.h"
+#include "iconmap.h"
+#include "candispatch.h"
+#include "deckview.h"
+#include "uldtracker.h"
+
+#define ULD_BK_BTN_WT       80
+#define ULD_BK_BTN_HT       80
+#define ULD_BK_BTN_X        20
+#define ULD_BK_BTN_Y        20
+
+#define ULD_TABLE_COLUMNS   19          //ULDs shown in the status table
+#define ULD_EXPIRE_MS       250
+
+
+namespace Ui {
+class ULDStatusPage;
+}
+
+class ULDStatusPage : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit ULDStatusPage(QWidget *parent = 0);
+    ~ULDStatusPage();
+
+protected:
+    void showEvent(QShowEvent *Event);
+    void hideEvent(QHideEvent *Event);
+
+private slots:
+    void UpdateUI(quint32 ChangedGroups);
+    void HandleExpire();
+    void HandleBackButton();
+
+private:
+    void RepaintDeck();
+    void UpdateMotion();
+
+    Ui::ULDStatusPage *ui;
+    LRUVersionView          Versions;
+    ULDTracker              Tracker;
+    DeckOccupancy           Painted;        //Occupancy the PDU icons show
+    DeckView                *Deck;
+    QPushButton             *BackButton;
+    QTimer                  *ExpireTimer;
+};
+
+#endif // ULDSTATUSPAGE_H
@@ -0,0 +1,288 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : uldtracker.cpp
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Keeps the deck occupancy of the ULD Status messages as one PDU bit
+ *                mask per lane and derives overlaps, collisions and the speed and
+ *                direction of every ULD from the successive edge positions.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen
+ *
+ *-----------------------------------------------------------------------------
+ */
+
+/****************************** HEADER FILES *********************************/
+#include "uldtracker.h"
+#include "icdsignals.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+static_assert(ULD_LANE_LH_PDUS < 64 && ULD_LANE_RH_PDUS < 64, "A lane must fit one mask word");
+static_assert(ULD_MAX_COUNT <= 32, "Collisions hold one bit per ULD");
+
+/************************ LOCAL OPERATION DEFINITIONS ***********************/
+
+static inline uint32_t LowestBit(LaneMask Mask){
+    return (uint32_t)__builtin_ctzll(Mask);
+}
+
+static inline uint32_t HighestBit(LaneMask Mask){
+    return 63 - (uint32_t)__builtin_clzll(Mask);
+}
+
+static inline LaneMask LaneBits(uint8_t Lane){
+    return (1ULL << ((Lane == ULD_LANE_LH) ? ULD_LANE_LH_PDUS : ULD_LANE_RH_PDUS)) - 1;
+}
+
+/************************ EXPORTED OPERATION DEFINITIONS ********************/
+
+ULDTracker::ULDTracker()
+{
+    uint32_t Uld, Lane;
+
+    for(Uld = 0; Uld < ULD_MAX_COUNT; Uld++){
+        for(Lane = 0; Lane < ULD_LANE_COUNT; Lane++){
+            ULDMask[Uld][Lane] = 0;
+        }
+        Track[Uld].Present = false;
+        Track[Uld].Lane = ULD_LANE_LH;
+        Track[Uld].Direction = ULD_DIR_STOPPED;
+        Track[Uld].Position = 0;
+        Track[Uld].Velocity = 0;
+        Track[Uld].LastMoveMs = 0;
+    }
+    for(Lane = 0; Lane < ULD_LANE_COUNT; Lane++){
+        Deck.Occupied[Lane] = 0;
+        Deck.Overlap[Lane] = 0;
+    }
+    Collisions = 0;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : PDUs between two edges of a lane. The trailing edge PDU is
+ *                covered, the leading edge PDU is not, as on the ULD status
+ *                page so far; the edges may come in either order.
+ *
+ *  Arguments   : Edge PDUs on the lane, PDU count of the lane
+ *
+ *  Return Value: Mask of the covered PDUs
+ *
+ *-----------------------------------------------------------------------------
+ */
+LaneMask ULDTracker::EdgeMask(uint32_t Edge1, uint32_t Edge2, uint32_t LanePDUs)
+{
+    uint32_t Low = (Edge1 < Edge2) ? Edge1 : Edge2;
+    uint32_t High = (Edge1 < Edge2) ? Edge2 : Edge1;
+
+    if(High > LanePDUs){
+        High = LanePDUs;
+    }
+    if(Low >= High){
+        return 0;
+    }
+    return ((1ULL << High) - 1) & ~((1ULL << Low) - 1);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Takes the ULD Status word of one ULD. When its edges moved,
+ *                its track and the deck occupancy and collisions are updated.
+ *
+ *  Arguments   : ULD slot, ULD Status payload, monotonic time in ms
+ *
+ *  Return Value: true when the edges of the ULD moved, its velocity then
+ *                changed even if the deck occupancy did not
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ULDTracker::Update(uint8_t Uld, uint64_t Status, uint64_t NowMs)
+{
+    LaneMask Left, Right;
+
+    if(Uld >= ULD_MAX_COUNT){
+        return false;
+    }
+    Left = EdgeMask(ICD_ULD_Status::ULD_LH_Trailing_Edge_PDU::Get(Status),
+                    ICD_ULD_Status::ULD_LH_Leading_Edge_PDU::Get(Status), ULD_LANE_LH_PDUS);
+    Right = EdgeMask(ICD_ULD_Status::ULD_RH_Trailing_Edge_PDU::Get(Status),
+                     ICD_ULD_Status::ULD_RH_Leading_Edge_PDU::Get(Status), ULD_LANE_RH_PDUS);
+
+    if(Left == ULDMask[Uld][ULD_LANE_LH] && Right == ULDMask[Uld][ULD_LANE_RH]){
+        return false;
+    }
+    ULDMask[Uld][ULD_LANE_LH] = Left;
+    ULDMask[Uld][ULD_LANE_RH] = Right;
+
+    Move(Uld, NowMs);
+    Fold();
+    return true;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Stops the ULDs whose edges have not moved for
+ *                ULD_STOP_TIMEOUT_MS
+ *
+ *  Arguments   : Monotonic time in ms
+ *
+ *  Return Value: true when a ULD stopped
+ *
+ *-----------------------------------------------------------------------------
+ */
+bool ULDTracker::Expire(uint64_t NowMs)
+{
+    bool Stopped = false;
+    uint32_t Uld;
+
+    for(Uld = 0; Uld < ULD_MAX_COUNT; Uld++){
+        if(Track[Uld].Direction != ULD_DIR_STOPPED &&
+           NowMs - Track[Uld].LastMoveMs > ULD_STOP_TIMEOUT_MS){
+            Track[Uld].Direction = ULD_DIR_STOPPED;
+            Track[Uld].Velocity = 0;
+            Stopped = true;
+        }
+    }
+    if(Stopped){
+        Fold();
+    }
+    return Stopped;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Updates the motion of a ULD from its new masks. The centre
+ *                moves by half a PDU per edge step, so a ULD rolling over
+ *                the PDUs moves on every frame that shifts one of its edges.
+ *                The velocity is the step over the time since the previous
+ *                step, averaged with the last one while the direction holds.
+ *
+ *  Arguments   : ULD slot, monotonic time in ms
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ULDTracker::Move(uint8_t Uld, uint64_t NowMs)
+{
+    ULDTrack *Item = &Track[Uld];
+    uint8_t Lane = (ULDMask[Uld][ULD_LANE_LH] != 0) ? ULD_LANE_LH : ULD_LANE_RH;
+    LaneMask Mask = ULDMask[Uld][Lane];
+    int16_t Position;
+    uint64_t Elapsed;
+    float Step;
+
+    if(Mask == 0){
+        Item->Present = false;
+        Item->Direction = ULD_DIR_STOPPED;
+        Item->Velocity = 0;
+        return;
+    }
+    Position = (int16_t)(LowestBit(Mask) + HighestBit(Mask));
+
+    if(!Item->Present || Item->Lane != Lane){
+        //New on this lane, nothing to measure against yet
+        Item->Present = true;
+        Item->Lane = Lane;
+        Item->Direction = ULD_DIR_STOPPED;
+        Item->Velocity = 0;
+    }
+    else if(Position != Item->Position){
+        Elapsed = NowMs - Item->LastMoveMs;
+        if(Elapsed > ULD_STOP_TIMEOUT_MS){
+            Elapsed = ULD_STOP_TIMEOUT_MS;      //First step after a stop
+        }
+        if(Elapsed == 0){
+            Elapsed = 1;
+        }
+        Step = (float)(Position - Item->Position) * 500.0f / (float)Elapsed;
+
+        if((Step > 0 && Item->Direction == ULD_DIR_UP) || (Step < 0 && Item->Direction == ULD_DIR_DOWN)){
+            Item->Velocity = (Item->Velocity + Step) / 2;
+        }
+        else{
+            Item->Velocity = Step;
+        }
+        Item->Direction = (Step > 0) ? ULD_DIR_UP : ULD_DIR_DOWN;
+    }
+    Item->Position = Position;
+    Item->LastMoveMs = NowMs;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : Folds the ULD masks into the deck occupancy and the
+ *                collision bits
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+ */
+void ULDTracker::Fold()
+{
+    LaneMask Occupied[ULD_LANE_COUNT] = {0, 0};
+    LaneMask Overlap[ULD_LANE_COUNT] = {0, 0};
+    LaneMask Mask, Ahead;
+    uint32_t Uld, Lane;
+
+    for(Uld = 0; Uld < ULD_MAX_COUNT; Uld++){
+        for(Lane = 0; Lane < ULD_LANE_COUNT; Lane++){
+            Overlap[Lane] |= Occupied[Lane] & ULDMask[Uld][Lane];
+            Occupied[Lane] |= ULDMask[Uld][Lane];
+        }
+    }
+
+    Collisions = 0;
+    for(Uld = 0; Uld < ULD_MAX_COUNT; Uld++){
+        for(Lane = 0; Lane < ULD_LANE_COUNT; Lane++){
+            Mask = ULDMask[Uld][Lane];
+
+            //The PDU just past the edge in the direction of travel
+            switch(Track[Uld].Direction){
+            case ULD_DIR_UP:
+                Ahead = (Mask << 1) & ~Mask & LaneBits(Lane);
+                break;
+            case ULD_DIR_DOWN:
+                Ahead = (Mask >> 1) & ~Mask;
+                break;
+            default:
+                Ahead = 0;
+                break;
+            }
+            if((Mask & Overlap[Lane]) != 0 || (Ahead & Occupied[Lane]) != 0){
+                Collisions |= 1U << Uld;
+            }
+        }
+    }
+
+    for(Lane = 0; Lane < ULD_LANE_COUNT; Lane++){
+        Deck.Occupied[Lane] = Occupied[Lane];
+        Deck.Overlap[Lane] = Overlap[Lane];
+    }
+}
@@ -0,0 +1,132 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : uldtracker.h
+ *
+ *  CSCI Name       : Cargo Display Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef ULDTRACKER_H
+#define ULDTRACKER_H
+
+/****************************** HEADER FILES *********************************/
+#include <cstdint>
+#include "lrudata.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+//PDU numbers of the two lanes, as mapped in candispatch.cpp
+#define     ULD_LANE_LH_FIRST_PDU   0
+#define     ULD_LANE_LH_PDUS        59
+#define     ULD_LANE_RH_FIRST_PDU   59
+#define     ULD_LANE_RH_PDUS        57
+
+#define     ULD_STOP_TIMEOUT_MS     1500        //No edge moved for this long, ULD stopped
+
+/********************* ENUMS  *****************************/
+enum ULD_LANE {ULD_LANE_LH = 0,
+               ULD_LANE_RH,
+               ULD_LANE_COUNT};
+
+//Direction along the lane, by PDU number
+enum ULD_DIR {ULD_DIR_STOPPED = 0,
+              ULD_DIR_UP,                       //Towards higher PDU numbers
+              ULD_DIR_DOWN};
+
+/********************* Structures  *****************************/
+//One bit per PDU of the lane, bit 0 is the first PDU of the lane
+typedef uint64_t LaneMask;
+
+typedef struct{
+    LaneMask    Occupied[ULD_LANE_COUNT];
+    LaneMask    Overlap[ULD_LANE_COUNT];        //PDUs under more than one ULD
+}DeckOccupancy;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Motion of one ULD. Position is the centre of the ULD on its
+ *                lane in half PDUs, so both edges stay integral.
+ *
+ *-----------------------------------------------------------------------------
+ */
+typedef struct{
+    bool        Present;
+    uint8_t     Lane;
+    uint8_t     Direction;
+    int16_t     Position;
+    float       Velocity;                       //PDUs per second, signed like ULD_DIR_UP
+    uint64_t    LastMoveMs;
+}ULDTrack;
+
+/*-----------------------------------------------------------------------------
+ *  Description : Occupancy and motion of the ULDs on the deck.
+ *
+ *                Every ULD keeps the PDUs it covers as one 64 bit mask per
+ *                lane. Update() takes one ULD Status word; when the edges of
+ *                that ULD did not move it returns at once, otherwise the deck
+ *                masks are folded again from the ULD masks, an OR and an AND
+ *                per ULD and lane. Overlap and collision checks are mask ops
+ *                on the same words.
+ *
+ *                A ULD collides when it overlaps another ULD or when the PDU
+ *                in front of it, in its direction of travel, is occupied.
+ *
+ *                GUI thread only.
+ *
+ *                No Function ID decodes the ULD Status yet, nothing writes
+ *                lruStore.Data.ULDStatus and every word seen here is 0. Once
+ *                the ICD assigns one, Update() belongs in its dispatch route
+ *                on the parser thread, fed with the frame TimeStamp.
+ *
+ *-----------------------------------------------------------------------------
+ */
+class ULDTracker
+{
+public:
+    ULDTracker();
+
+    bool Update(uint8_t Uld, uint64_t Status, uint64_t NowMs);
+    bool Expire(uint64_t NowMs);
+
+    const DeckOccupancy &GetOccupancy() const   { return Deck; }
+    const ULDTrack &GetTrack(uint8_t Uld) const { return Track[Uld]; }
+    uint32_t GetCollisions() const              { return Collisions; }
+
+    static LaneMask EdgeMask(uint32_t Edge1, uint32_t Edge2, uint32_t LanePDUs);
+
+private:
+    void Fold();
+    void Move(uint8_t Uld, uint64_t NowMs);
+
+    LaneMask        ULDMask[ULD_MAX_COUNT][ULD_LANE_COUNT];
+    ULDTrack        Track[ULD_MAX_COUNT];
+    DeckOccupancy   Deck;
+    uint32_t        Collisions;                 //Bit per ULD
+};
+
+#endif // ULDTRACKER_H
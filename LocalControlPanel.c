@@ -46,6 +46,7 @@
 #include "../../Header/system/PIC32MK0512MCM100.h"
 #include "../../Header/PanelConfiguration.h"
 #include "../../Header/LocalControlPanel.h"
+#include "../../Header/LocalControlPanelTasks.h"
 #include "../../Header/DebounceLogic.h"
 #include "../../Header/CAN_FD.h"
 #include "../../Header/Timers.h"
@@ -59,6 +60,64 @@
 #define DLD_VALUE       (uint32_t)0x0000000DU
 #define JUMP_FLAG       (uint32_t)0x9D03FFFCU
 
+/* Dataload transfer, the image is staged in the upper half of the program 
+   flash and installed by the bootloader after the reset. Only under a
+   bootloader that sets DLD_BOOT_CAPS, see LocalControlPanelTasks.h */
+#define DLD_STAGED_VALUE    (uint32_t)0x0000000EU
+#define DLD_STAGE_BASE      (uint32_t)0x9D040000U
+#define DLD_STAGE_SIZE      (uint32_t)0x00040000U
+#define DLD_PAGE_SIZE       (uint32_t)0x00001000U
+#define DLD_FIFO            3U          /* Receive FIFO of AIDDATALOAD, at least 32 messages of 64 bytes */
+#define DLD_HEADER_SIZE     8U
+#define DLD_BLOCK_SIZE      56U         /* Data bytes of one CAN FD block frame */
+#define DLD_ACK_INTERVAL    8U          /* Blocks per acknowledge */
+#define DLD_FRAMES_PER_RUN  16U         /* Blocks flashed in one minor frame, about 5 ms */
+#define DLD_IDLE_FRAMES     200U        /* 2 s of minor frames without a frame ends the transfer */
+#define DLD_CRC_INIT        (uint32_t)0xFFFFFFFFU
+#define DLD_CRC_POLY        (uint32_t)0xEDB88320U
+
+#define DLD_FRAME_START     0x01U
+#define DLD_FRAME_DATA      0x02U
+#define DLD_FRAME_END       0x03U
+#define DLD_FRAME_ABORT     0x04U
+#define DLD_FRAME_ACK       0x81U
+
+#define DLD_ACK_READY           0x00U
+#define DLD_ACK_OK              0x01U
+#define DLD_ACK_CRC_ERROR       0x02U
+#define DLD_ACK_SEQUENCE        0x03U
+#define DLD_ACK_FLASH_ERROR     0x04U
+#define DLD_ACK_SIZE_ERROR      0x05U
+#define DLD_ACK_IMAGE_OK        0x06U
+#define DLD_ACK_IMAGE_CRC_ERROR 0x07U
+
+#define DLD_RESULT_RUNNING  0U
+#define DLD_RESULT_STAGED   1U
+#define DLD_RESULT_FAILED   2U
+
+/* Acceptance filter 8 of the CAN FD module routes AIDDATALOAD to DLD_FIFO. The MCC
+   configuration has to leave filter 8 unused and set FIFO 3 up to receive 64 byte
+   payloads, DataloadFilterInitForLCP checks both before it takes the filter. */
+#define DLD_FIFO_TXEN       (uint32_t)0x00000080U   /* TXEN of CFD1FIFOCON3 */
+#define DLD_FIFO_PLSIZE     (uint32_t)0xE0000000U   /* PLSIZE of CFD1FIFOCON3, 111 is 64 bytes */
+#define DLD_FILTER_BP_MASK  (uint32_t)0x0000001FU   /* F8BP of CFD1FLTCON2 */
+#define DLD_FILTER_ENABLE   (uint32_t)0x00000080U   /* FLTEN8 of CFD1FLTCON2 */
+#define DLD_FILTER_EXIDE    (uint32_t)0x40000000U   /* EXIDE of CFD1FLTOBJ8, MIDE of CFD1MASK8 */
+#define DLD_FILTER_SID_MASK (uint32_t)0x000007FFU
+#define DLD_FILTER_EID_MASK (uint32_t)0x0003FFFFU
+
+/* Cyclic executive, see SchedulerDispatchForLCP */
+#define SCHED_CORE_TICKS_US     60U         /* Core timer counts at SYSCLK / 2, 120 MHz */
+#define SCHED_REPORT_SLOT_BITS  3U
+#define SCHED_REPORT_FRAME      7U          /* Report slot of the minor frame figures */
+#define SCHED_OVERRUN_MAX       31U         /* Overrun count field of Engineering_Data_5 */
+#define SCHED_WCET_MAX_US       16383U      /* Engineering_Data_6 */
+
+/* Panel Command transmit policy, see TransmitDueForLCP */
+#define TXP_HEARTBEAT_FRAMES    10U         /* 100 ms, the CRDC marks a panel stale after 500 ms */
+#define TXP_EVENT_REPEATS       1U          /* Extra frames sent after an input or fault change */
+#define TXP_SEQUENCE_MASK       0x0FU
+
 #define VALUE           0x00
 
 /********************************* GLOBAL DATA ELEMENTS ***********************/
@@ -66,6 +125,27 @@
 LCP_CAN_DATA_TX LCP_CAN_Tx;
 LCP_CAN_DATA_RX LCP_CAN_Rx;
 PayloadBitsRx_LCP LCP_CAN_Rx_PrevMsgPayload;
+LCP_DATALOAD_SESSION LCP_Dataload;
+LCP_SCHEDULER LCP_Scheduler;
+LCP_TX_POLICY LCP_TxPolicy;
+
+/* Panel Command bits whose change is sent at once: the buttons, switches, faults and panel status. The
+   engineering bits and the current/voltage measurement only go out with the next frame. */
+const uint8_t LCP_TxEventMask[8] = {0xFCU, 0xFCU, 0xFCU, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U};
+
+/* Rate monotonic order, the shortest period first. Tasks of the same period run in
+   data flow order: the fault bits and inputs go out in this frame's Panel Command
+   before the Panel Status is read back. */
+const LCP_SCHED_TASK LCP_SchedTable[LCP_SCHED_TASK_COUNT] =
+{
+    /* Task                          Period  Offset  Deadline (us) */
+    { FaultMonitoringTaskForLCP,       1U,     0U,     1000U },
+    { InputProcessForLCP,              1U,     0U,     2000U },    /* Panel Command, PDU_Stop */
+    { LedControlForLCP,                1U,     0U,     5000U },    /* Panel Status */
+    { LampTestTaskForLCP,              1U,     0U,     6000U },
+    { DataloadTaskForLCP,              1U,     0U,     9000U },    /* Idle without a transfer */
+    { LEDControlDefaultsForLCP,       50U,    25U,     8000U }     /* PDU Stop LED blink, 500 ms */
+};
 
 
 /************************ EXPORTED OPERATION DEFINITIONS *********************/
@@ -163,6 +243,11 @@ void InitializationsForLCP(PanelType PanelID)
 --|    TMR0_Initialize()
 --|    TMR1_Initialize()
 --|    LCP_CAN_Rx.ArbitrationID.ArbitrationField.NodeID equal to PanelID
+--|    LCP_Dataload.Available equal to FALSE
+--|    if(DRV_FLASH0_ReadWord(DLD_BOOT_CAPS) is equal to  DLD_BOOT_STAGED_CAPS)
+--|        LCP_Dataload.Available equal to DataloadFilterInitForLCP(PanelID)
+--|    TransmitPolicyInitForLCP()
+--|    SchedulerInitForLCP()
 */
 	/* Initialize Input and Output Ports for LCP */
     InputAndOutputSignalInitForLCP();
@@ -175,6 +260,20 @@ void InitializationsForLCP(PanelType PanelID)
     
     /* Initialize Node Identifier with MCP ID */
     LCP_CAN_Rx.ArbitrationID.ArbitrationField.NodeID = PanelID;
+
+    /* Staged Dataload only under a bootloader that installs the staged image. The
+       Dataload request resets into the bootloader at once in any case */
+    LCP_Dataload.Available = FALSE;
+    if(DRV_FLASH0_ReadWord(DLD_BOOT_CAPS) == DLD_BOOT_STAGED_CAPS)
+    {
+        LCP_Dataload.Available = DataloadFilterInitForLCP(PanelID);
+    }
+
+    /* First Panel Command goes out in the first frame */
+    TransmitPolicyInitForLCP();
+
+    /* Minor frames start with the next TMR1 tick */
+    SchedulerInitForLCP();
 }
 /*-----------------------------------------------------------------------------
  *  Description : This function is responsible for execute the lamp test for push buttons and PDU stop.
@@ -249,7 +348,7 @@ bool ValidateDataloadRequestForLCP(void)
 */
     bool Valid = FALSE;
     
-    if(LCP_CAN_Rx.ArbitrationID.ArbitrationTotal == (uint8_t)0x15520480)
+    if(LCP_CAN_Rx.ArbitrationID.ArbitrationTotal == (uint32_t)0x15520480)
     {
         if(LCP_CAN_Rx.DLC == 8)
         {
@@ -497,8 +596,12 @@ void InputProcessForLCP(PanelType PanelID)
 --|bool packetsnt equal to false
 --|	LatchedInputProcessForLCP()
 --|    UpdateControlPanelArbitrationIDForLCP(PanelID)
---|    packetsnt equal to CANFD1_MessageTransmit(LCP_CAN_Tx.ArbitrationID.ArbitrationTotal
---|                     LCP_CAN_Tx.DLC LCP_CAN_Tx.Payload.PayloadTotal 0 0 0)
+--|    if(TransmitDueForLCP() equal to TRUE)
+--|        SchedulerReportForLCP()
+--|        TransmitSequenceForLCP()
+--|        packetsnt equal to CANFD1_MessageTransmit(LCP_CAN_Tx.ArbitrationID.ArbitrationTotal
+--|                         LCP_CAN_Tx.DLC LCP_CAN_Tx.Payload.PayloadTotal 0 0 0)
+--|        TransmitDoneForLCP(packetsnt)
 */
     bool packetsnt = false;
     
@@ -506,8 +609,15 @@ void InputProcessForLCP(PanelType PanelID)
     
     UpdateControlPanelArbitrationIDForLCP(PanelID);
     
-    packetsnt = CANFD1_MessageTransmit(LCP_CAN_Tx.ArbitrationID.ArbitrationTotal,
-                     LCP_CAN_Tx.DLC, LCP_CAN_Tx.Payload.PayloadTotal, 0, 0, 0); 
+    /* Sent on an input change, otherwise as a heartbeat */
+    if(TransmitDueForLCP() == TRUE)
+    {
+        SchedulerReportForLCP();
+        TransmitSequenceForLCP();
+        packetsnt = CANFD1_MessageTransmit(LCP_CAN_Tx.ArbitrationID.ArbitrationTotal,
+                         LCP_CAN_Tx.DLC, LCP_CAN_Tx.Payload.PayloadTotal, 0, 0, 0); 
+        TransmitDoneForLCP(packetsnt);
+    }
 }
 
 /*----------------------------------------------------------------------------
@@ -723,5 +833,812 @@ void FaultMonitoringForLCP(void)
     LCP_CAN_Tx.Payload.PayloadFormat.Lamp_Test_Fault     = (uint8_t)LampTestFault();
 }
 
-/*************************** End of file **************************/
+/*-----------------------------------------------------------------------------
+ *  Description : This function sets up acceptance filter 8 of the CAN FD module to route the Dataload frames
+ *                addressed to the panel into receive FIFO 3. A filter can be changed while the module runs
+ *                once it is disabled. FIFO 3 itself is a receive FIFO of the MCC configuration; the filter
+ *                is left alone when MCC enabled filter 8 or did not set FIFO 3 up for 64 byte frames.
+ *
+ *  Arguments   : PanelType
+ *
+ *  Return Value: bool, TRUE when the Dataload frames reach FIFO 3
+ *
+ *-----------------------------------------------------------------------------
+*/
+bool DataloadFilterInitForLCP(PanelType PanelID)
+{
+/*
+--| if((filter 8 enabled in CFD1FLTCON2) Logical OR (CFD1FIFOCON3 TXEN set) Logical OR
+--|    (CFD1FIFOCON3 PLSIZE is not 64 bytes))
+--|     return FALSE
+--| FilterID.NodeID is equal to  PanelID, FilterID.FunctionID is equal to  AIDDATALOAD
+--| FilterMask covers NodeID and FunctionID
+--| disable filter 8
+--| CFD1FLTOBJ8 is equal to  FilterID as SID/EID with EXIDE
+--| CFD1MASK8 is equal to  FilterMask as MSID/MEID with MIDE
+--| CFD1FLTCON2 filter 8 points to DLD_FIFO and is enabled
+--| return TRUE
+*/
+    ArbitrationID_LCP FilterID, FilterMask;
+
+    /* Filter 8 and FIFO 3 belong to the MCC configuration, taken only as expected */
+    if(((CFD1FLTCON2 & DLD_FILTER_ENABLE) != 0U) || ((CFD1FIFOCON3 & DLD_FIFO_TXEN) != 0U) ||
+       ((CFD1FIFOCON3 & DLD_FIFO_PLSIZE) != DLD_FIFO_PLSIZE))
+    {
+        return FALSE;
+    }
+
+    FilterID.ArbitrationTotal = 0;
+    FilterID.ArbitrationField.NodeID = PanelID;
+    FilterID.ArbitrationField.FunctionID = AIDDATALOAD;
+    FilterMask.ArbitrationTotal = 0;
+    FilterMask.ArbitrationField.NodeID = 0xFF;
+    FilterMask.ArbitrationField.FunctionID = 0x3F;
+
+    CFD1FLTCON2 &= ~(DLD_FILTER_ENABLE | DLD_FILTER_BP_MASK);
+    CFD1FLTOBJ8 = ((FilterID.ArbitrationTotal >> 18) & DLD_FILTER_SID_MASK) |
+                  ((FilterID.ArbitrationTotal & DLD_FILTER_EID_MASK) << 11) | DLD_FILTER_EXIDE;
+    CFD1MASK8   = ((FilterMask.ArbitrationTotal >> 18) & DLD_FILTER_SID_MASK) |
+                  ((FilterMask.ArbitrationTotal & DLD_FILTER_EID_MASK) << 11) | DLD_FILTER_EXIDE;
+    CFD1FLTCON2 |= (DLD_FIFO & DLD_FILTER_BP_MASK) | DLD_FILTER_ENABLE;
+    return TRUE;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function updates a CRC-32 (IEEE 802.3, reflected) over the Data bytes. The caller
+ *                starts from DLD_CRC_INIT and inverts the result.
+ *
+ *  Arguments   : CRC, Data, Length
+ *
+ *  Return Value: uint32_t
+ *
+ *-----------------------------------------------------------------------------
+*/
+uint32_t DataloadCRCForLCP(uint32_t CRC, const uint8_t *Data, uint32_t Length)
+{
+/*
+--| for each byte of Data
+--|     CRC is equal to  CRC XOR byte
+--|     for each of the 8 bits
+--|         if(bit 0 of CRC is equal to  1)
+--|             CRC is equal to  (CRC shifted right by 1) XOR DLD_CRC_POLY
+--|         else
+--|             CRC is equal to  CRC shifted right by 1
+--| return CRC
+*/
+    uint32_t Pos;
+    uint8_t Bit;
+
+    for(Pos = 0; Pos < Length; Pos++)
+    {
+        CRC ^= Data[Pos];
+        for(Bit = 0; Bit < 8U; Bit++)
+        {
+            CRC = ((CRC & 1U) != 0U) ? ((CRC >> 1) ^ DLD_CRC_POLY) : (CRC >> 1);
+        }
+    }
+    return CRC;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function sends the Dataload Acknowledge with the next expected block
+ *                for Local Control Panels(1/2/3 LH/RH).
+ *
+ *  Arguments   : PanelType, Status
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void DataloadAckForLCP(PanelType PanelID, uint8_t Status)
+{
+/*
+--| ArbitrationID_LCP AckID
+--| AckID.ArbitrationField.NodeID is equal to  PanelID
+--| AckID.ArbitrationField.FunctionID is equal to  AIDDATALOADACK
+--| Ack is equal to  DLD_FRAME_ACK, Status, LCP_Dataload.NextBlock (LSB first), 0, 0, 0, 0
+--| CANFD1_MessageTransmit(AckID.ArbitrationTotal, 8, Ack, 0, 0, 0)
+*/
+    ArbitrationID_LCP AckID;
+    uint8_t Ack[8] = {0};
+
+    AckID.ArbitrationTotal = 0;
+    AckID.ArbitrationField.RCI = AIDRCI;
+    AckID.ArbitrationField.NodeID = PanelID;
+    AckID.ArbitrationField.FunctionID = AIDDATALOADACK;
+
+    Ack[0] = DLD_FRAME_ACK;
+    Ack[1] = Status;
+    Ack[2] = (uint8_t)(LCP_Dataload.NextBlock & 0xFFU);
+    Ack[3] = (uint8_t)(LCP_Dataload.NextBlock >> 8);
+
+    (void)CANFD1_MessageTransmit(AckID.ArbitrationTotal, 8, Ack, 0, 0, 0);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function handles the Dataload Start frame. A Start for the image in progress
+ *                resumes it at the next expected block, any other image starts over.
+ *
+ *  Arguments   : PanelType, Frame, Length
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void DataloadStartForLCP(PanelType PanelID, const uint8_t *Frame, uint8_t Length)
+{
+/*
+--| if(Length is less than 10)
+--|     return
+--| Size is equal to  Frame[2..5], CRC is equal to  Frame[6..9] (LSB first)
+--| if((Size is equal to  0) Logical OR (Size is greater than DLD_STAGE_SIZE))
+--|     DataloadAckForLCP(PanelID, DLD_ACK_SIZE_ERROR)
+--| else
+--|     if((LCP_Dataload.Started is equal to  FALSE) Logical OR (Size, CRC differ from the image in progress))
+--|         LCP_Dataload restarts at block 0 with the CRC at DLD_CRC_INIT
+--|     LATAbits.LATA8, LATBbits.LATB4, LATAbits.LATA4 is equal to  FALSE
+--|     LCP_Dataload.Started is equal to  TRUE
+--|     LCP_Dataload.IdleFrames is equal to  0
+--|     DataloadAckForLCP(PanelID, DLD_ACK_READY)
+*/
+    uint32_t Size, CRC;
+
+    if(Length < 10U)
+    {
+        return;
+    }
+    Size = (uint32_t)Frame[2] | ((uint32_t)Frame[3] << 8) | ((uint32_t)Frame[4] << 16) | ((uint32_t)Frame[5] << 24);
+    CRC  = (uint32_t)Frame[6] | ((uint32_t)Frame[7] << 8) | ((uint32_t)Frame[8] << 16) | ((uint32_t)Frame[9] << 24);
+
+    if((Size == 0U) || (Size > DLD_STAGE_SIZE))
+    {
+        DataloadAckForLCP(PanelID, DLD_ACK_SIZE_ERROR);
+    }
+    else
+    {
+        if((LCP_Dataload.Started == FALSE) || (LCP_Dataload.ImageSize != Size) || (LCP_Dataload.ImageCRC != CRC))
+        {
+            LCP_Dataload.ImageSize  = Size;
+            LCP_Dataload.ImageCRC   = CRC;
+            LCP_Dataload.RunningCRC = DLD_CRC_INIT;
+            LCP_Dataload.ErasedTo   = DLD_STAGE_BASE;
+            LCP_Dataload.BlockCount = (uint16_t)((Size + DLD_BLOCK_SIZE - 1U) / DLD_BLOCK_SIZE);
+            LCP_Dataload.NextBlock  = 0;
+        }
+        LATAbits.LATA8 = FALSE; /* ON LED1 */
+        LATBbits.LATB4 = FALSE; /* ON LED2 */
+        LATAbits.LATA4 = FALSE; /* ON LED3 */
+        LCP_Dataload.Started    = TRUE;
+        LCP_Dataload.IdleFrames = 0;
+        LCP_Dataload.NakSent = FALSE;
+        DataloadAckForLCP(PanelID, DLD_ACK_READY);
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function validates one Dataload block and writes it to the staging area. Blocks
+ *                are accepted in order only, the first missing or corrupted block is reported once
+ *                and the CDP sends again from there.
+ *
+ *  Arguments   : PanelType, Frame, Length
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void DataloadBlockForLCP(PanelType PanelID, const uint8_t *Frame, uint8_t Length)
+{
+/*
+--| if((LCP_Dataload.Started is equal to  FALSE) Logical OR (Length is less than DLD_HEADER_SIZE))
+--|     return
+--| Block is equal to  Frame[2..3], BlockCRC is equal to  Frame[4..7] (LSB first)
+--| if(Block is less than LCP_Dataload.NextBlock)
+--|     return
+--| BlockLength is equal to  image bytes left, at most DLD_BLOCK_SIZE
+--| if(Block is greater than LCP_Dataload.NextBlock)
+--|     Status is equal to  DLD_ACK_SEQUENCE
+--| else if((Length is less than DLD_HEADER_SIZE + BlockLength) Logical OR
+--|         (CRC of the block data is not equal to  BlockCRC))
+--|     Status is equal to  DLD_ACK_CRC_ERROR
+--| else
+--|     erase the staging pages up to the end of the block
+--|     write the block data as words, the last word padded with 0xFF
+--|     if(an erase or write failed)
+--|         DataloadAckForLCP(PanelID, DLD_ACK_FLASH_ERROR)
+--|         return
+--|     LCP_Dataload.RunningCRC is equal to  DataloadCRCForLCP(LCP_Dataload.RunningCRC, block data)
+--|     LCP_Dataload.NextBlock is equal to  LCP_Dataload.NextBlock + 1
+--|     LCP_Dataload.NakSent is equal to  FALSE
+--|     if((NextBlock is a multiple of DLD_ACK_INTERVAL) Logical OR (NextBlock is equal to  BlockCount))
+--|         DataloadAckForLCP(PanelID, DLD_ACK_OK)
+--|     return
+--| if(LCP_Dataload.NakSent is equal to  FALSE)
+--|     DataloadAckForLCP(PanelID, Status)
+--|     LCP_Dataload.NakSent is equal to  TRUE
+*/
+    uint16_t Block;
+    uint32_t BlockCRC, BlockLength, Address, Word, Pos, Byte;
+    uint8_t Status;
+    bool Written = TRUE;
+
+    if((LCP_Dataload.Started == FALSE) || (Length < DLD_HEADER_SIZE))
+    {
+        return;
+    }
+    Block    = (uint16_t)((uint16_t)Frame[2] | ((uint16_t)Frame[3] << 8));
+    BlockCRC = (uint32_t)Frame[4] | ((uint32_t)Frame[5] << 8) | ((uint32_t)Frame[6] << 16) | ((uint32_t)Frame[7] << 24);
+
+    if(Block < LCP_Dataload.NextBlock)
+    {
+        /* Sent again after a rewind, already written */
+        return;
+    }
+
+    Address = (uint32_t)Block * DLD_BLOCK_SIZE;
+    BlockLength = (Address < LCP_Dataload.ImageSize) ? (LCP_Dataload.ImageSize - Address) : 0U;
+    if(BlockLength > DLD_BLOCK_SIZE)
+    {
+        BlockLength = DLD_BLOCK_SIZE;
+    }
+    Address += DLD_STAGE_BASE;
+
+    if(Block > LCP_Dataload.NextBlock)
+    {
+        Status = DLD_ACK_SEQUENCE;
+    }
+    else if((BlockLength == 0U) || ((uint32_t)Length < (DLD_HEADER_SIZE + BlockLength)) ||
+            ((DataloadCRCForLCP(DLD_CRC_INIT, &Frame[DLD_HEADER_SIZE], BlockLength) ^ DLD_CRC_INIT) != BlockCRC))
+    {
+        Status = DLD_ACK_CRC_ERROR;
+    }
+    else
+    {
+        /* Erase the staging pages ahead of the write */
+        while((Written == TRUE) && (LCP_Dataload.ErasedTo < (Address + BlockLength)))
+        {
+            Written = DRV_FLASH0_ErasePage(LCP_Dataload.ErasedTo);
+            LCP_Dataload.ErasedTo += DLD_PAGE_SIZE;
+        }
+        for(Pos = 0; (Written == TRUE) && (Pos < BlockLength); Pos += 4U)
+        {
+            Word = 0;
+            for(Byte = 4U; Byte > 0U; Byte--)
+            {
+                Word = (Word << 8) | (((Pos + Byte - 1U) < BlockLength) ? Frame[DLD_HEADER_SIZE + Pos + Byte - 1U] : 0xFFU);
+            }
+            Written = DRV_FLASH0_WriteWord(Address + Pos, Word);
+        }
+        if(Written == FALSE)
+        {
+            DataloadAckForLCP(PanelID, DLD_ACK_FLASH_ERROR);
+            return;
+        }
+
+        LCP_Dataload.RunningCRC = DataloadCRCForLCP(LCP_Dataload.RunningCRC, &Frame[DLD_HEADER_SIZE], BlockLength);
+        LCP_Dataload.NextBlock++;
+        LCP_Dataload.NakSent = FALSE;
+        if(((LCP_Dataload.NextBlock % DLD_ACK_INTERVAL) == 0U) || (LCP_Dataload.NextBlock == LCP_Dataload.BlockCount))
+        {
+            DataloadAckForLCP(PanelID, DLD_ACK_OK);
+        }
+        return;
+    }
+
+    /* The CDP goes back to NextBlock, the frames in flight behind the
+       failed one are not reported again */
+    if(LCP_Dataload.NakSent == FALSE)
+    {
+        DataloadAckForLCP(PanelID, Status);
+        LCP_Dataload.NakSent = TRUE;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function checks the staged image against the image CRC on the Dataload End frame.
+ *                An image that fails the check is received again from block 0.
+ *
+ *  Arguments   : PanelType
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+*/
+bool DataloadEndForLCP(PanelType PanelID)
+{
+/*
+--| bool Staged is equal to  FALSE
+--| if(LCP_Dataload.Started is equal to  TRUE)
+--|     if((LCP_Dataload.NextBlock is equal to  LCP_Dataload.BlockCount) Logical AND
+--|        ((LCP_Dataload.RunningCRC XOR DLD_CRC_INIT) is equal to  LCP_Dataload.ImageCRC))
+--|         DataloadAckForLCP(PanelID, DLD_ACK_IMAGE_OK)
+--|         Staged is equal to  TRUE
+--|     else
+--|         LCP_Dataload.Started is equal to  FALSE
+--|         DataloadAckForLCP(PanelID, DLD_ACK_IMAGE_CRC_ERROR)
+--| return Staged
+*/
+    bool Staged = FALSE;
+
+    if(LCP_Dataload.Started == TRUE)
+    {
+        if((LCP_Dataload.NextBlock == LCP_Dataload.BlockCount) &&
+           ((LCP_Dataload.RunningCRC ^ DLD_CRC_INIT) == LCP_Dataload.ImageCRC))
+        {
+            DataloadAckForLCP(PanelID, DLD_ACK_IMAGE_OK);
+            Staged = TRUE;
+        }
+        else
+        {
+            /* The next Start begins the image again */
+            LCP_Dataload.Started = FALSE;
+            LCP_Dataload.NextBlock = 0;
+            DataloadAckForLCP(PanelID, DLD_ACK_IMAGE_CRC_ERROR);
+        }
+    }
+    return Staged;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function receives a firmware image over CAN FD for Local Control Panels(1/2/3 LH/RH). It
+ *                runs once per minor frame and takes at most DLD_FRAMES_PER_RUN frames from FIFO 3, so the
+ *                Panel Command, the Panel Status and the heartbeat of the main loop go on during the transfer.
+ *                A Start frame begins the transfer, no Dataload request is needed. The blocks are flashed as
+ *                they arrive, so the bootloader only has to install the staged image after the reset.
+ *
+ *                Only runs when LCP_Dataload.Available, see InitializationsForLCP. A staged image ends in the
+ *                watchdog reset into the bootloader. A transfer that stops half way keeps the running software.
+ *
+ *  Arguments   : PanelType
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void DataloadTaskForLCP(PanelType PanelID)
+{
+/*
+--| if(LCP_Dataload.Available is equal to  FALSE)
+--|     return
+--| uint8_t Result is equal to  DLD_RESULT_RUNNING
+--| uint8_t Frames is equal to  0
+--| while((Result is equal to  DLD_RESULT_RUNNING) Logical AND (Frames is less than DLD_FRAMES_PER_RUN) Logical AND
+--|       (CANFD1_Receive(AND ID, AND Length, Frame, 0, DLD_FIFO, AND msgAttr) is equal to  TRUE))
+--|     Frames is equal to  Frames + 1
+--|     if((FunctionID is equal to  AIDDATALOAD) Logical AND (NodeID is equal to  PanelID) Logical AND
+--|        (Length is greater than 0))
+--|         switch(Frame[0])
+--|             DLD_FRAME_START : DataloadStartForLCP(PanelID, Frame, Length)
+--|             DLD_FRAME_DATA  : DataloadBlockForLCP(PanelID, Frame, Length)
+--|             DLD_FRAME_END   : if(DataloadEndForLCP(PanelID) is equal to  TRUE)
+--|                                   Result is equal to  DLD_RESULT_STAGED
+--|             DLD_FRAME_ABORT : Result is equal to  DLD_RESULT_FAILED
+--| if(Frames is equal to  0)
+--|     if(LCP_Dataload.Started is equal to  TRUE)
+--|         LCP_Dataload.IdleFrames is equal to  LCP_Dataload.IdleFrames + 1
+--|         if(LCP_Dataload.IdleFrames is greater than or equal to  DLD_IDLE_FRAMES)
+--|             Result is equal to  DLD_RESULT_FAILED
+--| else
+--|     LCP_Dataload.IdleFrames is equal to  0
+--| if(Result is equal to  DLD_RESULT_FAILED)
+--|     LCP_Dataload.Started is equal to  FALSE
+--|     LATAbits.LATA8 is equal to  TRUE 
+--|     LATBbits.LATB4 is equal to  TRUE
+--|     LATAbits.LATA4 is equal to  TRUE
+--| else if(Result is equal to  DLD_RESULT_STAGED)
+--|     DRV_FLASH0_WriteWord(JUMP_FLAG, DLD_STAGED_VALUE)
+--|     delay_us(100)
+--|     WATCHDOG_TimerStart()
+--|     while(TRUE)
+*/
+    uint8_t Result = DLD_RESULT_RUNNING;
+    uint8_t Frames = 0;
+    ArbitrationID_LCP FrameID;
+    uint8_t Frame[64];
+    uint8_t Length = 0;
+    CANFD_MSG_RX_ATTRIBUTE msgAttr;
+
+    if(LCP_Dataload.Available == FALSE)
+    {
+        return;
+    }
+
+    while((Result == DLD_RESULT_RUNNING) && (Frames < DLD_FRAMES_PER_RUN) &&
+          (CANFD1_Receive(&(FrameID.ArbitrationTotal), &Length, Frame, 0, DLD_FIFO, &msgAttr) == TRUE))
+    {
+        Frames++;
+        if((FrameID.ArbitrationField.FunctionID == AIDDATALOAD) &&
+           (FrameID.ArbitrationField.NodeID == PanelID) && (Length > 0U))
+        {
+            switch(Frame[0])
+            {
+                case DLD_FRAME_START:
+                    DataloadStartForLCP(PanelID, Frame, Length);
+                    break;
+                case DLD_FRAME_DATA:
+                    DataloadBlockForLCP(PanelID, Frame, Length);
+                    break;
+                case DLD_FRAME_END:
+                    if(DataloadEndForLCP(PanelID) == TRUE)
+                    {
+                        Result = DLD_RESULT_STAGED;
+                    }
+                    break;
+                case DLD_FRAME_ABORT:
+                    Result = DLD_RESULT_FAILED;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    if(Frames == 0U)
+    {
+        if(LCP_Dataload.Started == TRUE)
+        {
+            LCP_Dataload.IdleFrames++;
+            if(LCP_Dataload.IdleFrames >= DLD_IDLE_FRAMES)
+            {
+                /* Stopped half way keeps the running software */
+                Result = DLD_RESULT_FAILED;
+            }
+        }
+    }
+    else
+    {
+        LCP_Dataload.IdleFrames = 0;
+    }
+
+    if(Result == DLD_RESULT_FAILED)
+    {
+        /* Transfer given up, back to normal operation */
+        LCP_Dataload.Started = FALSE;
+        LATAbits.LATA8 = TRUE; /* OFF LED1 */
+        LATBbits.LATB4 = TRUE; /* OFF LED2 */
+        LATAbits.LATA4 = TRUE; /* OFF LED3 */
+    }
+    else if(Result == DLD_RESULT_STAGED)
+    {
+        /* Update Jump Flag Flash Address, the bootloader installs the staged image */
+        DRV_FLASH0_WriteWord(JUMP_FLAG, DLD_STAGED_VALUE);
+        delay_us(100);
+        /* Perform Internal Watch Dog Reset */
+        WATCHDOG_TimerStart();
+        /* Stop Heart Beat to perform External Watch Dog Reset */
+        while(TRUE)
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : These functions adapt the tasks without arguments to the LCP_SchedTable entries.
+ *
+ *  Arguments   : PanelType
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void FaultMonitoringTaskForLCP(PanelType PanelID)
+{
+    (void)PanelID;
+    FaultMonitoringForLCP();
+}
+
+void LampTestTaskForLCP(PanelType PanelID)
+{
+    (void)PanelID;
+    LampTestProcessForLCP();
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function clears the schedule figures and aligns the minor frame count to the TMR1 ticks.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void SchedulerInitForLCP(void)
+{
+/*
+--| LCP_Scheduler.Frame is equal to  LCP_Scheduler.Ticks
+--| clear the frame and task WCET, response and overrun figures
+--| LCP_Scheduler.ReportSlot is equal to  0
+*/
+    uint8_t Task;
+
+    LCP_Scheduler.Frame         = LCP_Scheduler.Ticks;
+    LCP_Scheduler.FrameOverruns = 0U;
+    LCP_Scheduler.FrameWCET     = 0U;
+    LCP_Scheduler.ReportSlot    = 0U;
+    for(Task = 0U; Task < LCP_SCHED_TASK_COUNT; Task++)
+    {
+        LCP_Scheduler.TaskWCET[Task]     = 0U;
+        LCP_Scheduler.TaskResponse[Task] = 0U;
+        LCP_Scheduler.TaskOverruns[Task] = 0U;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function starts a minor frame. It is called from the TMR1 period interrupt and is the only
+ *                writer of LCP_Scheduler.Ticks.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void SchedulerTickForLCP(void)
+{
+    LCP_Scheduler.Ticks++;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function puts the next slot of the schedule report into the Panel Command about to be
+ *                sent. Engineering_Data_5 holds the slot (task index, or SCHED_REPORT_FRAME for the minor frame)
+ *                in bits 0-2 and its overrun count in bits 3-7, Engineering_Data_6 its WCET in microseconds. Both
+ *                saturate. The slots rotate, a complete report takes LCP_SCHED_TASK_COUNT + 1 Panel Commands.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void SchedulerReportForLCP(void)
+{
+/*
+--| if(LCP_Scheduler.ReportSlot is less than LCP_SCHED_TASK_COUNT)
+--|     Overruns, WCET is equal to  the task figures of the slot
+--| else
+--|     Overruns, WCET is equal to  the minor frame figures
+--| Engineering_Data_5 is equal to  (Overruns << SCHED_REPORT_SLOT_BITS) | ReportSlot
+--| Engineering_Data_6 is equal to  WCET in microseconds
+--| ReportSlot is equal to  the next slot
+*/
+    uint32_t Overruns, WCET;
+    uint8_t Slot = LCP_Scheduler.ReportSlot;
+
+    if(Slot < LCP_SCHED_TASK_COUNT)
+    {
+        Overruns = LCP_Scheduler.TaskOverruns[Slot];
+        WCET     = LCP_Scheduler.TaskWCET[Slot];
+    }
+    else
+    {
+        Overruns = LCP_Scheduler.FrameOverruns;
+        WCET     = LCP_Scheduler.FrameWCET;
+    }
+    WCET = (WCET + SCHED_CORE_TICKS_US - 1U) / SCHED_CORE_TICKS_US;
+    if(Overruns > SCHED_OVERRUN_MAX)
+    {
+        Overruns = SCHED_OVERRUN_MAX;
+    }
+    if(WCET > SCHED_WCET_MAX_US)
+    {
+        WCET = SCHED_WCET_MAX_US;
+    }
+    LCP_CAN_Tx.Payload.PayloadFormat.Engineering_Data_5 = (uint8_t)((Overruns << SCHED_REPORT_SLOT_BITS) | Slot);
+    LCP_CAN_Tx.Payload.PayloadFormat.Engineering_Data_6 = WCET;
 
+    if(Slot == SCHED_REPORT_FRAME)
+    {
+        LCP_Scheduler.ReportSlot = 0U;
+    }
+    else if(Slot == (LCP_SCHED_TASK_COUNT - 1U))
+    {
+        LCP_Scheduler.ReportSlot = SCHED_REPORT_FRAME;
+    }
+    else
+    {
+        LCP_Scheduler.ReportSlot = Slot + 1U;
+    }
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function is the cyclic executive of the Local Control Panels(1/2/3 LH/RH). Called from the
+ *                main loop, it runs one minor frame for each TMR1 tick: every LCP_SchedTable task whose period and
+ *                offset select the frame, in table order. It measures the execution time of each task and its
+ *                completion after the frame start against the deadline on the core timer. When the loop falls
+ *                more than one tick behind, the late frames are dropped and counted so the task phases stay
+ *                aligned to TMR1.
+ *
+ *  Arguments   : PanelType
+ *
+ *  Return Value: bool, TRUE when a frame was run
+ *
+ *-----------------------------------------------------------------------------
+*/
+bool SchedulerDispatchForLCP(PanelType PanelID)
+{
+/*
+--| Pending is equal to  LCP_Scheduler.Ticks - LCP_Scheduler.Frame
+--| if(Pending is equal to  0)
+--|     return FALSE
+--| if(Pending is greater than 1)
+--|     LCP_Scheduler.FrameOverruns is equal to  LCP_Scheduler.FrameOverruns + Pending - 1
+--|     LCP_Scheduler.Frame is equal to  LCP_Scheduler.Ticks - 1
+--| for each Task of LCP_SchedTable
+--|     if((Frame MOD Period) is equal to  Offset)
+--|         run the Task, update its WCET, response and overruns
+--| update LCP_Scheduler.FrameWCET
+--| LCP_Scheduler.Frame is equal to  LCP_Scheduler.Frame + 1
+*/
+    uint32_t Pending, Frame, FrameStart, TaskStart, Now, Elapsed;
+    uint8_t Task;
+
+    Pending = LCP_Scheduler.Ticks - LCP_Scheduler.Frame;
+    if(Pending == 0U)
+    {
+        return FALSE;
+    }
+    if(Pending > 1U)
+    {
+        LCP_Scheduler.FrameOverruns += Pending - 1U;
+        LCP_Scheduler.Frame         += Pending - 1U;
+    }
+    Frame = LCP_Scheduler.Frame;
+
+    FrameStart = _CP0_GET_COUNT();
+    for(Task = 0U; Task < LCP_SCHED_TASK_COUNT; Task++)
+    {
+        if((Frame % LCP_SchedTable[Task].PeriodFrames) == LCP_SchedTable[Task].OffsetFrames)
+        {
+            TaskStart = _CP0_GET_COUNT();
+            LCP_SchedTable[Task].Task(PanelID);
+            Now = _CP0_GET_COUNT();
+            Elapsed = Now - TaskStart;
+            if(Elapsed > LCP_Scheduler.TaskWCET[Task])
+            {
+                LCP_Scheduler.TaskWCET[Task] = Elapsed;
+            }
+            Elapsed = Now - FrameStart;
+            if(Elapsed > LCP_Scheduler.TaskResponse[Task])
+            {
+                LCP_Scheduler.TaskResponse[Task] = Elapsed;
+            }
+            if(Elapsed > ((uint32_t)LCP_SchedTable[Task].DeadlineUs * SCHED_CORE_TICKS_US))
+            {
+                LCP_Scheduler.TaskOverruns[Task]++;
+            }
+        }
+    }
+    Elapsed = _CP0_GET_COUNT() - FrameStart;
+    if(Elapsed > LCP_Scheduler.FrameWCET)
+    {
+        LCP_Scheduler.FrameWCET = Elapsed;
+    }
+
+    /* Next minor frame, whatever the figures */
+    LCP_Scheduler.Frame++;
+    return TRUE;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function makes the next Panel Command go out at once and restarts the sequence counter.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void TransmitPolicyInitForLCP(void)
+{
+    uint8_t Pos;
+
+    for(Pos = 0U; Pos < 8U; Pos++)
+    {
+        LCP_TxPolicy.LastPayload[Pos] = 0U;
+    }
+    LCP_TxPolicy.FramesSinceTx = TXP_HEARTBEAT_FRAMES;
+    LCP_TxPolicy.Repeats       = 0U;
+    LCP_TxPolicy.Sequence      = 0U;
+    LCP_TxPolicy.Sent          = 0U;
+    LCP_TxPolicy.Events        = 0U;
+    LCP_TxPolicy.Failed        = 0U;
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function decides whether the Panel Command goes out in this frame. A change of any
+ *                LCP_TxEventMask bit since the last frame sent is transmitted at once and repeated
+ *                TXP_EVENT_REPEATS times, otherwise the frame is sent as a heartbeat every TXP_HEARTBEAT_FRAMES.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: bool
+ *
+ *-----------------------------------------------------------------------------
+*/
+bool TransmitDueForLCP(void)
+{
+/*
+--| Changed is equal to  FALSE
+--| for each payload byte
+--|     if(((byte XOR LCP_TxPolicy.LastPayload) AND LCP_TxEventMask) is not equal to 0)
+--|         Changed is equal to  TRUE
+--| if(Changed is equal to  TRUE)
+--|     LCP_TxPolicy.LastPayload is equal to  payload AND LCP_TxEventMask
+--|     LCP_TxPolicy.Repeats is equal to  TXP_EVENT_REPEATS + 1
+--| if(LCP_TxPolicy.FramesSinceTx is less than TXP_HEARTBEAT_FRAMES)
+--|     LCP_TxPolicy.FramesSinceTx is equal to  LCP_TxPolicy.FramesSinceTx + 1
+--| return (LCP_TxPolicy.Repeats is greater than 0) OR (FramesSinceTx reached TXP_HEARTBEAT_FRAMES)
+*/
+    bool Changed = FALSE;
+    uint8_t Pos;
+
+    for(Pos = 0U; Pos < 8U; Pos++)
+    {
+        if(((LCP_CAN_Tx.Payload.PayloadTotal[Pos] ^ LCP_TxPolicy.LastPayload[Pos]) & LCP_TxEventMask[Pos]) != 0U)
+        {
+            Changed = TRUE;
+        }
+    }
+    if(Changed == TRUE)
+    {
+        for(Pos = 0U; Pos < 8U; Pos++)
+        {
+            LCP_TxPolicy.LastPayload[Pos] = LCP_CAN_Tx.Payload.PayloadTotal[Pos] & LCP_TxEventMask[Pos];
+        }
+        LCP_TxPolicy.Repeats = TXP_EVENT_REPEATS + 1U;
+        LCP_TxPolicy.Events++;
+    }
+    if(LCP_TxPolicy.FramesSinceTx < TXP_HEARTBEAT_FRAMES)
+    {
+        LCP_TxPolicy.FramesSinceTx++;
+    }
+    return ((LCP_TxPolicy.Repeats > 0U) || (LCP_TxPolicy.FramesSinceTx >= TXP_HEARTBEAT_FRAMES));
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function puts the 4 bit sequence counter into the Panel Command, bits 0-1 in
+ *                Engineering_Data_1/2 and bits 2-3 in Engineering_Data_3/4.
+ *
+ *  Arguments   : void
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void TransmitSequenceForLCP(void)
+{
+    LCP_CAN_Tx.Payload.PayloadFormat.Engineering_Data_1 = (uint8_t)(LCP_TxPolicy.Sequence & 0x01U);
+    LCP_CAN_Tx.Payload.PayloadFormat.Engineering_Data_2 = (uint8_t)((LCP_TxPolicy.Sequence >> 1) & 0x01U);
+    LCP_CAN_Tx.Payload.PayloadFormat.Engineering_Data_3 = (uint8_t)((LCP_TxPolicy.Sequence >> 2) & 0x01U);
+    LCP_CAN_Tx.Payload.PayloadFormat.Engineering_Data_4 = (uint8_t)((LCP_TxPolicy.Sequence >> 3) & 0x01U);
+}
+
+/*-----------------------------------------------------------------------------
+ *  Description : This function records the result of a Panel Command transmit. A frame the CAN FIFO did not
+ *                take stays due and is tried again in the next frame with the same sequence number.
+ *
+ *  Arguments   : bool, TRUE when the frame was queued
+ *
+ *  Return Value: void
+ *
+ *-----------------------------------------------------------------------------
+*/
+void TransmitDoneForLCP(bool Sent)
+{
+    if(Sent == TRUE)
+    {
+        LCP_TxPolicy.FramesSinceTx = 0U;
+        LCP_TxPolicy.Sequence      = (uint8_t)((LCP_TxPolicy.Sequence + 1U) & TXP_SEQUENCE_MASK);
+        if(LCP_TxPolicy.Repeats > 0U)
+        {
+            LCP_TxPolicy.Repeats--;
+        }
+        LCP_TxPolicy.Sent++;
+    }
+    else
+    {
+        LCP_TxPolicy.Failed++;
+    }
+}
+
+/*************************** End of file **************************/
@@ -0,0 +1,161 @@
+/*----------------------------------------------------------------------------
+*                            ANCRA PROPRIETARY
+*
+* The information contained herein is proprietary to the Ancra International LLC
+*
+* and shall not be reproduced or disclosed in whole or in part or used for
+*
+* any design or manufacture except when such user possesses direct written
+*
+* authorization from the Ancra International LLC.
+*
+* (c) Copyright 2023 by the Ancra International LLC. All rights reserved.
+*---------------------------------------------------------------------------
+*/
+/*
+ *-----------------------------------------------------------------------------
+ *
+ *  File Name       : LocalControlPanelTasks.h
+ *
+ *  CSCI Name       : Control Panel
+ *
+ *  CSU Name        : Application
+ *
+ *  Report Number   : TBD
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Description : Declarations of the Local Control Panel cyclic executive, dataload task and
+ *                Panel Command transmit policy.
+ *                Shipped next to LocalControlPanel.c, goes to the Header folder of the panel
+ *                firmware.
+ *
+ *                Integration outside LocalControlPanel.c:
+ *                - TMR1_Initialize sets a 10 ms TMR1 period, the minor frame all periods of
+ *                  LCP_SchedTable count in.
+ *                - The TMR1 interrupt handler (Timers.c) calls SchedulerTickForLCP() after
+ *                  clearing IFS0bits.T1IF. The tasks themselves run in the main loop.
+ *                - main() calls InitializationsForLCP(PanelID) once, then on every pass of
+ *                  its loop SchedulerDispatchForLCP(PanelID) in place of the former calls
+ *                  of InputProcessForLCP, LedControlForLCP, LEDControlDefaultsForLCP,
+ *                  FaultMonitoringForLCP and LampTestProcessForLCP, next to the external
+ *                  watchdog heartbeat.
+ *                - The staged Dataload (DataloadTaskForLCP) needs a bootloader that installs
+ *                  the image staged at 0x9D040000 on JUMP_FLAG 0x0E and that writes
+ *                  DLD_BOOT_STAGED_CAPS to DLD_BOOT_CAPS. No such bootloader is released
+ *                  yet: until then the word reads erased and the panel never takes filter 8.
+ *                  The Dataload request always resets into the bootloader at once, as before.
+ *                - The MCC CAN FD configuration leaves acceptance filter 8 disabled and sets
+ *                  FIFO 3 up as a receive FIFO of 64 byte payloads. DataloadFilterInitForLCP
+ *                  checks both and keeps the staged Dataload off otherwise.
+ *
+ *
+ *
+ *-----------------------------------------------------------------------------
+ *
+ *  Revision History:
+ *
+ *  Version  Author        Date             Description
+ *           Mubeen                       Header delcarations
+ *
+ *
+ *-----------------------------------------------------------------------------
+ */
+#ifndef LOCALCONTROLPANELTASKS_H
+#define LOCALCONTROLPANELTASKS_H
+
+/****************************** HEADER FILES *********************************/
+#include "stdtypes.h"
+#include "PanelConfiguration.h"
+
+/********************* PREPROCESSOR DIRECTIVES  *****************************/
+/* Dataload messages, not part of the ICD, see dataload.h of the CDP */
+#define AIDDATALOAD         56U     /* FID_DATALOAD_DATA, CAN FD, receive FIFO 3 */
+#define AIDDATALOADACK      57U     /* FID_DATALOAD_ACK */
+
+/* Bootloader capability word, next to JUMP_FLAG */
+#define DLD_BOOT_CAPS           (uint32_t)0x9D03FFF8U
+#define DLD_BOOT_STAGED_CAPS    (uint32_t)0x53544731U   /* "STG1", installs staged images */
+
+#define LCP_SCHED_TASK_COUNT    6U      /* Entries of LCP_SchedTable */
+
+/********************************* GLOBAL DATA ELEMENTS ***********************/
+/* One task of the cyclic executive, see SchedulerDispatchForLCP */
+typedef struct
+{
+    void     (*Task)(PanelType PanelID);
+    uint16_t PeriodFrames;          /* Minor frames between two runs */
+    uint16_t OffsetFrames;          /* Frame of the period the task runs in */
+    uint16_t DeadlineUs;            /* Latest completion after the frame start */
+}LCP_SCHED_TASK;
+
+/* Schedule state and figures, times in core timer counts */
+typedef struct
+{
+    volatile uint32_t Ticks;        /* Written by the TMR1 interrupt only */
+    uint32_t Frame;                 /* Next minor frame to run */
+    uint32_t FrameOverruns;         /* Frames dropped because the loop fell behind */
+    uint32_t FrameWCET;
+    uint32_t TaskWCET[LCP_SCHED_TASK_COUNT];
+    uint32_t TaskResponse[LCP_SCHED_TASK_COUNT];    /* Worst completion after the frame start */
+    uint32_t TaskOverruns[LCP_SCHED_TASK_COUNT];    /* Completions past the deadline */
+    uint8_t  ReportSlot;
+}LCP_SCHEDULER;
+
+/* Panel Command transmit policy, see TransmitDueForLCP */
+typedef struct
+{
+    uint8_t  LastPayload[8];        /* Event bits of the last change sent */
+    uint16_t FramesSinceTx;
+    uint8_t  Repeats;               /* Frames still to send for the last change */
+    uint8_t  Sequence;              /* Of the next frame */
+    uint32_t Sent;
+    uint32_t Events;
+    uint32_t Failed;
+}LCP_TX_POLICY;
+
+/* Dataload transfer in progress, see DataloadTaskForLCP */
+typedef struct
+{
+    uint32_t ImageSize;
+    uint32_t ImageCRC;
+    uint32_t RunningCRC;            /* Over the blocks written, not inverted */
+    uint32_t ErasedTo;              /* First staging address not erased yet */
+    uint16_t BlockCount;
+    uint16_t NextBlock;
+    uint16_t IdleFrames;            /* Minor frames without a dataload frame */
+    bool     Available;             /* Bootloader, filter 8 and FIFO 3 ready for a staged image */
+    bool     Started;               /* Start frame accepted, transfer running */
+    bool     NakSent;               /* NextBlock reported missing already */
+}LCP_DATALOAD_SESSION;
+
+extern LCP_DATALOAD_SESSION LCP_Dataload;
+extern LCP_SCHEDULER LCP_Scheduler;
+extern const LCP_SCHED_TASK LCP_SchedTable[LCP_SCHED_TASK_COUNT];
+extern LCP_TX_POLICY LCP_TxPolicy;
+extern const uint8_t LCP_TxEventMask[8];
+
+/************************ EXPORTED OPERATION DECLARATIONS *******************/
+/* Page erase and word read of the flash driver, next to DRV_FLASH0_WriteWord */
+bool DRV_FLASH0_ErasePage(uint32_t address);
+uint32_t DRV_FLASH0_ReadWord(uint32_t address);
+
+bool DataloadFilterInitForLCP(PanelType PanelID);
+uint32_t DataloadCRCForLCP(uint32_t CRC, const uint8_t *Data, uint32_t Length);
+void DataloadAckForLCP(PanelType PanelID, uint8_t Status);
+void DataloadStartForLCP(PanelType PanelID, const uint8_t *Frame, uint8_t Length);
+void DataloadBlockForLCP(PanelType PanelID, const uint8_t *Frame, uint8_t Length);
+bool DataloadEndForLCP(PanelType PanelID);
+void DataloadTaskForLCP(PanelType PanelID);
+void FaultMonitoringTaskForLCP(PanelType PanelID);
+void LampTestTaskForLCP(PanelType PanelID);
+void SchedulerInitForLCP(void);
+void SchedulerTickForLCP(void);
+void SchedulerReportForLCP(void);
+bool SchedulerDispatchForLCP(PanelType PanelID);
+void TransmitPolicyInitForLCP(void);
+bool TransmitDueForLCP(void);
+void TransmitSequenceForLCP(void);
+void TransmitDoneForLCP(bool Sent);
+
+#endif /* LOCALCONTROLPANELTASKS_H */